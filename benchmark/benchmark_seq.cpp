@@ -0,0 +1,362 @@
+//
+// File: benchmark_seq.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for numerical calculus. This file is part of the Bio++ project.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+/*
+ * Micro-benchmarks for the most frequently used routines of the library.
+ *
+ * Usage: benchmark_seq [--scale S] [--repeats R] [--filter NAME] [--format tsv|json]
+ *
+ * Input data are generated deterministically, and their size is proportional to the scale factor.
+ * Each benchmark is run R times, and one line is printed per benchmark, either as tab-separated
+ * values (default, with a header) or as one JSON object per line. Times are in nanoseconds.
+ */
+
+#include <Bpp/Seq/Alphabet/AlphabetTools.h>
+#include <Bpp/Seq/GeneticCode/StandardGeneticCode.h>
+#include <Bpp/Seq/AlphabetIndex/DefaultNucleotideScore.h>
+#include <Bpp/Seq/Container/VectorSiteContainer.h>
+#include <Bpp/Seq/Container/CompressedVectorSiteContainer.h>
+#include <Bpp/Seq/Container/SiteContainerTools.h>
+#include <Bpp/Seq/Io/Fasta.h>
+#include <Bpp/Seq/Io/Phylip.h>
+#include <Bpp/Seq/SiteTools.h>
+#include <Bpp/Seq/SequenceTools.h>
+#include <Bpp/Seq/DistanceMatrix.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace bpp;
+using namespace std;
+
+/******************************************************************************/
+
+//Results are accumulated here so that the compiler cannot discard the measured work.
+static volatile double sink = 0;
+
+struct BenchmarkResult
+{
+  string name;
+  size_t size; //Number of items processed per run (bytes, states, sites, cells...)
+  string unit;
+  vector<double> times;
+  BenchmarkResult(): name(), size(0), unit(), times() {}
+};
+
+class BenchmarkRunner
+{
+  private:
+    size_t repeats_;
+    string filter_;
+    bool json_;
+    size_t count_;
+
+  public:
+    BenchmarkRunner(size_t repeats, const string& filter, bool json):
+      repeats_(repeats), filter_(filter), json_(json), count_(0) {}
+
+  public:
+    bool isSelected(const string& name) const
+    {
+      return filter_.empty() || name.find(filter_) != string::npos;
+    }
+
+    /**
+     * @brief Time a function object and print the result.
+     *
+     * @param name The name of the benchmark.
+     * @param size The number of items processed by one call, used to compute the throughput.
+     * @param unit The type of items processed.
+     * @param f The function to time. It should return a value depending on the computation.
+     */
+    template<class Function>
+    void run(const string& name, size_t size, const string& unit, Function f)
+    {
+      if (!isSelected(name)) return;
+      BenchmarkResult result;
+      result.name = name;
+      result.size = size;
+      result.unit = unit;
+      for (size_t r = 0; r < repeats_; ++r) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        sink = sink + static_cast<double>(f());
+        chrono::steady_clock::time_point stop = chrono::steady_clock::now();
+        result.times.push_back(static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(stop - start).count()));
+      }
+      print(result);
+    }
+
+  private:
+    void print(BenchmarkResult& result)
+    {
+      sort(result.times.begin(), result.times.end());
+      double min = result.times.front();
+      double median = result.times[result.times.size() / 2];
+      double mean = 0;
+      for (size_t i = 0; i < result.times.size(); ++i)
+        mean += result.times[i];
+      mean /= static_cast<double>(result.times.size());
+      double throughput = median > 0 ? static_cast<double>(result.size) / (median * 1e-9) : 0;
+      if (json_) {
+        cout << "{\"name\": \"" << result.name << "\", \"size\": " << result.size
+             << ", \"unit\": \"" << result.unit << "\", \"repeats\": " << result.times.size()
+             << ", \"min_ns\": " << min << ", \"median_ns\": " << median << ", \"mean_ns\": " << mean
+             << ", \"per_second\": " << throughput << "}" << endl;
+      } else {
+        if (count_ == 0)
+          cout << "name\tsize\tunit\trepeats\tmin_ns\tmedian_ns\tmean_ns\tper_second" << endl;
+        cout << result.name << "\t" << result.size << "\t" << result.unit << "\t" << result.times.size()
+             << "\t" << min << "\t" << median << "\t" << mean << "\t" << throughput << endl;
+      }
+      count_++;
+    }
+};
+
+/******************************************************************************/
+
+/**
+ * @brief Generate a random string over a set of characters.
+ *
+ * Characters are drawn with a bias toward the first ones, in order to obtain
+ * alignments with site patterns shared between columns.
+ */
+string randomString(mt19937& gen, size_t length, const string& chars)
+{
+  geometric_distribution<size_t> draw(0.5);
+  string s(length, chars[0]);
+  for (size_t i = 0; i < length; ++i)
+    s[i] = chars[draw(gen) % chars.size()];
+  return s;
+}
+
+/**
+ * @brief Generate an alignment by mutating a random ancestor.
+ *
+ * @param nbSequences Number of sequences.
+ * @param length Alignment length, in characters.
+ * @param divergence Probability for each position of each sequence to differ from the ancestor.
+ * @param chars The set of characters to use.
+ * @param gaps Tell if gaps should be inserted.
+ */
+vector<string> randomAlignment(mt19937& gen, size_t nbSequences, size_t length, double divergence, const string& chars, bool gaps)
+{
+  string ancestor = randomString(gen, length, chars);
+  uniform_real_distribution<double> u(0., 1.);
+  uniform_int_distribution<size_t> c(0, chars.size() - 1);
+  vector<string> alignment(nbSequences, ancestor);
+  for (size_t i = 0; i < nbSequences; ++i) {
+    for (size_t j = 0; j < length; ++j) {
+      double p = u(gen);
+      if (p < divergence)
+        alignment[i][j] = chars[c(gen)];
+      else if (gaps && p < divergence * 1.2)
+        alignment[i][j] = '-';
+    }
+  }
+  return alignment;
+}
+
+VectorSiteContainer* toContainer(const vector<string>& alignment, const Alphabet* alpha)
+{
+  VectorSiteContainer* sites = new VectorSiteContainer(alpha);
+  for (size_t i = 0; i < alignment.size(); ++i) {
+    ostringstream name;
+    name << "seq" << i;
+    sites->addSequence(BasicSequence(name.str(), alignment[i], alpha), false);
+  }
+  return sites;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv) {
+  double scale = 1.;
+  size_t repeats = 5;
+  string filter;
+  bool json = false;
+  for (int i = 1; i < argc; ++i) {
+    string arg = argv[i];
+    if (arg == "--scale" && i + 1 < argc) {
+      scale = atof(argv[++i]);
+    } else if (arg == "--repeats" && i + 1 < argc) {
+      repeats = static_cast<size_t>(atoi(argv[++i]));
+    } else if (arg == "--filter" && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (arg == "--format" && i + 1 < argc) {
+      json = string(argv[++i]) == "json";
+    } else {
+      cerr << "Usage: " << argv[0] << " [--scale S] [--repeats R] [--filter NAME] [--format tsv|json]" << endl;
+      return 1;
+    }
+  }
+  if (scale <= 0 || repeats == 0) {
+    cerr << "Scale and number of repeats must be positive." << endl;
+    return 1;
+  }
+
+  cout.precision(12);
+  BenchmarkRunner runner(repeats, filter, json);
+  mt19937 gen(42);
+  const Alphabet* dna = &AlphabetTools::DNA_ALPHABET;
+  size_t nbSeq = 32;
+  size_t length = max(static_cast<size_t>(10000. * scale), static_cast<size_t>(10));
+
+  vector<string> alignment = randomAlignment(gen, nbSeq, length, 0.1, "ACGT", true);
+  unique_ptr<VectorSiteContainer> sites(toContainer(alignment, dna));
+  size_t nbStates = nbSeq * length;
+
+  //Parsers and writers:
+  Fasta fasta;
+  ostringstream fastaOut;
+  fasta.writeSequences(fastaOut, *sites);
+  string fastaText = fastaOut.str();
+  runner.run("fasta_write", fastaText.size(), "bytes", [&]() {
+    ostringstream out;
+    fasta.writeSequences(out, *sites);
+    return out.str().size();
+  });
+  runner.run("fasta_read", fastaText.size(), "bytes", [&]() {
+    istringstream in(fastaText);
+    unique_ptr<SequenceContainer> seqs(fasta.readSequences(in, dna));
+    return seqs->getNumberOfSequences();
+  });
+
+  Phylip phylip(true, false);
+  ostringstream phylipOut;
+  phylip.writeAlignment(phylipOut, *sites);
+  string phylipText = phylipOut.str();
+  runner.run("phylip_write", phylipText.size(), "bytes", [&]() {
+    ostringstream out;
+    phylip.writeAlignment(out, *sites);
+    return out.str().size();
+  });
+  runner.run("phylip_read", phylipText.size(), "bytes", [&]() {
+    istringstream in(phylipText);
+    unique_ptr<SiteContainer> aln(phylip.readAlignment(in, dna));
+    return aln->getNumberOfSites();
+  });
+
+  //Alphabet conversions:
+  vector<string> chars(length);
+  for (size_t i = 0; i < length; ++i)
+    chars[i] = string(1, alignment[0][i]);
+  runner.run("char_to_int", length, "states", [&]() {
+    long s = 0;
+    for (size_t i = 0; i < chars.size(); ++i)
+      s += dna->charToInt(chars[i]);
+    return s;
+  });
+  vector<int> states(length);
+  for (size_t i = 0; i < length; ++i)
+    states[i] = (*sites)(0, i);
+  runner.run("int_to_char", length, "states", [&]() {
+    size_t s = 0;
+    for (size_t i = 0; i < states.size(); ++i)
+      s += dna->intToChar(states[i]).size();
+    return s;
+  });
+
+  //Strand operations:
+  BasicSequence strand("strand", alignment[0], dna);
+  runner.run("reverse_complement", length, "states", [&]() {
+    SequenceTools::invertComplement(strand);
+    return strand[0];
+  });
+
+  //Codon translation:
+  StandardGeneticCode gCode(&AlphabetTools::DNA_ALPHABET);
+  size_t nbCodons = max(length / 3, static_cast<size_t>(1));
+  string cds;
+  for (size_t i = 0; i < nbCodons; ++i) {
+    string codon;
+    do {
+      codon = randomString(gen, 3, "ACGT");
+    } while (gCode.isStop(gCode.getSourceAlphabet()->charToInt(codon)));
+    cds += codon;
+  }
+  BasicSequence codonSeq("cds", cds, gCode.getSourceAlphabet());
+  runner.run("codon_translation", nbCodons, "codons", [&]() {
+    unique_ptr<Sequence> prot(gCode.translate(codonSeq));
+    return prot->size();
+  });
+
+  //Site statistics:
+  runner.run("site_statistics", length, "sites", [&]() {
+    double s = 0;
+    for (size_t i = 0; i < sites->getNumberOfSites(); ++i) {
+      const Site& site = sites->getSite(i);
+      s += SiteTools::variabilityShannon(site, false);
+      if (SiteTools::isConstant(site, false, false)) s += 1;
+      if (SiteTools::isParsimonyInformativeSite(site)) s += 1;
+    }
+    return s;
+  });
+
+  //Compression of site patterns:
+  runner.run("compressed_container", nbStates, "states", [&]() {
+    CompressedVectorSiteContainer compressed(*sites);
+    return compressed.getNumberOfSites();
+  });
+
+  //Pairwise similarities:
+  runner.run("similarity_matrix", nbStates * (nbSeq - 1) / 2, "pairs_of_states", [&]() {
+    unique_ptr<DistanceMatrix> mat(SiteContainerTools::computeSimilarityMatrix(*sites));
+    return (*mat)(0, 1);
+  });
+
+  //Pairwise alignment, which is quadratic in the sequence length:
+  size_t nwLength = max(static_cast<size_t>(500. * scale), static_cast<size_t>(10));
+  vector<string> pair = randomAlignment(gen, 2, nwLength, 0.2, "ACGT", false);
+  BasicSequence nw1("seq1", pair[0], dna);
+  BasicSequence nw2("seq2", pair[1], dna);
+  DefaultNucleotideScore score(&AlphabetTools::DNA_ALPHABET);
+  runner.run("align_nw", nwLength * nwLength, "cells", [&]() {
+    unique_ptr<AlignedSequenceContainer> aln(SiteContainerTools::alignNW(nw1, nw2, score, -5., -1.));
+    return aln->getNumberOfSites();
+  });
+
+  return 0;
+}
@@ -40,6 +40,7 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include "AbstractAlphabet.h"
+#include "../Instrumentation.h"
 #include <Bpp/Text/TextTools.h>
 #include <Bpp/Utils/MapTools.h>
 
@@ -49,11 +50,45 @@ using namespace bpp;
 #include <ctype.h>
 #include <map>
 #include <iostream>
+#include <mutex>
 
 using namespace std;
 
 /******************************************************************************/
 
+const unsigned int Alphabet::CAP_LETTER;
+const unsigned int Alphabet::CAP_NUCLEIC;
+const unsigned int Alphabet::CAP_DNA;
+const unsigned int Alphabet::CAP_RNA;
+const unsigned int Alphabet::CAP_PROTEIC;
+const unsigned int Alphabet::CAP_WORD;
+const unsigned int Alphabet::CAP_CODON;
+const unsigned int Alphabet::CAP_CASE_MASKED;
+const unsigned int Alphabet::CAP_RNY;
+const unsigned int Alphabet::CAP_BINARY;
+const unsigned int Alphabet::CAP_DEFAULT;
+const unsigned int Alphabet::CAP_INTEGER;
+const unsigned int Alphabet::CAP_NUMERIC;
+const unsigned int Alphabet::CAP_LEXICAL;
+
+/******************************************************************************/
+
+unsigned int Alphabet::getTypeId_(const std::string& type)
+{
+  // Function-level statics, as alphabets may be built during static initialization.
+  static map<string, unsigned int> types;
+  static mutex typesMutex;
+  lock_guard<mutex> lock(typesMutex);
+  map<string, unsigned int>::const_iterator it = types.find(type);
+  if (it != types.end())
+    return it->second;
+  unsigned int id = static_cast<unsigned int>(types.size() + 1);
+  types[type] = id;
+  return id;
+}
+
+/******************************************************************************/
+
 void AbstractAlphabet::updateMaps_(size_t pos, const AlphabetState& st) {
   if (letters_.find(st.getLetter()) == letters_.end())
     letters_[st.getLetter()] = pos;
@@ -91,6 +126,7 @@ void AbstractAlphabet::setState(size_t pos, AlphabetState* st) {
 /******************************************************************************/
 
 const AlphabetState& AbstractAlphabet::getState(const std::string& letter) const {
+  BPP_SEQ_COUNT_CALL("AbstractAlphabet::getState");
   map<string, size_t>::const_iterator it = letters_.find(letter);
   if (it == letters_.end())
     throw BadCharException(letter, "AbstractAlphabet::getState(string): Specified base unknown", this);
@@ -109,6 +145,7 @@ size_t AbstractAlphabet::getStateIndex(const std::string& letter) const {
 /******************************************************************************/
 
 const AlphabetState& AbstractAlphabet::getState(int num) const {
+  BPP_SEQ_COUNT_CALL("AbstractAlphabet::getState");
   map<int, size_t>::const_iterator it = nums_.find(num);
   if (it == nums_.end())
     throw BadIntException(num, "AbstractAlphabet::getState(int): Specified base unknown", this);
@@ -176,6 +213,7 @@ std::string AbstractAlphabet::getName(int state) const
 
 int AbstractAlphabet::charToInt(const std::string& state) const
 {
+  BPP_SEQ_COUNT_CALL("AbstractAlphabet::charToInt");
   return getState(state).getNum();
 }
 
@@ -183,6 +221,7 @@ int AbstractAlphabet::charToInt(const std::string& state) const
 
 std::string AbstractAlphabet::intToChar(int state) const
 {
+  BPP_SEQ_COUNT_CALL("AbstractAlphabet::intToChar");
   return (getState(state)).getLetter();
 }
 
@@ -210,6 +249,7 @@ bool AbstractAlphabet::isCharInAlphabet(const std::string& state) const
 
 std::vector<int> AbstractAlphabet::getAlias(int state) const 
 {
+  BPP_SEQ_COUNT_CALL("AbstractAlphabet::getAlias");
   if (!isIntInAlphabet(state)) throw BadIntException(state, "AbstractAlphabet::getAlias(int): Specified base unknown.");
   vector<int> v(1);
   v[0] = state;
@@ -100,11 +100,17 @@ namespace bpp
     mutable std::vector<int> intList_;
     /** @} */
 
+  private:
+    /**
+     * @brief Capability flags, see addCapabilities().
+     */
+    unsigned int capabilities_;
+
   public:
 		
-    AbstractAlphabet(): alphabet_(), letters_(), nums_(), charList_(), intList_() {}
+    AbstractAlphabet(): alphabet_(), letters_(), nums_(), charList_(), intList_(), capabilities_(0) {}
 
-    AbstractAlphabet(const AbstractAlphabet& alph) : alphabet_(), letters_(alph.letters_), nums_(alph.nums_), charList_(alph.charList_), intList_(alph.intList_)
+    AbstractAlphabet(const AbstractAlphabet& alph) : Alphabet(alph), alphabet_(), letters_(alph.letters_), nums_(alph.nums_), charList_(alph.charList_), intList_(alph.intList_), capabilities_(alph.capabilities_)
     {
       for (size_t i = 0; i < alph.alphabet_.size(); ++i)
         alphabet_.push_back(new AlphabetState(*alph.alphabet_[i]));
@@ -112,6 +118,7 @@ namespace bpp
 
     AbstractAlphabet& operator=(const AbstractAlphabet& alph)
     {
+      Alphabet::operator=(alph);
       for (size_t i = 0 ; i < alphabet_.size() ; ++i)
         delete alphabet_[i];
 
@@ -122,6 +129,7 @@ namespace bpp
       nums_     = alph.nums_;
       charList_ = alph.charList_;
       intList_  = alph.intList_;
+      capabilities_ = alph.capabilities_;
 
       return *this;
     }
@@ -158,6 +166,7 @@ namespace bpp
     int getGapCharacterCode() const { return -1; }
     bool isGap(int state) const { return state == -1; }
     bool isGap(const std::string& state) const { return charToInt(state) == -1; }
+    unsigned int getCapabilities() const { return capabilities_; }
     /** @} */
 
     /**
@@ -262,11 +271,22 @@ namespace bpp
       }
     }
 
+    /**
+     * @brief Add capability flags to the alphabet.
+     *
+     * Each constructor adds the flags corresponding to its own class,
+     * so that derived alphabets inherit the capabilities of their parents.
+     *
+     * @param capabilities A combination of CAP_* flags.
+     */
+    void addCapabilities(unsigned int capabilities) { capabilities_ |= capabilities; }
+
     unsigned int getStateCodingSize() const { return 1; }
 
     bool equals(const Alphabet& alphabet) const {
-      return getAlphabetType() == alphabet.getAlphabetType();
+      return getAlphabetTypeId() == alphabet.getAlphabetTypeId();
     }
+
   };
 
 } //end of namespace bpp.
@@ -43,6 +43,7 @@ knowledge of the CeCILL license and that you accept its terms.
 
 #include <string>
 #include <vector>
+#include <atomic>
 
 #include "AlphabetExceptions.h"
 #include "AlphabetState.h"
@@ -130,8 +131,49 @@ namespace bpp
   class Alphabet:
     public virtual Clonable
 {
+  private:
+    /**
+     * @brief Type identifier, computed once (see getAlphabetTypeId()), 0 if not yet known.
+     *
+     * Alphabets are shared between threads: the identifier is atomic, so that concurrent
+     * first calls to getAlphabetTypeId() safely store the same value.
+     */
+    mutable std::atomic<unsigned int> typeId_;
+
+  public:
+    /**
+     * @name Capability flags
+     *
+     * These flags are combined in the value returned by getCapabilities().
+     * They are set once when the alphabet is built, and allow to test the kind of
+     * an alphabet without run-time type information.
+     *
+     * @{
+     */
+    static const unsigned int CAP_LETTER      = 1u << 0;
+    static const unsigned int CAP_NUCLEIC     = 1u << 1;
+    static const unsigned int CAP_DNA         = 1u << 2;
+    static const unsigned int CAP_RNA         = 1u << 3;
+    static const unsigned int CAP_PROTEIC     = 1u << 4;
+    static const unsigned int CAP_WORD        = 1u << 5;
+    static const unsigned int CAP_CODON       = 1u << 6;
+    static const unsigned int CAP_CASE_MASKED = 1u << 7;
+    static const unsigned int CAP_RNY         = 1u << 8;
+    static const unsigned int CAP_BINARY      = 1u << 9;
+    static const unsigned int CAP_DEFAULT     = 1u << 10;
+    static const unsigned int CAP_INTEGER     = 1u << 11;
+    static const unsigned int CAP_NUMERIC     = 1u << 12;
+    static const unsigned int CAP_LEXICAL     = 1u << 13;
+    /** @} */
+
   public:
-    Alphabet() {}
+    Alphabet(): typeId_(0) {}
+    Alphabet(const Alphabet& alpha): typeId_(alpha.typeId_.load()) {}
+    Alphabet& operator=(const Alphabet& alpha)
+    {
+      typeId_.store(alpha.typeId_.load());
+      return *this;
+    }
     virtual ~Alphabet() {}
 
   /**
@@ -457,6 +499,66 @@ namespace bpp
      * @return true If the two instances are of the same class.
      */
     virtual bool equals(const Alphabet& alphabet) const = 0;
+
+    /**
+     * @name Type tags
+     *
+     * @{
+     */
+
+    /**
+     * @brief Integer identification method.
+     *
+     * Two alphabets share the same identifier if and only if they have the same
+     * type description (see getAlphabetType()), so that comparing two alphabets
+     * is a simple integer comparison.
+     * The identifier is set by registerAlphabetType(), or computed at the first call
+     * for alphabets which do not call it.
+     *
+     * @return An integer identifying the type of the alphabet.
+     */
+    virtual unsigned int getAlphabetTypeId() const
+    {
+      unsigned int id = typeId_.load(std::memory_order_relaxed);
+      if (id == 0)
+      {
+        id = getTypeId_(getAlphabetType());
+        typeId_.store(id, std::memory_order_relaxed);
+      }
+      return id;
+    }
+
+    /**
+     * @return The capability flags of the alphabet, as a combination of the CAP_* constants.
+     * The default implementation returns no flag.
+     */
+    virtual unsigned int getCapabilities() const { return 0; }
+
+    /**
+     * @param capabilities A combination of CAP_* flags.
+     * @return True if the alphabet has all the given capabilities.
+     */
+    bool hasCapabilities(unsigned int capabilities) const
+    {
+      return (getCapabilities() & capabilities) == capabilities;
+    }
+    /** @} */
+
+  protected:
+    /**
+     * @brief Compute the type identifier of the alphabet from its type description.
+     *
+     * This method should be called by the constructor of each concrete alphabet,
+     * once getAlphabetType() returns its final value. Alphabets which do not call it
+     * are registered the first time getAlphabetTypeId() is called.
+     */
+    void registerAlphabetType() { typeId_.store(getTypeId_(getAlphabetType())); }
+
+    /**
+     * @return A unique identifier for a given type description, starting at 1.
+     * @param type The type description of an alphabet.
+     */
+    static unsigned int getTypeId_(const std::string& type);
 };
 
 } //end of namespace bpp.
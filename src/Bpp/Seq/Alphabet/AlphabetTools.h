@@ -139,55 +139,72 @@ public:
    * @return True if the alphabet is an instanciation of the NucleicAlphabet class.
    * @param alphabet The alphabet to check.
    */
-  static bool isNucleicAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<NucleicAlphabet>(alphabet); }
+  static bool isNucleicAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_NUCLEIC); }
 
   /**
    * @return True if the alphabet is an instanciation of the DNA class.
    * @param alphabet The alphabet to check.
    */
-  static bool isDNAAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<DNA>(alphabet); }
+  static bool isDNAAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_DNA); }
 
   /**
    * @return True if the alphabet is an instanciation of the RNA class.
    * @param alphabet The alphabet to check.
    */
-  static bool isRNAAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<RNA>(alphabet); }
+  static bool isRNAAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_RNA); }
 
   /**
    * @return True if the alphabet is an instanciation of the ProteicAlphabet class.
    * @param alphabet The alphabet to check.
    */
-  static bool isProteicAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<ProteicAlphabet>(alphabet); }
+  static bool isProteicAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_PROTEIC); }
 
   /**
    * @return True if the alphabet is an instanciation of the Codon class.
    * @param alphabet The alphabet to check.
    */
-  static bool isCodonAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<CodonAlphabet>(alphabet); }
+  static bool isCodonAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_CODON); }
 
   /**
    * @return True if the alphabet is an instanciation of the WordAlphabet class.
    * @param alphabet The alphabet to check.
    */
-  static bool isWordAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<CoreWordAlphabet>(alphabet); }
+  static bool isWordAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_WORD); }
 
   /**
    * @return True if the alphabet is an instanciation of the RNY class.
    * @param alphabet The alphabet to check.
    */
-  static bool isRNYAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<RNY>(alphabet); }
+  static bool isRNYAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_RNY); }
 
   /**
    * @return True if the alphabet is an instanciation of the BinaryAlphabet class.
    * @param alphabet The alphabet to check.
    */
-  static bool isBinaryAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<BinaryAlphabet>(alphabet); }
+  static bool isBinaryAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_BINARY); }
 
   /**
    * @return True if the alphabet is an instanciation of the DefaultAlphabet class.
    * @param alphabet The alphabet to check.
    */
-  static bool isDefaultAlphabet(const Alphabet* alphabet) { return alphabetInheritsFrom<DefaultAlphabet>(alphabet); }
+  static bool isDefaultAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_DEFAULT); }
+
+  /**
+   * @return True if the alphabet is an instanciation of the CaseMaskedAlphabet class.
+   * @param alphabet The alphabet to check.
+   */
+  static bool isCaseMaskedAlphabet(const Alphabet* alphabet) { return alphabet->hasCapabilities(Alphabet::CAP_CASE_MASKED); }
+
+  /**
+   * @return True if the two alphabets describe the same type of sequences.
+   * This is equivalent to comparing their type descriptions, but only compares integers.
+   * @param alphabet1 The first alphabet to compare.
+   * @param alphabet2 The second alphabet to compare.
+   */
+  static bool haveSameType(const Alphabet* alphabet1, const Alphabet* alphabet2)
+  {
+    return alphabet1->getAlphabetTypeId() == alphabet2->getAlphabetTypeId();
+  }
 
   /**
    * @brief Tell if two characters match according to a given alphabet.
@@ -214,21 +231,6 @@ public:
     std::vector<int> u = VectorTools::vectorIntersection(a, b);
     return u.size() > 0;
   }
-
-private:
-  template<class Y>
-  static bool alphabetInheritsFrom(const Alphabet* alphabet)
-  {
-    try
-    {
-      const Y* t = dynamic_cast<const Y*>(alphabet);
-      return t != nullptr;
-    }
-    catch (std::exception& e)
-    {
-      return false;
-    }
-  }
 };
 
 } // end of namespace bpp.
@@ -56,6 +56,10 @@ BinaryAlphabet::BinaryAlphabet()
   {
     registerState(new AlphabetState(i, TextTools::toString(i), ""));
   }
+
+  // Type tags:
+  addCapabilities(CAP_BINARY);
+  registerAlphabetType();
 }
 
 /******************************************************************************/
@@ -63,6 +63,10 @@ CaseMaskedAlphabet::CaseMaskedAlphabet(const LetterAlphabet* nocaseAlphabet) :
       }
     }
   }
+
+  // Type tags:
+  addCapabilities(CAP_CASE_MASKED);
+  registerAlphabetType();
 }
 
 int CaseMaskedAlphabet::getMaskedEquivalentState(int state) const
@@ -92,4 +96,10 @@ const string CaseMaskedAlphabet::getMaskedEquivalentState(const string& state) c
   }
 }
 
+int CaseMaskedAlphabet::getUnmaskedEquivalentState(int state) const
+{
+  if (!isIntInAlphabet(state))
+    throw BadIntException(state, "CaseMaskedAlphabet::getUnmaskedEquivalentState. Unsupported state code.");
+  return state >= 100 ? state - 100 : state;
+}
 
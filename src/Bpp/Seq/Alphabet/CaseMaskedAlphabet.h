@@ -116,6 +116,15 @@ namespace bpp
      */
     const std::string getMaskedEquivalentState(const std::string& state) const;
 
+    /**
+     * @brief Get the unmasked state equivalent to the input one.
+     *
+     * If the input state is not masked, returns it "as is".
+     * @param state The input state.
+     * @throw BadIntException if the input state is not supported.
+     */
+    int getUnmaskedEquivalentState(int state) const;
+
   };
 
 } // end of namespace bpp
@@ -79,6 +79,8 @@ namespace bpp
       nAlph_(alpha)
     {
       build_();  
+      addCapabilities(CAP_WORD | CAP_CODON);
+      registerAlphabetType();
     }
 
     CodonAlphabet(const CodonAlphabet& bia) :
@@ -82,6 +82,10 @@ DNA::DNA(bool exclamationMarkCountsAsGap)
     registerState(new NucleicAlphabetState(-1, "!", 0, "Frameshift"));
   else
     registerState(new NucleicAlphabetState(14, "!", 15, "Unresolved base"));
+
+  // Type tags:
+  addCapabilities(CAP_DNA);
+  registerAlphabetType();
 }
 
 /******************************************************************************/
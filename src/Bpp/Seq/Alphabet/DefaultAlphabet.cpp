@@ -55,5 +55,9 @@ DefaultAlphabet::DefaultAlphabet():
   {
     registerState(new AlphabetState(static_cast<int>(i), TextTools::toString(chars_[i]), ""));
   }
+
+  // Type tags:
+  addCapabilities(CAP_DEFAULT);
+  registerAlphabetType();
 }
 
@@ -58,5 +58,9 @@ IntegerAlphabet::IntegerAlphabet(unsigned int max) : MAX_(max)
   {
     registerState(new AlphabetState(i, TextTools::toString(i), ""));
   }
+
+  // Type tags:
+  addCapabilities(CAP_INTEGER);
+  registerAlphabetType();
 }
 
@@ -63,7 +63,10 @@ namespace bpp {
     bool caseSensitive_;
 
   public:
-    LetterAlphabet(bool caseSensitive = false): letters_(256, LETTER_UNDEF_VALUE), caseSensitive_(caseSensitive) {}
+    LetterAlphabet(bool caseSensitive = false): letters_(256, LETTER_UNDEF_VALUE), caseSensitive_(caseSensitive)
+    {
+      addCapabilities(CAP_LETTER);
+    }
 
     LetterAlphabet(const LetterAlphabet& bia) : AbstractAlphabet(bia), letters_(bia.letters_), caseSensitive_(bia.caseSensitive_) {}
 
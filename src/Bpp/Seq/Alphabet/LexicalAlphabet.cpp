@@ -85,6 +85,10 @@ LexicalAlphabet::LexicalAlphabet(const vector<std::string>& vocab) :
     s+="?";
   
   registerState(new AlphabetState(static_cast<int>(vocab.size()), s, "Unresolved word"));
+
+  // Type tags:
+  addCapabilities(CAP_LEXICAL);
+  registerAlphabetType();
 }
 
 
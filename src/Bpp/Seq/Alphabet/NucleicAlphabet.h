@@ -69,7 +69,10 @@ namespace bpp
     }
 
   public:
-    NucleicAlphabet(): LetterAlphabet(), binCodes_() {}
+    NucleicAlphabet(): LetterAlphabet(), binCodes_()
+    {
+      addCapabilities(CAP_NUCLEIC);
+    }
 
     NucleicAlphabet(const NucleicAlphabet& bia) : LetterAlphabet(bia), binCodes_(bia.binCodes_) {}
 
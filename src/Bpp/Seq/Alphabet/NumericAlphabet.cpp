@@ -61,6 +61,10 @@ NumericAlphabet::NumericAlphabet(const UniformDiscreteDistribution& pd) :
   for (size_t i = 0; i < size; ++i){
     registerState(new AlphabetNumericState(static_cast<int>(i), vd[i], TextTools::toString(vd[i]), TextTools::toString(vd[i])));
   }
+
+  // Type tags:
+  addCapabilities(CAP_NUMERIC);
+  registerAlphabetType();
 }
 
 NumericAlphabet::NumericAlphabet(const NumericAlphabet& na) :
@@ -83,6 +83,10 @@ ProteicAlphabet::ProteicAlphabet()
   registerState(new ProteicAlphabetState(22, "0", "0", "Unresolved amino acid"));
   registerState(new ProteicAlphabetState(22, "?", "?", "Unresolved amino acid"));
   registerState(new ProteicAlphabetState(-2, "*", "STOP", "Stop"));
+
+  // Type tags:
+  addCapabilities(CAP_PROTEIC);
+  registerAlphabetType();
 }
 
 /******************************************************************************/
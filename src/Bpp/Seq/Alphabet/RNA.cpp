@@ -80,6 +80,10 @@ RNA::RNA(bool exclamationMarkCountsAsGap)
     registerState(new NucleicAlphabetState(-1, "!", 0, "Frameshift"));
   else
     registerState(new NucleicAlphabetState(14, "!", 15, "Unresolved base"));
+
+  // Type tags:
+  addCapabilities(CAP_RNA);
+  registerAlphabetType();
 }
 
 /******************************************************************************/
@@ -182,6 +182,10 @@ RNY::RNY(const NucleicAlphabet& na) : nuclalph_(na)
   // Register all states:
   for (size_t i = 0; i < states.size(); ++i)
     registerState(states[i]);
+
+  // Type tags:
+  addCapabilities(CAP_RNY);
+  registerAlphabetType();
 }
 
 /****************************************************************************************/
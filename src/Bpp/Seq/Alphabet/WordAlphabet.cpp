@@ -53,6 +53,10 @@ WordAlphabet::WordAlphabet(const vector<const Alphabet*>& vAlpha) :
   vAbsAlph_(vAlpha)
 {
   build_();
+
+  // Type tags:
+  addCapabilities(CAP_WORD);
+  registerAlphabetType();
 }
 
 WordAlphabet::WordAlphabet(const Alphabet* pAlpha, size_t num) :
@@ -65,6 +69,10 @@ WordAlphabet::WordAlphabet(const Alphabet* pAlpha, size_t num) :
   }
 
   build_();
+
+  // Type tags:
+  addCapabilities(CAP_WORD);
+  registerAlphabetType();
 }
 
 void WordAlphabet::build_()
@@ -148,10 +156,10 @@ std::string WordAlphabet::getAlphabetType() const
 
 bool WordAlphabet::hasUniqueAlphabet() const
 {
-  string s = vAbsAlph_[0]->getAlphabetType();
+  unsigned int id = vAbsAlph_[0]->getAlphabetTypeId();
   for (unsigned int i = 1; i < vAbsAlph_.size(); i++)
   {
-    if (vAbsAlph_[i]->getAlphabetType() != s)
+    if (vAbsAlph_[i]->getAlphabetTypeId() != id)
       return false;
   }
   return true;
@@ -329,7 +337,7 @@ std::string WordAlphabet::getWord(const std::vector<string>& vpos, size_t pos) c
 Sequence* WordAlphabet::translate(const Sequence& sequence, size_t pos) const
 {
   if ((!hasUniqueAlphabet()) or
-      (sequence.getAlphabet()->getAlphabetType() != vAbsAlph_[0]->getAlphabetType()))
+      (sequence.getAlphabet()->getAlphabetTypeId() != vAbsAlph_[0]->getAlphabetTypeId()))
     throw AlphabetMismatchException("No matching alphabets", sequence.getAlphabet(), vAbsAlph_[0]);
 
   vector<int> content;
@@ -352,7 +360,7 @@ Sequence* WordAlphabet::translate(const Sequence& sequence, size_t pos) const
 Sequence* WordAlphabet::reverse(const Sequence& sequence) const
 {
   if ((!hasUniqueAlphabet()) or
-      (sequence.getAlphabet()->getAlphabetType() != getAlphabetType()))
+      (sequence.getAlphabet()->getAlphabetTypeId() != getAlphabetTypeId()))
     throw AlphabetMismatchException("No matching alphabets");
 
   Sequence* pseq = new BasicSequence(sequence.getName(), "", getNAlphabet(0));
@@ -49,6 +49,8 @@
 
 namespace bpp
 {
+class CompiledAlphabetIndex2;
+
 /**
  * @brief Two dimensionnal alphabet index interface.
  *
@@ -97,6 +99,17 @@ public:
    * @return True if the index is symatric (that is, index(i,j) == index(j, i)).
    */
   virtual bool isSymmetric() const = 0;
+
+  /**
+   * @brief Build a flat score table from this index.
+   *
+   * @param gapScore     The score of pairs involving a gap.
+   * @param unknownScore The score of pairs involving an unknown state.
+   * @param scale        The factor scores are multiplied with before being rounded to int16.
+   * @return A new compiled table.
+   * @see CompiledAlphabetIndex2
+   */
+  virtual CompiledAlphabetIndex2* compile(double gapScore = 0., double unknownScore = 0., double scale = 1.) const;
 };
 } // end of namespace bpp.
 
@@ -0,0 +1,119 @@
+//
+// File: CompiledAlphabetIndex2.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+
+/*
+   Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+   This software is a computer program whose purpose is to provide classes
+   for sequences analysis.
+
+   This software is governed by the CeCILL  license under French law and
+   abiding by the rules of distribution of free software.  You can  use,
+   modify and/ or redistribute the software under the terms of the CeCILL
+   license as circulated by CEA, CNRS and INRIA at the following URL
+   "http://www.cecill.info".
+
+   As a counterpart to the access to the source code and  rights to copy,
+   modify and redistribute granted by the license, users are provided only
+   with a limited warranty  and the software's author,  the holder of the
+   economic rights,  and the successive licensors  have only  limited
+   liability.
+
+   In this respect, the user's attention is drawn to the risks associated
+   with loading,  using,  modifying and/or developing or reproducing the
+   software by the user in light of its specific status of free software,
+   that may mean  that it is complicated to manipulate,  and  that  also
+   therefore means  that it is reserved for developers  and  experienced
+   professionals having in-depth computer knowledge. Users are therefore
+   encouraged to load and test the software's suitability as regards their
+   requirements in conditions enabling the security of their systems and/or
+   data to be ensured and,  more generally, to use and operate it in the
+   same conditions as regards security.
+
+   The fact that you are presently reading this means that you have had
+   knowledge of the CeCILL license and that you accept its terms.
+ */
+
+#include "CompiledAlphabetIndex2.h"
+
+#include <Bpp/Exceptions.h>
+
+// From the STL:
+#include <cmath>
+
+using namespace std;
+
+using namespace bpp;
+
+const size_t CompiledAlphabetIndex2::PADDING = 16;
+
+/******************************************************************************/
+
+CompiledAlphabetIndex2::CompiledAlphabetIndex2(const AlphabetIndex2& index, double gapScore, double unknownScore, double scale) :
+  alphabet_(index.getAlphabet()),
+  numberOfStates_(0),
+  stride_(0),
+  scale_(scale),
+  scores_(),
+  floatScores_(),
+  intScores_(),
+  defined_()
+{
+  const vector<int>& states = alphabet_->getSupportedInts();
+  for (size_t i = 0; i < states.size(); ++i)
+  {
+    if (states[i] >= 0 && static_cast<size_t>(states[i]) + 1 > numberOfStates_)
+      numberOfStates_ = static_cast<size_t>(states[i]) + 1;
+  }
+  size_t n = numberOfStates_ + 2;
+  stride_ = ((n + PADDING - 1) / PADDING) * PADDING;
+  scores_.resize(n * stride_, 0.);
+  defined_.resize(n * stride_, false);
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (size_t j = 0; j < n; ++j)
+    {
+      double& score = scores_[i * stride_ + j];
+      if (i == getGapRow() || j == getGapRow())
+        score = gapScore;
+      else if (i == getUnknownRow() || j == getUnknownRow())
+        score = unknownScore;
+      else
+      {
+        try
+        {
+          score = index.getIndex(static_cast<int>(i), static_cast<int>(j));
+          defined_[i * stride_ + j] = true;
+        }
+        catch (Exception&)
+        {
+          score = unknownScore;
+        }
+      }
+    }
+  }
+  floatScores_.resize(scores_.size());
+  intScores_.resize(scores_.size());
+  for (size_t i = 0; i < scores_.size(); ++i)
+  {
+    floatScores_[i] = static_cast<float>(scores_[i]);
+    double x = round(scores_[i] * scale_);
+    if (x > 32767.) x = 32767.;
+    if (x < -32768.) x = -32768.;
+    intScores_[i] = static_cast<int16_t>(x);
+  }
+}
+
+/******************************************************************************/
+
+CompiledAlphabetIndex2* AlphabetIndex2::compile(double gapScore, double unknownScore, double scale) const
+{
+  return new CompiledAlphabetIndex2(*this, gapScore, unknownScore, scale);
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,179 @@
+//
+// File: CompiledAlphabetIndex2.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+   Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+   This software is a computer program whose purpose is to provide classes
+   for sequences analysis.
+
+   This software is governed by the CeCILL  license under French law and
+   abiding by the rules of distribution of free software.  You can  use,
+   modify and/ or redistribute the software under the terms of the CeCILL
+   license as circulated by CEA, CNRS and INRIA at the following URL
+   "http://www.cecill.info".
+
+   As a counterpart to the access to the source code and  rights to copy,
+   modify and redistribute granted by the license, users are provided only
+   with a limited warranty  and the software's author,  the holder of the
+   economic rights,  and the successive licensors  have only  limited
+   liability.
+
+   In this respect, the user's attention is drawn to the risks associated
+   with loading,  using,  modifying and/or developing or reproducing the
+   software by the user in light of its specific status of free software,
+   that may mean  that it is complicated to manipulate,  and  that  also
+   therefore means  that it is reserved for developers  and  experienced
+   professionals having in-depth computer knowledge. Users are therefore
+   encouraged to load and test the software's suitability as regards their
+   requirements in conditions enabling the security of their systems and/or
+   data to be ensured and,  more generally, to use and operate it in the
+   same conditions as regards security.
+
+   The fact that you are presently reading this means that you have had
+   knowledge of the CeCILL license and that you accept its terms.
+ */
+
+#ifndef _COMPILEDALPHABETINDEX2_H_
+#define _COMPILEDALPHABETINDEX2_H_
+
+#include "AlphabetIndex2.h"
+
+// From the STL:
+#include <vector>
+#include <cstdint>
+
+namespace bpp
+{
+/**
+ * @brief Flat score table built from an AlphabetIndex2.
+ *
+ * All scores are computed once with AlphabetIndex2::getIndex and stored in row-major
+ * tables of double, float and (scaled) int16 values, so that score lookups need
+ * neither virtual calls nor bound checks.
+ *
+ * Rows (and columns) are:
+ * - one row for each non-negative state up to the largest state supported by the alphabet,
+ * - one row for gaps (and any negative state),
+ * - one row for any other state (unknown row).
+ * Pairs for which getIndex throws an exception are given the unknown score.
+ * Rows are padded to a multiple of CompiledAlphabetIndex2::PADDING entries.
+ *
+ * @see AlphabetIndex2::compile, ScoreQueryProfile
+ */
+class CompiledAlphabetIndex2
+{
+private:
+  const Alphabet* alphabet_;
+  size_t numberOfStates_;
+  size_t stride_;
+  double scale_;
+  std::vector<double> scores_;
+  std::vector<float> floatScores_;
+  std::vector<int16_t> intScores_;
+  std::vector<bool> defined_;
+
+public:
+  /**
+   * @brief Number of entries rows are padded to.
+   */
+  static const size_t PADDING;
+
+public:
+  /**
+   * @param index        The index to compile.
+   * @param gapScore     The score of pairs involving a gap.
+   * @param unknownScore The score of pairs involving an unknown state.
+   * @param scale        The factor scores are multiplied with before being rounded to int16 (saturated).
+   */
+  CompiledAlphabetIndex2(const AlphabetIndex2& index, double gapScore = 0., double unknownScore = 0., double scale = 1.);
+
+  CompiledAlphabetIndex2(const CompiledAlphabetIndex2& cai):
+    alphabet_(cai.alphabet_), numberOfStates_(cai.numberOfStates_), stride_(cai.stride_), scale_(cai.scale_),
+    scores_(cai.scores_), floatScores_(cai.floatScores_), intScores_(cai.intScores_), defined_(cai.defined_) {}
+
+  CompiledAlphabetIndex2& operator=(const CompiledAlphabetIndex2& cai)
+  {
+    alphabet_       = cai.alphabet_;
+    numberOfStates_ = cai.numberOfStates_;
+    stride_         = cai.stride_;
+    scale_          = cai.scale_;
+    scores_         = cai.scores_;
+    floatScores_    = cai.floatScores_;
+    intScores_      = cai.intScores_;
+    defined_        = cai.defined_;
+    return *this;
+  }
+
+  virtual ~CompiledAlphabetIndex2() {}
+
+public:
+  const Alphabet* getAlphabet() const { return alphabet_; }
+
+  /**
+   * @return The number of rows in the table, including gap and unknown rows.
+   */
+  size_t getNumberOfRows() const { return numberOfStates_ + 2; }
+
+  /**
+   * @return The distance between two consecutive rows.
+   */
+  size_t getStride() const { return stride_; }
+
+  double getScale() const { return scale_; }
+
+  /**
+   * @return The row of a state in the table.
+   */
+  size_t getRow(int state) const
+  {
+    if (state < 0) return numberOfStates_;
+    size_t s = static_cast<size_t>(state);
+    return s < numberOfStates_ ? s : numberOfStates_ + 1;
+  }
+
+  size_t getGapRow() const { return numberOfStates_; }
+  size_t getUnknownRow() const { return numberOfStates_ + 1; }
+
+  double getScore(int state1, int state2) const
+  {
+    return scores_[getRow(state1) * stride_ + getRow(state2)];
+  }
+
+  /**
+   * @name Access by row and column indices.
+   *
+   * @{
+   */
+  double getScoreAt(size_t row, size_t col) const { return scores_[row * stride_ + col]; }
+  float getFloatScoreAt(size_t row, size_t col) const { return floatScores_[row * stride_ + col]; }
+  int16_t getIntScoreAt(size_t row, size_t col) const { return intScores_[row * stride_ + col]; }
+  /** @} */
+
+  /**
+   * @return true if the score of the pair was given by the original index.
+   */
+  bool isDefined(int state1, int state2) const
+  {
+    return defined_[getRow(state1) * stride_ + getRow(state2)];
+  }
+
+  /**
+   * @name Row access.
+   *
+   * Entry j of the row of state1 is the score of the pair (state1, state in row j).
+   *
+   * @{
+   */
+  const double* getScores(int state) const { return &scores_[getRow(state) * stride_]; }
+  const float* getFloatScores(int state) const { return &floatScores_[getRow(state) * stride_]; }
+  const int16_t* getIntScores(int state) const { return &intScores_[getRow(state) * stride_]; }
+  /** @} */
+};
+} // end of namespace bpp.
+
+#endif // _COMPILEDALPHABETINDEX2_H_
+
@@ -0,0 +1,108 @@
+//
+// File: ScoreQueryProfile.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+
+/*
+   Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+   This software is a computer program whose purpose is to provide classes
+   for sequences analysis.
+
+   This software is governed by the CeCILL  license under French law and
+   abiding by the rules of distribution of free software.  You can  use,
+   modify and/ or redistribute the software under the terms of the CeCILL
+   license as circulated by CEA, CNRS and INRIA at the following URL
+   "http://www.cecill.info".
+
+   As a counterpart to the access to the source code and  rights to copy,
+   modify and redistribute granted by the license, users are provided only
+   with a limited warranty  and the software's author,  the holder of the
+   economic rights,  and the successive licensors  have only  limited
+   liability.
+
+   In this respect, the user's attention is drawn to the risks associated
+   with loading,  using,  modifying and/or developing or reproducing the
+   software by the user in light of its specific status of free software,
+   that may mean  that it is complicated to manipulate,  and  that  also
+   therefore means  that it is reserved for developers  and  experienced
+   professionals having in-depth computer knowledge. Users are therefore
+   encouraged to load and test the software's suitability as regards their
+   requirements in conditions enabling the security of their systems and/or
+   data to be ensured and,  more generally, to use and operate it in the
+   same conditions as regards security.
+
+   The fact that you are presently reading this means that you have had
+   knowledge of the CeCILL license and that you accept its terms.
+ */
+
+#include "ScoreQueryProfile.h"
+#include "../Alphabet/AlphabetExceptions.h"
+
+#include <Bpp/Numeric/VectorExceptions.h>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+ScoreQueryProfile::ScoreQueryProfile(const CompiledAlphabetIndex2& table, const SymbolList& query) :
+  table_(table),
+  length_(query.size()),
+  stride_(((query.size() + CompiledAlphabetIndex2::PADDING - 1) / CompiledAlphabetIndex2::PADDING) * CompiledAlphabetIndex2::PADDING),
+  profile_(),
+  floatProfile_(),
+  intProfile_()
+{
+  if (query.getAlphabet()->getAlphabetTypeId() != table.getAlphabet()->getAlphabetTypeId())
+    throw AlphabetMismatchException("ScoreQueryProfile (constructor).", query.getAlphabet(), table.getAlphabet());
+  size_t n = table_.getNumberOfRows();
+  profile_.resize(n * stride_, 0.);
+  floatProfile_.resize(n * stride_, 0.f);
+  intProfile_.resize(n * stride_, 0);
+  for (size_t i = 0; i < length_; ++i)
+  {
+    // Column of the query state in the table:
+    size_t col = table_.getRow(query[i]);
+    for (size_t r = 0; r < n; ++r)
+    {
+      profile_[r * stride_ + i] = table_.getScoreAt(r, col);
+      floatProfile_[r * stride_ + i] = table_.getFloatScoreAt(r, col);
+      intProfile_[r * stride_ + i] = table_.getIntScoreAt(r, col);
+    }
+  }
+}
+
+/******************************************************************************/
+
+double ScoreQueryProfile::getSegmentScore(const SymbolList& subject, size_t queryStart, size_t subjectStart, size_t length) const
+{
+  if (queryStart + length > length_)
+    throw IndexOutOfBoundsException("ScoreQueryProfile::getSegmentScore. Query segment out of range.", queryStart + length, 0, length_);
+  if (subjectStart + length > subject.size())
+    throw IndexOutOfBoundsException("ScoreQueryProfile::getSegmentScore. Subject segment out of range.", subjectStart + length, 0, subject.size());
+  double score = 0.;
+  for (size_t i = 0; i < length; ++i)
+    score += getScores(subject[subjectStart + i])[queryStart + i];
+  return score;
+}
+
+/******************************************************************************/
+
+void ScoreQueryProfile::getScores(const OrderedSequenceContainer& subjects, vector<double>& scores) const
+{
+  scores.resize(subjects.getNumberOfSequences());
+  for (size_t s = 0; s < scores.size(); ++s)
+  {
+    const Sequence& subject = subjects.getSequence(s);
+    if (subject.size() != length_)
+      throw DimensionException("ScoreQueryProfile::getScores. Subject does not have the length of the query.", subject.size(), length_);
+    scores[s] = getSegmentScore(subject, 0, 0, length_);
+  }
+}
+
+/******************************************************************************/
+
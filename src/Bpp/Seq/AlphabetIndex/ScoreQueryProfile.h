@@ -0,0 +1,122 @@
+//
+// File: ScoreQueryProfile.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+   Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+   This software is a computer program whose purpose is to provide classes
+   for sequences analysis.
+
+   This software is governed by the CeCILL  license under French law and
+   abiding by the rules of distribution of free software.  You can  use,
+   modify and/ or redistribute the software under the terms of the CeCILL
+   license as circulated by CEA, CNRS and INRIA at the following URL
+   "http://www.cecill.info".
+
+   As a counterpart to the access to the source code and  rights to copy,
+   modify and redistribute granted by the license, users are provided only
+   with a limited warranty  and the software's author,  the holder of the
+   economic rights,  and the successive licensors  have only  limited
+   liability.
+
+   In this respect, the user's attention is drawn to the risks associated
+   with loading,  using,  modifying and/or developing or reproducing the
+   software by the user in light of its specific status of free software,
+   that may mean  that it is complicated to manipulate,  and  that  also
+   therefore means  that it is reserved for developers  and  experienced
+   professionals having in-depth computer knowledge. Users are therefore
+   encouraged to load and test the software's suitability as regards their
+   requirements in conditions enabling the security of their systems and/or
+   data to be ensured and,  more generally, to use and operate it in the
+   same conditions as regards security.
+
+   The fact that you are presently reading this means that you have had
+   knowledge of the CeCILL license and that you accept its terms.
+ */
+
+#ifndef _SCOREQUERYPROFILE_H_
+#define _SCOREQUERYPROFILE_H_
+
+#include "CompiledAlphabetIndex2.h"
+#include "../SymbolList.h"
+#include "../Container/OrderedSequenceContainer.h"
+
+// From the STL:
+#include <vector>
+
+namespace bpp
+{
+/**
+ * @brief Query profile for scoring many subjects against a fixed query.
+ *
+ * For each row of a compiled score table, the profile stores the scores of that state
+ * against all positions of the query, contiguously. Scoring a subject state against the
+ * query is then a linear walk along one profile row.
+ * Rows are padded to a multiple of CompiledAlphabetIndex2::PADDING entries.
+ */
+class ScoreQueryProfile
+{
+private:
+  CompiledAlphabetIndex2 table_;
+  size_t length_;
+  size_t stride_;
+  std::vector<double> profile_;
+  std::vector<float> floatProfile_;
+  std::vector<int16_t> intProfile_;
+
+public:
+  /**
+   * @param table The compiled score table.
+   * @param query The query sequence.
+   * @throw AlphabetMismatchException If the query and table alphabets do not match.
+   */
+  ScoreQueryProfile(const CompiledAlphabetIndex2& table, const SymbolList& query);
+
+  virtual ~ScoreQueryProfile() {}
+
+public:
+  size_t getQueryLength() const { return length_; }
+  size_t getStride() const { return stride_; }
+  const CompiledAlphabetIndex2& getTable() const { return table_; }
+
+  /**
+   * @name Profile rows.
+   *
+   * Entry i of the row of a state is the score of this state against position i of the query.
+   *
+   * @{
+   */
+  const double* getScores(int state) const { return &profile_[table_.getRow(state) * stride_]; }
+  const float* getFloatScores(int state) const { return &floatProfile_[table_.getRow(state) * stride_]; }
+  const int16_t* getIntScores(int state) const { return &intProfile_[table_.getRow(state) * stride_]; }
+  /** @} */
+
+  /**
+   * @brief Ungapped score of a segment of the query against a segment of a subject.
+   *
+   * @param subject      The subject sequence.
+   * @param queryStart   The first position in the query.
+   * @param subjectStart The first position in the subject.
+   * @param length       The length of the segments.
+   * @throw IndexOutOfBoundsException If one of the segments is out of range.
+   */
+  double getSegmentScore(const SymbolList& subject, size_t queryStart, size_t subjectStart, size_t length) const;
+
+  /**
+   * @brief Ungapped scores of the whole query against all subjects of a container.
+   *
+   * Subjects must have the same length as the query (e.g. sequences of an alignment).
+   *
+   * @param subjects The subject sequences.
+   * @param scores   The output vector, resized to the number of subjects.
+   * @throw DimensionException If a subject does not have the length of the query.
+   */
+  void getScores(const OrderedSequenceContainer& subjects, std::vector<double>& scores) const;
+};
+} // end of namespace bpp.
+
+#endif // _SCOREQUERYPROFILE_H_
+
@@ -65,6 +65,10 @@ double SimpleScore::getIndex(int state1, int state2) const
 {
   size_t stateIndex1 = alphabet_->getStateIndex(state1)-1;
   size_t stateIndex2 = alphabet_->getStateIndex(state2)-1;
+  if (stateIndex1 >= distanceMatrix_.getNumberOfRows())
+    throw BadIntException(state1, "SimpleScore::getIndex(). Invalid state1.", alphabet_);
+  if (stateIndex2 >= distanceMatrix_.getNumberOfRows())
+    throw BadIntException(state2, "SimpleScore::getIndex(). Invalid state2.", alphabet_);
   return distanceMatrix_(stateIndex1, stateIndex2);
 }
 
@@ -72,6 +76,10 @@ double SimpleScore::getIndex(const std::string& state1, const std::string& state
 {
   size_t stateIndex1 = alphabet_->getStateIndex(state1)-1;
   size_t stateIndex2 = alphabet_->getStateIndex(state2)-1;
+  if (stateIndex1 >= distanceMatrix_.getNumberOfRows())
+    throw BadCharException(state1, "SimpleScore::getIndex(). Invalid state1.", alphabet_);
+  if (stateIndex2 >= distanceMatrix_.getNumberOfRows())
+    throw BadCharException(state2, "SimpleScore::getIndex(). Invalid state2.", alphabet_);
   return distanceMatrix_(stateIndex1, stateIndex2);
 }
 
@@ -66,6 +66,17 @@
 #include <Bpp/App/NumCalcApplicationTools.h>
 #include <Bpp/Numeric/Random/RandomTools.h>
 
+// From the STL:
+#include <memory>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef _WIN32
+#include <glob.h>
+#endif
+
 using namespace bpp;
 using namespace std;
 
@@ -373,13 +384,24 @@ VectorSiteContainer* SequenceApplicationTools::getSiteContainer(
     ApplicationTools::displayResult("Sequence format " + suffix, iAln->getFormatName());
   }
 
+  VectorSiteContainer* sites = readSiteContainer_(alpha, *iAln, sequenceFilePath);
+  return selectSites_(sites, iAln->getFormatName() == "MASE file", params, args, suffix, suffixIsOptional, verbose, warn);
+}
+
+/******************************************************************************/
+
+VectorSiteContainer* SequenceApplicationTools::readSiteContainer_(
+  const Alphabet* alpha,
+  const IAlignment& iAln,
+  const string& sequenceFilePath)
+{
   const Alphabet* alpha2;
   if (AlphabetTools::isRNYAlphabet(alpha))
     alpha2 = &dynamic_cast<const RNY*>(alpha)->getLetterAlphabet();
   else
     alpha2 = alpha;
 
-  const SequenceContainer* seqCont = iAln->readAlignment(sequenceFilePath, alpha2);
+  const SequenceContainer* seqCont = iAln.readAlignment(sequenceFilePath, alpha2);
 
   VectorSiteContainer* sites2 = new VectorSiteContainer(*dynamic_cast<const OrderedSequenceContainer*>(seqCont));
 
@@ -400,8 +422,23 @@ VectorSiteContainer* SequenceApplicationTools::getSiteContainer(
   else
     sites = sites2;
 
+  return sites;
+}
+
+/******************************************************************************/
+
+VectorSiteContainer* SequenceApplicationTools::selectSites_(
+  VectorSiteContainer* sites,
+  bool maseFile,
+  map<string, string>& params,
+  map<string, string>& args,
+  const string& suffix,
+  bool suffixIsOptional,
+  bool verbose,
+  int warn)
+{
   // Look for site selection:
-  if (iAln->getFormatName() == "MASE file")
+  if (maseFile)
   {
     // getting site set:
     string siteSet = ApplicationTools::getStringParameter("siteSelection", args, "none", suffix, suffixIsOptional, warn + 1);
@@ -499,6 +536,181 @@ VectorSiteContainer* SequenceApplicationTools::getSiteContainer(
 
 /******************************************************************************/
 
+void SequenceApplicationTools::loadSiteContainers(
+  const Alphabet* alpha,
+  const vector<string>& paths,
+  map<string, string>& params,
+  SiteContainerHandler& handler,
+  const string& suffix,
+  bool suffixIsOptional,
+  bool verbose,
+  int warn)
+{
+  // Options are parsed once for all files:
+  string sequenceFormat = ApplicationTools::getStringParameter("input.sequence.format", params, "Fasta()", suffix, suffixIsOptional, warn);
+  BppOAlignmentReaderFormat bppoReader(warn);
+  unique_ptr<IAlignment> iAln(bppoReader.read(sequenceFormat));
+  map<string, string> args(bppoReader.getUnparsedArguments());
+  bool maseFile = (iAln->getFormatName() == "MASE file");
+  if (verbose)
+  {
+    ApplicationTools::displayResult("Sequence files " + suffix, TextTools::toString(paths.size()));
+    ApplicationTools::displayResult("Sequence format " + suffix, iAln->getFormatName());
+  }
+#ifdef _OPENMP
+  int nbThreads = ApplicationTools::getParameter<int>("input.sequence.threads", params, 0, suffix, suffixIsOptional, warn + 1);
+  if (nbThreads <= 0)
+    nbThreads = omp_get_max_threads();
+#endif
+
+  size_t n = paths.size();
+  string error;
+  bool failed = false;
+  // Parsing is done in parallel, but options are read, and the handler is called, in order.
+  // Parsing threads share the reader and the alphabet, which they only use through const
+  // methods (the alphabet type id, cached on first use, is atomic):
+#ifdef _OPENMP
+#pragma omp parallel for ordered schedule(dynamic, 1) num_threads(nbThreads)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    VectorSiteContainer* sites = 0;
+    bool ok = true;
+#ifdef _OPENMP
+#pragma omp critical(SequenceApplicationTools_error)
+#endif
+    ok = !failed;
+    if (ok)
+    {
+      try
+      {
+        sites = readSiteContainer_(alpha, *iAln, paths[i]);
+      }
+      catch (exception& e)
+      {
+#ifdef _OPENMP
+#pragma omp critical(SequenceApplicationTools_error)
+#endif
+        {
+          if (!failed)
+            error = paths[i] + ": " + e.what();
+          failed = true;
+        }
+      }
+    }
+#ifdef _OPENMP
+#pragma omp ordered
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp critical(SequenceApplicationTools_error)
+#endif
+      ok = !failed;
+      if (ok && sites)
+      {
+        try
+        {
+          sites = selectSites_(sites, maseFile, params, args, suffix, suffixIsOptional, false, warn);
+          VectorSiteContainer* sitesToAnalyse = getSitesToAnalyse(*sites, params, suffix, suffixIsOptional, true, false, warn);
+          delete sites;
+          sites = 0;
+          handler.handleSiteContainer(i, paths[i], sitesToAnalyse);
+        }
+        catch (exception& e)
+        {
+#ifdef _OPENMP
+#pragma omp critical(SequenceApplicationTools_error)
+#endif
+          {
+            if (!failed)
+              error = paths[i] + ": " + e.what();
+            failed = true;
+          }
+        }
+      }
+      delete sites;
+    }
+  }
+  if (failed)
+    throw Exception("SequenceApplicationTools::loadSiteContainers. " + error);
+}
+
+/******************************************************************************/
+
+namespace
+{
+  class SiteContainerCollector :
+    public SiteContainerHandler
+  {
+  private:
+    vector<VectorSiteContainer*>* containers_;
+
+  public:
+    SiteContainerCollector(vector<VectorSiteContainer*>& containers) : containers_(&containers) {}
+
+    SiteContainerCollector(const SiteContainerCollector& scc) : containers_(scc.containers_) {}
+
+    SiteContainerCollector& operator=(const SiteContainerCollector& scc)
+    {
+      containers_ = scc.containers_;
+      return *this;
+    }
+
+    void handleSiteContainer(size_t index, const string& path, VectorSiteContainer* sites)
+    {
+      (*containers_)[index] = sites;
+    }
+  };
+}
+
+vector<VectorSiteContainer*> SequenceApplicationTools::loadSiteContainers(
+  const Alphabet* alpha,
+  const vector<string>& paths,
+  map<string, string>& params,
+  const string& suffix,
+  bool suffixIsOptional,
+  bool verbose,
+  int warn)
+{
+  vector<VectorSiteContainer*> containers(paths.size(), 0);
+  SiteContainerCollector collector(containers);
+  try
+  {
+    loadSiteContainers(alpha, paths, params, collector, suffix, suffixIsOptional, verbose, warn);
+  }
+  catch (...)
+  {
+    for (size_t i = 0; i < containers.size(); ++i)
+      delete containers[i];
+    throw;
+  }
+  return containers;
+}
+
+/******************************************************************************/
+
+vector<string> SequenceApplicationTools::getMatchingFiles(const string& pattern)
+{
+  vector<string> paths;
+#ifdef _WIN32
+  throw Exception("SequenceApplicationTools::getMatchingFiles. File patterns are not supported on this platform.");
+#else
+  glob_t matches;
+  int status = glob(pattern.c_str(), 0, 0, &matches);
+  if (status == 0)
+  {
+    for (size_t i = 0; i < matches.gl_pathc; ++i)
+      paths.push_back(matches.gl_pathv[i]);
+  }
+  globfree(&matches);
+  if (status != 0 && status != GLOB_NOMATCH)
+    throw Exception("SequenceApplicationTools::getMatchingFiles. Could not expand pattern: " + pattern);
+#endif
+  return paths;
+}
+
+/******************************************************************************/
+
 VectorSiteContainer* SequenceApplicationTools::getSitesToAnalyse(
   const SiteContainer& allSites,
   map<string, string>& params,
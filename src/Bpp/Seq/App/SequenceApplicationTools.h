@@ -47,12 +47,32 @@
 #include "../AlphabetIndex/AlphabetIndex2.h"
 #include "../Container/SequenceContainer.h"
 #include "../Container/VectorSiteContainer.h"
+#include "../Io/ISequence.h"
 
 #include <map>
 #include <string>
+#include <vector>
 
 namespace bpp
 {
+/**
+ * @brief Receive the alignments loaded by SequenceApplicationTools::loadSiteContainers.
+ */
+  class SiteContainerHandler
+  {
+  public:
+    SiteContainerHandler() {}
+    virtual ~SiteContainerHandler() {}
+
+  public:
+    /**
+     * @param index The index of the file in the list of files.
+     * @param path  The path of the file.
+     * @param sites The filtered alignment, which is now owned by the handler.
+     */
+    virtual void handleSiteContainer(size_t index, const std::string& path, VectorSiteContainer* sites) = 0;
+  };
+
 /**
  * @brief This class provides some common tools for applications.
  *
@@ -212,6 +232,63 @@ namespace bpp
       bool verbose = true,
       int warn = 1);
 
+    /**
+     * @brief Load several alignment files, parsing them in parallel.
+     *
+     * All files share the same options, which are the ones of getSiteContainer and
+     * getSitesToAnalyse ('input.sequence.file' is not used). In addition:
+     * - input.sequence.threads = [int]
+     * The number of files parsed concurrently. The default (0) uses all the threads available to OpenMP.
+     * Files are parsed sequentially if the library was not compiled with OpenMP.
+     *
+     * Site selection and filtering are applied, and the handler is called, one file at a time
+     * and in the order of the list. As the next files are parsed in the mean time, only a few
+     * alignments are held in memory at once.
+     *
+     * @param alpha   The alphabet to use in the containers.
+     * @param paths   The files to read.
+     * @param params  The attribute map where options may be found.
+     * @param handler The object receiving the alignments.
+     * @param suffix  A suffix to be applied to each attribute name.
+     * @param suffixIsOptional Tell if the suffix is absolutely required.
+     * @param verbose Print some info to the 'message' output stream.
+     * @param warn Set the warning level (0: always display warnings, >0 display warnings on demand).
+     * @throw Exception If a file cannot be read. The first error is reported once all running parses are finished.
+     */
+    static void loadSiteContainers(
+      const Alphabet* alpha,
+      const std::vector<std::string>& paths,
+      std::map<std::string, std::string>& params,
+      SiteContainerHandler& handler,
+      const std::string& suffix = "",
+      bool suffixIsOptional = true,
+      bool verbose = true,
+      int warn = 1);
+
+    /**
+     * @brief Load several alignment files, parsing them in parallel, and collect them.
+     *
+     * @see loadSiteContainers(const Alphabet*, const std::vector<std::string>&, std::map<std::string, std::string>&, SiteContainerHandler&, const std::string&, bool, bool, int)
+     * @return The filtered alignments, in the order of the list of files.
+     */
+    static std::vector<VectorSiteContainer*> loadSiteContainers(
+      const Alphabet* alpha,
+      const std::vector<std::string>& paths,
+      std::map<std::string, std::string>& params,
+      const std::string& suffix = "",
+      bool suffixIsOptional = true,
+      bool verbose = true,
+      int warn = 1);
+
+    /**
+     * @brief Get the files matching a shell wildcard pattern (e.g. 'genes/gene_*.fasta').
+     *
+     * @param pattern The pattern to expand.
+     * @return The matching paths, in lexicographic order.
+     * @throw Exception If the pattern cannot be expanded on this platform.
+     */
+    static std::vector<std::string> getMatchingFiles(const std::string& pattern);
+
     /**
      * @brief Retrieves sites suitable for the analysis.
      *
@@ -290,6 +367,22 @@ namespace bpp
       const std::string& suffix = "",
       bool verbose = true,
       int warn = 1);
+
+  private:
+    static VectorSiteContainer* readSiteContainer_(
+      const Alphabet* alpha,
+      const IAlignment& iAln,
+      const std::string& sequenceFilePath);
+
+    static VectorSiteContainer* selectSites_(
+      VectorSiteContainer* sites,
+      bool maseFile,
+      std::map<std::string, std::string>& params,
+      std::map<std::string, std::string>& args,
+      const std::string& suffix,
+      bool suffixIsOptional,
+      bool verbose,
+      int warn);
   };
 } // end of namespace bpp.
 
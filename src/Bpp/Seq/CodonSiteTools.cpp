@@ -62,9 +62,10 @@ bool CodonSiteTools::hasGapOrStop(const Site& site, const GeneticCode& gCode)
   // Alphabet checking
   if (!AlphabetTools::isCodonAlphabet(site.getAlphabet()))
     throw AlphabetException("CodonSiteTools::hasGapOrStop: alphabet is not CodonAlphabet", site.getAlphabet());
+  SymbolListSpan states(site);
   for (size_t i = 0; i < site.size(); i++)
   {
-    if (site[i] < 0)
+    if (states[i] < 0)
       return true;
   }
   return false;
@@ -77,9 +78,10 @@ bool CodonSiteTools::hasStop(const Site& site, const GeneticCode& gCode)
   // Alphabet checking
   if (!AlphabetTools::isCodonAlphabet(site.getAlphabet()))
     throw AlphabetException("CodonSiteTools::hasStop: alphabet is not CodonAlphabet", site.getAlphabet());
+  SymbolListSpan states(site);
   for (size_t i = 0; i < site.size(); i++)
   {
-    if (gCode.isStop(site[i]))
+    if (gCode.isStop(states[i]))
       return true;
   }
   return false;
@@ -101,12 +103,13 @@ bool CodonSiteTools::isMonoSitePolymorphic(const Site& site)
     return false;
   // initialisation of the 3 sub-sites ot the codon
   vector<int> pos1, pos2, pos3;
-  const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(site.getAlphabet());
+  const CodonAlphabet* ca = static_cast<const CodonAlphabet*>(site.getAlphabet());
+  SymbolListSpan states(site);
   for (size_t i = 0; i < site.size(); i++)
   {
-    pos1.push_back(ca->getFirstPosition(site[i]));
-    pos2.push_back(ca->getSecondPosition(site[i]));
-    pos3.push_back(ca->getThirdPosition(site[i]));
+    pos1.push_back(ca->getFirstPosition(states[i]));
+    pos2.push_back(ca->getSecondPosition(states[i]));
+    pos3.push_back(ca->getThirdPosition(states[i]));
   }
   const NucleicAlphabet* na = ca->getNucleicAlphabet();
   Site s1(pos1, na), s2(pos2, na), s3(pos3, na);
@@ -142,10 +145,11 @@ bool CodonSiteTools::isSynonymousPolymorphic(const Site& site, const GeneticCode
 
   // Synonymous polymorphism checking
   vector<int> prot;
-  int first_aa = gCode.translate(site[0]);
+  SymbolListSpan states(site);
+  int first_aa = gCode.translate(states[0]);
   for (size_t i = 1; i < site.size(); i++)
   {
-    int aa = gCode.translate(site[i]);
+    int aa = gCode.translate(states[i]);
     if (aa != first_aa)
       return false;
   }
@@ -173,7 +177,7 @@ Site* CodonSiteTools::generateCodonSiteWithoutRareVariant(const Site& site, cons
     // Computation
     map<int, double> freqcodon;
     SiteTools::getFrequencies(site, freqcodon);
-    const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(site.getAlphabet());
+    const CodonAlphabet* ca = static_cast<const CodonAlphabet*>(site.getAlphabet());
     const NucleicAlphabet* na = ca->getNucleicAlphabet();
     int newcodon = -1;
     for (map<int, double>::iterator it = freqcodon.begin(); it != freqcodon.end(); it++)
@@ -185,11 +189,12 @@ Site* CodonSiteTools::generateCodonSiteWithoutRareVariant(const Site& site, cons
       }
     }
     vector<int> pos1, pos2, pos3;
+    SymbolListSpan states(site);
     for (size_t i = 0; i < site.size(); i++)
     {
-      pos1.push_back(ca->getFirstPosition(site[i]));
-      pos2.push_back(ca->getSecondPosition(site[i]));
-      pos3.push_back(ca->getThirdPosition(site[i]));
+      pos1.push_back(ca->getFirstPosition(states[i]));
+      pos2.push_back(ca->getSecondPosition(states[i]));
+      pos3.push_back(ca->getThirdPosition(states[i]));
     }
     Site s1(pos1, na), s2(pos2, na), s3(pos3, na);
     map<int, double> freq1;
@@ -203,7 +208,7 @@ Site* CodonSiteTools::generateCodonSiteWithoutRareVariant(const Site& site, cons
     {
       if (freq1[s1.getValue(i)] > freqmin && freq2[s2.getValue(i)] > freqmin && freq3[s3.getValue(i)] > freqmin)
       {
-        codon.push_back(site.getValue(i));
+        codon.push_back(states[i]);
       }
       else
         codon.push_back(newcodon);
@@ -231,7 +236,7 @@ size_t CodonSiteTools::numberOfDifferences(int i, int j, const CodonAlphabet& ca
 
 double CodonSiteTools::numberOfSynonymousDifferences(int i, int j, const GeneticCode& gCode, bool minchange)
 {
-  const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(gCode.getSourceAlphabet());
+  const CodonAlphabet* ca = gCode.getSourceAlphabet();
   
   vector<int> ci = ca->getPositions(i);
   vector<int> cj = ca->getPositions(j);
@@ -504,7 +509,7 @@ double CodonSiteTools::piNonSynonymous(const Site& site, const GeneticCode& gCod
   // Computation
   map<int, double> freq;
   SiteTools::getFrequencies(site, freq);
-  const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(site.getAlphabet());
+  const CodonAlphabet* ca = static_cast<const CodonAlphabet*>(site.getAlphabet());
   double pi = 0;
   for (map<int, double>::iterator it1 = freq.begin(); it1 != freq.end(); it1++)
   {
@@ -524,7 +529,7 @@ double CodonSiteTools::piNonSynonymous(const Site& site, const GeneticCode& gCod
 
 double CodonSiteTools::numberOfSynonymousPositions(int i, const GeneticCode& gCode, double ratio)
 {
-  const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(gCode.getSourceAlphabet());
+  const CodonAlphabet* ca = gCode.getSourceAlphabet();
   if (gCode.isStop(i))
     return 0;
   if (ca->isUnresolved(i))
@@ -608,7 +613,7 @@ size_t CodonSiteTools::numberOfSubstitutions(const Site& site, const GeneticCode
     return 0;
   vector<int> pos1, pos2, pos3;
 
-  const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(site.getAlphabet());
+  const CodonAlphabet* ca = static_cast<const CodonAlphabet*>(site.getAlphabet());
 
   for (size_t i = 0; i < newsite->size(); i++)
   {
@@ -657,7 +662,7 @@ size_t CodonSiteTools::numberOfNonSynonymousSubstitutions(const Site& site, cons
   size_t NaSup = 0;
   size_t Nminmin = 10;
 
-  const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(site.getAlphabet());
+  const CodonAlphabet* ca = static_cast<const CodonAlphabet*>(site.getAlphabet());
 
   for (map<int, size_t>::iterator it1 = count.begin(); it1 != count.end(); it1++)
   {
@@ -696,7 +701,7 @@ vector<size_t> CodonSiteTools::fixedDifferences(const Site& siteIn, const Site&
   if (siteOut.size() == 0)
     throw EmptySiteException("CodonSiteTools::getFixedDifferences Incorrect specified site", &siteOut);
 
-  const CodonAlphabet* ca = dynamic_cast<const CodonAlphabet*>(gCode.getSourceAlphabet());
+  const CodonAlphabet* ca = gCode.getSourceAlphabet();
 
   size_t Ntot = numberOfDifferences(i, j, *ca);
   size_t Ns = static_cast<size_t>(numberOfSynonymousDifferences(i, j, gCode, true));
@@ -809,6 +814,7 @@ vector<size_t> CodonSiteTools::fixedDifferences(const Site& siteIn, const Site&
 
 bool CodonSiteTools::isFourFoldDegenerated(const Site& site, const GeneticCode& gCode)
 {
+  SymbolListSpan states(site);
   if (!SiteTools::isConstant(site, true))
   {
     /** If non-synonymous mutation **/
@@ -817,7 +823,7 @@ bool CodonSiteTools::isFourFoldDegenerated(const Site& site, const GeneticCode&
 
     for (size_t i = 0; i < site.size(); i++)
     {
-      if (!(gCode.isFourFoldDegenerated(site.getValue(i))))
+      if (!(gCode.isFourFoldDegenerated(states[i])))
       {
         return false;
       }
@@ -827,7 +833,7 @@ bool CodonSiteTools::isFourFoldDegenerated(const Site& site, const GeneticCode&
   {
     for (size_t i = 0; i < site.size(); i++)
     {
-      if (!(gCode.isFourFoldDegenerated(site.getValue(i))))
+      if (!(gCode.isFourFoldDegenerated(states[i])))
       {
         return false;
       }
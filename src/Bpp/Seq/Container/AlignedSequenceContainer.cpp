@@ -157,7 +157,7 @@ void AlignedSequenceContainer::setSite(size_t pos, const Site& site, bool checkP
   // New site's alphabet and site container's alphabet matching verification
   if (pos >= getNumberOfSites())
     throw IndexOutOfBoundsException("AlignedSequenceContainer::setSite", pos, 0, getNumberOfSites() - 1);
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("AlignedSequenceContainer::setSite", getAlphabet(), site.getAlphabet());
 
   // Check size:
@@ -270,7 +270,7 @@ void AlignedSequenceContainer::deleteSites(size_t siteIndex, size_t length)
 void AlignedSequenceContainer::addSite(const Site& site, bool checkPositions)
 {
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("AlignedSequenceContainer::addSite");
 
   // Check size:
@@ -307,7 +307,7 @@ void AlignedSequenceContainer::addSite(const Site& site, bool checkPositions)
 void AlignedSequenceContainer::addSite(const Site& site, int position, bool checkPositions)
 {
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("AlignedSequenceContainer::addSite");
 
   // Check size:
@@ -346,7 +346,7 @@ void AlignedSequenceContainer::addSite(const Site& site, size_t siteIndex, bool
     throw IndexOutOfBoundsException("AlignedSequenceContainer::addSite", siteIndex, 0, getNumberOfSites() - 1);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("AlignedSequenceContainer::addSite", getAlphabet(), site.getAlphabet());
 
   // Check size:
@@ -386,7 +386,7 @@ void AlignedSequenceContainer::addSite(const Site& site, size_t siteIndex, int p
     throw IndexOutOfBoundsException("AlignedSequenceContainer::addSite", siteIndex, 0, getNumberOfSites() - 1);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("AlignedSequenceContainer::addSite", getAlphabet(), site.getAlphabet());
 
   // Check size:
@@ -0,0 +1,266 @@
+//
+// File: AlignmentComparison.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "AlignmentComparison.h"
+
+#include <Bpp/Exceptions.h>
+#include <Bpp/Text/TextTools.h>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+AlignmentComparison::AlignmentComparison(const Matrix<size_t>& reference):
+  numberOfSequences_(reference.getNumberOfRows()),
+  numberOfColumns_(reference.getNumberOfColumns()),
+  reference_(reference.getNumberOfRows() * reference.getNumberOfColumns()),
+  columns_(reference.getNumberOfRows()),
+  numberOfReferenceColumns_(0),
+  numberOfReferencePairs_(0)
+{
+  for (size_t i = 0; i < numberOfColumns_; ++i)
+  {
+    size_t residues = 0;
+    for (size_t j = 0; j < numberOfSequences_; ++j)
+    {
+      size_t pos = reference(j, i);
+      reference_[i * numberOfSequences_ + j] = pos;
+      if (pos > 0)
+      {
+        vector<size_t>& col = columns_[j];
+        if (col.size() < pos)
+          col.resize(pos, numberOfColumns_);
+        col[pos - 1] = i;
+        residues++;
+      }
+    }
+    if (residues > 0)
+      numberOfReferenceColumns_++;
+    if (residues > 1)
+      numberOfReferencePairs_ += residues * (residues - 1) / 2;
+  }
+}
+
+/******************************************************************************/
+
+size_t AlignmentComparison::getReferenceColumn(size_t sequence, size_t position) const
+{
+  if (sequence >= numberOfSequences_ || position == 0 || position > columns_[sequence].size() || columns_[sequence][position - 1] == numberOfColumns_)
+    throw Exception("AlignmentComparison::getReferenceColumn(). Position " + TextTools::toString(position) + " of sequence " + TextTools::toString(sequence) + " not found in reference alignment. Please make sure the two indexes are built from the same data!");
+  return columns_[sequence][position - 1];
+}
+
+void AlignmentComparison::checkTest_(const Matrix<size_t>& test) const
+{
+  if (test.getNumberOfRows() != numberOfSequences_)
+    throw Exception("AlignmentComparison. The two input alignments must have the same number of sequences!");
+  // Check all residues once, so that no exception is raised during the parallel loops:
+  for (size_t j = 0; j < numberOfSequences_; ++j)
+  {
+    for (size_t i = 0; i < test.getNumberOfColumns(); ++i)
+    {
+      size_t pos = test(j, i);
+      if (pos > 0) getReferenceColumn(j, pos);
+    }
+  }
+}
+
+/******************************************************************************/
+
+vector<int> AlignmentComparison::getColumnScores(const Matrix<size_t>& test, int na) const
+{
+  checkTest_(test);
+  size_t n = test.getNumberOfColumns();
+  vector<int> scores(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    //Find an anchor point:
+    size_t whichSeq = 0;
+    size_t whichPos = 0;
+    for (size_t j = 0; j < numberOfSequences_; ++j)
+    {
+      if (test(j, i) > 0)
+      {
+        whichSeq = j;
+        whichPos = test(j, i);
+        break;
+      }
+    }
+    if (whichPos == 0)
+    {
+      //No anchor found, this alignment column is only made of gaps.
+      scores[i] = na;
+      continue;
+    }
+    //Now we compare all sequences between the test column and the reference one:
+    size_t i2 = columns_[whichSeq][whichPos - 1];
+    bool same = true;
+    for (size_t j = 0; same && j < numberOfSequences_; ++j)
+      same = (test(j, i) == getReferenceValue_(i2, j));
+    scores[i] = same ? 1 : 0;
+  }
+  return scores;
+}
+
+/******************************************************************************/
+
+vector<double> AlignmentComparison::getSumOfPairsScores(const Matrix<size_t>& test, double na) const
+{
+  checkTest_(test);
+  size_t n = test.getNumberOfColumns();
+  vector<double> scores(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    size_t countAlignable = 0;
+    size_t countAligned   = 0;
+    for (size_t j = 0; j < numberOfSequences_; ++j)
+    {
+      size_t whichPos = test(j, i);
+      if (whichPos == 0) continue;
+      //Get the corresponding column in the reference alignment:
+      size_t i2 = columns_[j][whichPos - 1];
+      //Now we check all other positions and see if they are aligned with this one:
+      for (size_t k = j + 1; k < numberOfSequences_; ++k)
+      {
+        size_t whichPos2 = test(k, i);
+        if (whichPos2 == 0) continue;
+        countAlignable++;
+        if (getReferenceValue_(i2, k) == whichPos2)
+          countAligned++;
+      }
+    }
+    scores[i] = countAlignable == 0 ? na : static_cast<double>(countAligned) / static_cast<double>(countAlignable);
+  }
+  return scores;
+}
+
+/******************************************************************************/
+
+double AlignmentComparison::getTotalColumnScore(const Matrix<size_t>& test) const
+{
+  if (numberOfReferenceColumns_ == 0) return 0.;
+  vector<int> scores = getColumnScores(test, 0);
+  size_t count = 0;
+  for (size_t i = 0; i < scores.size(); ++i)
+    count += static_cast<size_t>(scores[i]);
+  return static_cast<double>(count) / static_cast<double>(numberOfReferenceColumns_);
+}
+
+/******************************************************************************/
+
+double AlignmentComparison::getSumOfPairsScore(const Matrix<size_t>& test) const
+{
+  checkTest_(test);
+  if (numberOfReferencePairs_ == 0) return 0.;
+  size_t n = test.getNumberOfColumns();
+  size_t countAligned = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+:countAligned)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (size_t j = 0; j < numberOfSequences_; ++j)
+    {
+      size_t whichPos = test(j, i);
+      if (whichPos == 0) continue;
+      size_t i2 = columns_[j][whichPos - 1];
+      for (size_t k = j + 1; k < numberOfSequences_; ++k)
+      {
+        size_t whichPos2 = test(k, i);
+        if (whichPos2 > 0 && getReferenceValue_(i2, k) == whichPos2)
+          countAligned++;
+      }
+    }
+  }
+  return static_cast<double>(countAligned) / static_cast<double>(numberOfReferencePairs_);
+}
+
+/******************************************************************************/
+
+void AlignmentComparison::getPairwiseScores(const Matrix<size_t>& test, Matrix<double>& scores, double na) const
+{
+  checkTest_(test);
+  size_t ns = numberOfSequences_;
+  scores.resize(ns, ns);
+  // Each thread handles a set of first sequences j, and counts pairs (j, k > j) over all columns:
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for (size_t j = 0; j < ns; ++j)
+  {
+    vector<size_t> aligned(ns, 0);
+    vector<size_t> reference(ns, 0);
+    for (size_t i = 0; i < numberOfColumns_; ++i)
+    {
+      if (getReferenceValue_(i, j) == 0) continue;
+      for (size_t k = j + 1; k < ns; ++k)
+        if (getReferenceValue_(i, k) > 0) reference[k]++;
+    }
+    for (size_t i = 0; i < test.getNumberOfColumns(); ++i)
+    {
+      size_t whichPos = test(j, i);
+      if (whichPos == 0) continue;
+      size_t i2 = columns_[j][whichPos - 1];
+      for (size_t k = j + 1; k < ns; ++k)
+      {
+        size_t whichPos2 = test(k, i);
+        if (whichPos2 > 0 && getReferenceValue_(i2, k) == whichPos2)
+          aligned[k]++;
+      }
+    }
+    scores(j, j) = 1.;
+    for (size_t k = j + 1; k < ns; ++k)
+    {
+      double s = reference[k] == 0 ? na : static_cast<double>(aligned[k]) / static_cast<double>(reference[k]);
+      scores(j, k) = s;
+      scores(k, j) = s;
+    }
+  }
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,158 @@
+//
+// File: AlignmentComparison.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _ALIGNMENTCOMPARISON_H_
+#define _ALIGNMENTCOMPARISON_H_
+
+#include <Bpp/Numeric/Matrix/Matrix.h>
+
+// From the STL:
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Compare test alignments to a reference alignment.
+ *
+ * Alignments are described by position indexes, as built by SiteContainerTools::getSequencePositions:
+ * one row per sequence, one column per site, with sequence positions starting at 1 and 0 for gaps.
+ * The reference index is stored column-wise together with an inverted index giving, for each sequence
+ * and each residue, the column where it is found. Each test column can therefore be matched to the
+ * reference in constant time, and a test alignment is scored in time proportional to its size.
+ *
+ * When compiled with OpenMP support, test columns are scored in parallel.
+ *
+ * Scores follow Thompson et al 1999, Nucleic Acids Research (1999):27(13);2682–2690.
+ *
+ * @warning The indexes for the test and reference alignments must have the sequences in the exact same order!
+ */
+class AlignmentComparison
+{
+  private:
+    size_t numberOfSequences_;
+    size_t numberOfColumns_;
+    std::vector<size_t> reference_;
+    std::vector< std::vector<size_t> > columns_;
+    size_t numberOfReferenceColumns_;
+    size_t numberOfReferencePairs_;
+
+  public:
+    /**
+     * @param reference Alignment index for the reference alignment.
+     */
+    AlignmentComparison(const Matrix<size_t>& reference);
+
+    virtual ~AlignmentComparison() {}
+
+  public:
+    size_t getNumberOfSequences() const { return numberOfSequences_; }
+    size_t getNumberOfColumns() const { return numberOfColumns_; }
+
+    /**
+     * @return The number of columns of the reference alignment which are not only made of gaps.
+     */
+    size_t getNumberOfReferenceColumns() const { return numberOfReferenceColumns_; }
+
+    /**
+     * @return The column of the reference alignment where a given residue is found.
+     * @param sequence The index of the sequence.
+     * @param position The position in the sequence, starting at 1.
+     * @throw Exception If the residue is not in the reference alignment.
+     */
+    size_t getReferenceColumn(size_t sequence, size_t position) const;
+
+    /**
+     * @brief Column scores ("CS") of a test alignment.
+     *
+     * @param test Alignment index for the test alignment.
+     * @param na   The score to use if the tested column is full of gap.
+     * @return A vector of score, as 0 or 1, for each column of the test alignment.
+     * @throw Exception If the test and reference indexes do not match.
+     */
+    std::vector<int> getColumnScores(const Matrix<size_t>& test, int na = 0) const;
+
+    /**
+     * @brief Sum-of-pairs scores ("SPS") of each column of a test alignment.
+     *
+     * @param test Alignment index for the test alignment.
+     * @param na   The score to use if the tested column is not testable, that is not containing at least to residues.
+     * @return A vector of score, between 0 and 1 (+ na value), for each column of the test alignment.
+     * @throw Exception If the test and reference indexes do not match.
+     */
+    std::vector<double> getSumOfPairsScores(const Matrix<size_t>& test, double na = 0) const;
+
+    /**
+     * @brief Total column score ("TC") of a test alignment.
+     *
+     * @return The number of test columns also found in the reference, divided by the number of reference columns
+     * which are not only made of gaps.
+     * @throw Exception If the test and reference indexes do not match.
+     */
+    double getTotalColumnScore(const Matrix<size_t>& test) const;
+
+    /**
+     * @brief Global sum-of-pairs score ("SP") of a test alignment.
+     *
+     * @return The number of residue pairs aligned in both alignments, divided by the number of residue pairs aligned in the reference.
+     * @throw Exception If the test and reference indexes do not match.
+     */
+    double getSumOfPairsScore(const Matrix<size_t>& test) const;
+
+    /**
+     * @brief Sum-of-pairs score of each pair of sequences.
+     *
+     * @param test   Alignment index for the test alignment.
+     * @param scores A matrix which is going to be resized and filled with the score of each pair of
+     * sequences: the number of residue pairs aligned in both alignments, divided by the number of
+     * residue pairs aligned in the reference. The matrix is symmetric.
+     * @param na     The score to use for pairs of sequences with no aligned residue in the reference.
+     * @throw Exception If the test and reference indexes do not match.
+     */
+    void getPairwiseScores(const Matrix<size_t>& test, Matrix<double>& scores, double na = 0) const;
+
+  private:
+    void checkTest_(const Matrix<size_t>& test) const;
+    size_t getReferenceValue_(size_t column, size_t sequence) const { return reference_[column * numberOfSequences_ + sequence]; }
+};
+
+} //end of namespace bpp.
+
+#endif //_ALIGNMENTCOMPARISON_H_
+
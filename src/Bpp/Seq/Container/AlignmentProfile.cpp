@@ -0,0 +1,318 @@
+//
+// File: AlignmentProfile.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "AlignmentProfile.h"
+#include "VectorSiteContainer.h"
+#include "../SiteView.h"
+#include "../Alphabet/AlphabetExceptions.h"
+
+#include <Bpp/Exceptions.h>
+#include <Bpp/Text/TextTools.h>
+
+// From the STL:
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+AlignmentProfile::AlignmentProfile(const SiteContainer& sites, double pseudoCount, double gapScore):
+  alphabet_(sites.getAlphabet()),
+  numberOfStates_(sites.getAlphabet()->getSize()),
+  numberOfSites_(sites.getNumberOfSites()),
+  pseudoCount_(pseudoCount),
+  gapScore_(gapScore),
+  background_(sites.getAlphabet()->getSize(), 1. / static_cast<double>(sites.getAlphabet()->getSize())),
+  counts_(),
+  gaps_(),
+  frequencies_(),
+  entropies_(),
+  minState_(0),
+  width_(0),
+  scores_()
+{
+  if (pseudoCount < 0)
+    throw Exception("AlignmentProfile. Pseudocount must be positive: " + TextTools::toString(pseudoCount));
+  compute_(sites);
+}
+
+AlignmentProfile::AlignmentProfile(const SiteContainer& sites, const vector<double>& background, double pseudoCount, double gapScore):
+  alphabet_(sites.getAlphabet()),
+  numberOfStates_(sites.getAlphabet()->getSize()),
+  numberOfSites_(sites.getNumberOfSites()),
+  pseudoCount_(pseudoCount),
+  gapScore_(gapScore),
+  background_(background),
+  counts_(),
+  gaps_(),
+  frequencies_(),
+  entropies_(),
+  minState_(0),
+  width_(0),
+  scores_()
+{
+  if (pseudoCount < 0)
+    throw Exception("AlignmentProfile. Pseudocount must be positive: " + TextTools::toString(pseudoCount));
+  if (background.size() != numberOfStates_)
+    throw DimensionException("AlignmentProfile. Background frequencies do not match the alphabet size.", background.size(), numberOfStates_);
+  for (size_t s = 0; s < numberOfStates_; ++s)
+    if (background[s] <= 0)
+      throw Exception("AlignmentProfile. Background frequencies must be strictly positive: " + TextTools::toString(background[s]));
+  compute_(sites);
+}
+
+/******************************************************************************/
+
+void AlignmentProfile::compute_(const SiteContainer& sites)
+{
+  //Resolve all supported states once:
+  const vector<int>& supported = alphabet_->getSupportedInts();
+  minState_ = *min_element(supported.begin(), supported.end());
+  int maxState = *max_element(supported.begin(), supported.end());
+  width_ = static_cast<size_t>(maxState - minState_ + 1);
+  vector< vector<size_t> > aliases(width_);
+  vector<bool> isGap(width_, false);
+  for (size_t i = 0; i < supported.size(); ++i)
+  {
+    size_t k = static_cast<size_t>(supported[i] - minState_);
+    if (alphabet_->isGap(supported[i]))
+    {
+      isGap[k] = true;
+      continue;
+    }
+    vector<int> alias = alphabet_->getAlias(supported[i]);
+    for (size_t j = 0; j < alias.size(); ++j)
+      if (alias[j] >= 0 && static_cast<size_t>(alias[j]) < numberOfStates_)
+        aliases[k].push_back(static_cast<size_t>(alias[j]));
+  }
+  vector<double> logBackground(numberOfStates_);
+  for (size_t s = 0; s < numberOfStates_; ++s)
+    logBackground[s] = log(background_[s]) / log(2.);
+
+  size_t n = numberOfStates_;
+  size_t nbSequences = sites.getNumberOfSequences();
+  counts_.assign(numberOfSites_ * n, 0.);
+  gaps_.assign(numberOfSites_, 0.);
+  frequencies_.resize(numberOfSites_ * n);
+  entropies_.resize(numberOfSites_);
+  scores_.resize(numberOfSites_ * width_);
+
+  // Containers other than VectorSiteContainer may build their sites on the fly and are not
+  // thread-safe: their columns are copied first.
+  const VectorSiteContainer* vsc = dynamic_cast<const VectorSiteContainer*>(&sites);
+  vector<int> columns;
+  if (!vsc)
+  {
+    columns.resize(numberOfSites_ * nbSequences);
+    for (size_t i = 0; i < numberOfSites_; ++i)
+    {
+      SiteView site(sites.getSite(i));
+      copy(site.begin(), site.end(), columns.begin() + static_cast<ptrdiff_t>(i * nbSequences));
+    }
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (size_t i = 0; i < numberOfSites_; ++i)
+  {
+    double* counts = &counts_[i * n];
+    double* freqs  = &frequencies_[i * n];
+    double* scores = &scores_[i * width_];
+    const int* column = vsc ? vsc->getSite(i).getData() : &columns[i * nbSequences];
+    for (size_t j = 0; j < nbSequences; ++j)
+    {
+      int state = column[j];
+      if (state < minState_ || state > maxState)
+        continue;
+      size_t k = static_cast<size_t>(state - minState_);
+      if (isGap[k])
+      {
+        gaps_[i]++;
+      }
+      else
+      {
+        const vector<size_t>& alias = aliases[k];
+        double w = 1. / static_cast<double>(alias.size());
+        for (size_t a = 0; a < alias.size(); ++a)
+          counts[alias[a]] += w;
+      }
+    }
+
+    double total = 0.;
+    for (size_t s = 0; s < n; ++s)
+      total += counts[s];
+
+    double h = 0.;
+    if (total > 0)
+    {
+      for (size_t s = 0; s < n; ++s)
+      {
+        if (counts[s] > 0)
+        {
+          double f = counts[s] / total;
+          h -= f * log(f);
+        }
+      }
+    }
+    entropies_[i] = h / log(2.);
+
+    for (size_t s = 0; s < n; ++s)
+      freqs[s] = total + pseudoCount_ > 0 ? (counts[s] + pseudoCount_ * background_[s]) / (total + pseudoCount_) : background_[s];
+
+    for (size_t k = 0; k < width_; ++k)
+    {
+      if (isGap[k])
+      {
+        scores[k] = gapScore_;
+        continue;
+      }
+      const vector<size_t>& alias = aliases[k];
+      double score = 0.;
+      for (size_t a = 0; a < alias.size(); ++a)
+        score += (freqs[alias[a]] > 0 ? log(freqs[alias[a]]) / log(2.) : -HUGE_VAL) - logBackground[alias[a]];
+      scores[k] = alias.size() > 0 ? score / static_cast<double>(alias.size()) : 0.;
+    }
+  }
+}
+
+/******************************************************************************/
+
+double AlignmentProfile::getResidueCount(size_t site) const
+{
+  double total = 0.;
+  for (size_t s = 0; s < numberOfStates_; ++s)
+    total += counts_[site * numberOfStates_ + s];
+  return total;
+}
+
+double AlignmentProfile::getInformationContent(size_t site) const
+{
+  return log(static_cast<double>(numberOfStates_)) / log(2.) - entropies_[site];
+}
+
+/******************************************************************************/
+
+int AlignmentProfile::getConsensusState(size_t site, bool ignoreGap) const
+{
+  const double* counts = &counts_[site * numberOfStates_];
+  double max = 0.;
+  int cons = -1;
+  for (size_t s = 0; s < numberOfStates_; ++s)
+  {
+    if (counts[s] > max)
+    {
+      max = counts[s];
+      cons = static_cast<int>(s);
+    }
+  }
+  if (!ignoreGap && gaps_[site] > 0 && gaps_[site] >= max)
+    cons = alphabet_->getGapCharacterCode();
+  return cons;
+}
+
+Sequence* AlignmentProfile::getConsensus(const string& name, bool ignoreGap) const
+{
+  vector<int> consensus(numberOfSites_);
+  for (size_t i = 0; i < numberOfSites_; ++i)
+    consensus[i] = getConsensusState(i, ignoreGap);
+  return new BasicSequence(name, consensus, alphabet_);
+}
+
+/******************************************************************************/
+
+void AlignmentProfile::checkSequence_(const SymbolList& seq, const string& method) const
+{
+  if (seq.getAlphabet()->getAlphabetTypeId() != alphabet_->getAlphabetTypeId())
+    throw AlphabetMismatchException("AlignmentProfile::" + method, seq.getAlphabet(), alphabet_);
+}
+
+double AlignmentProfile::getScore(const SymbolList& seq, size_t begin) const
+{
+  checkSequence_(seq, "getScore");
+  if (begin + numberOfSites_ > seq.size())
+    throw IndexOutOfBoundsException("AlignmentProfile::getScore. Window exceeds the sequence length.", begin + numberOfSites_, 0, seq.size());
+  double score = 0.;
+  for (size_t i = 0; i < numberOfSites_; ++i)
+  {
+    int state = seq[begin + i];
+    if (state < minState_ || static_cast<size_t>(state - minState_) >= width_)
+      throw BadIntException(state, "AlignmentProfile::getScore. Unsupported state.", alphabet_);
+    score += scores_[i * width_ + static_cast<size_t>(state - minState_)];
+  }
+  return score;
+}
+
+void AlignmentProfile::scan(const SymbolList& seq, vector<double>& scores) const
+{
+  checkSequence_(seq, "scan");
+  size_t length = seq.size();
+  vector<size_t> index(length);
+  for (size_t i = 0; i < length; ++i)
+  {
+    int state = seq[i];
+    if (state < minState_ || static_cast<size_t>(state - minState_) >= width_)
+      throw BadIntException(state, "AlignmentProfile::scan. Unsupported state.", alphabet_);
+    index[i] = static_cast<size_t>(state - minState_);
+  }
+  if (length < numberOfSites_)
+  {
+    scores.clear();
+    return;
+  }
+  size_t nbWindows = length - numberOfSites_ + 1;
+  scores.resize(nbWindows);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (size_t w = 0; w < nbWindows; ++w)
+  {
+    double score = 0.;
+    const double* row = scores_.data();
+    for (size_t i = 0; i < numberOfSites_; ++i, row += width_)
+      score += row[index[w + i]];
+    scores[w] = score;
+  }
+}
+
+/******************************************************************************/
+
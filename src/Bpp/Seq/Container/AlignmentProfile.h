@@ -0,0 +1,228 @@
+//
+// File: AlignmentProfile.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _ALIGNMENTPROFILE_H_
+#define _ALIGNMENTPROFILE_H_
+
+#include "SiteContainer.h"
+#include "../Sequence.h"
+
+// From the STL:
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Position frequency matrix and position-specific scoring matrix of an alignment.
+ *
+ * All quantities are computed in a single pass over the alignment columns, which is parallel when compiled
+ * with OpenMP support:
+ * - the count of each resolved state per column, ambiguous characters being split among their aliases
+ *   (a DNA 'N' counts for 1/4 A, C, G and T), and the number of gaps;
+ * - the state frequencies, with pseudocounts proportional to the background frequencies:
+ *   @f$f_{i,s} = (n_{i,s} + a \pi_s) / (n_i + a)@f$;
+ * - the log-odds scores in bits, @f$\log_2(f_{i,s} / \pi_s)@f$;
+ * - the Shannon entropy in bits of the observed (raw) frequencies of each column.
+ *
+ * Log-odds are also stored in a table indexed by position and state, including gaps and ambiguous states,
+ * so that a sequence or all windows of a sequence can be scored with one table look-up per position.
+ * Ambiguous states score the average of their aliases, gaps score the gap score.
+ * With a null pseudocount, states not observed in a column score minus infinity.
+ *
+ * @see SiteContainerTools::getConsensus
+ */
+class AlignmentProfile
+{
+  private:
+    const Alphabet* alphabet_;
+    size_t numberOfStates_;
+    size_t numberOfSites_;
+    double pseudoCount_;
+    double gapScore_;
+    std::vector<double> background_;
+    std::vector<double> counts_;
+    std::vector<double> gaps_;
+    std::vector<double> frequencies_;
+    std::vector<double> entropies_;
+    int minState_;
+    size_t width_;
+    std::vector<double> scores_;
+
+  public:
+    /**
+     * @brief Build a profile with uniform background frequencies.
+     *
+     * @param sites       The input alignment.
+     * @param pseudoCount The total pseudocount added to each column.
+     * @param gapScore    The score of a gap in a scored sequence.
+     * @throw Exception If the pseudocount is negative.
+     */
+    AlignmentProfile(const SiteContainer& sites, double pseudoCount = 1., double gapScore = 0.);
+
+    /**
+     * @brief Build a profile with given background frequencies.
+     *
+     * @param sites       The input alignment.
+     * @param background  The background frequencies, one per resolved state.
+     * @param pseudoCount The total pseudocount added to each column.
+     * @param gapScore    The score of a gap in a scored sequence.
+     * @throw DimensionException If the background frequencies do not match the alphabet size.
+     * @throw Exception If the pseudocount is negative or a background frequency is not positive.
+     */
+    AlignmentProfile(const SiteContainer& sites, const std::vector<double>& background, double pseudoCount = 1., double gapScore = 0.);
+
+    AlignmentProfile(const AlignmentProfile& ap):
+      alphabet_(ap.alphabet_), numberOfStates_(ap.numberOfStates_), numberOfSites_(ap.numberOfSites_),
+      pseudoCount_(ap.pseudoCount_), gapScore_(ap.gapScore_), background_(ap.background_),
+      counts_(ap.counts_), gaps_(ap.gaps_), frequencies_(ap.frequencies_), entropies_(ap.entropies_),
+      minState_(ap.minState_), width_(ap.width_), scores_(ap.scores_) {}
+
+    AlignmentProfile& operator=(const AlignmentProfile& ap)
+    {
+      alphabet_       = ap.alphabet_;
+      numberOfStates_ = ap.numberOfStates_;
+      numberOfSites_  = ap.numberOfSites_;
+      pseudoCount_    = ap.pseudoCount_;
+      gapScore_       = ap.gapScore_;
+      background_     = ap.background_;
+      counts_         = ap.counts_;
+      gaps_           = ap.gaps_;
+      frequencies_    = ap.frequencies_;
+      entropies_      = ap.entropies_;
+      minState_       = ap.minState_;
+      width_          = ap.width_;
+      scores_         = ap.scores_;
+      return *this;
+    }
+
+    virtual ~AlignmentProfile() {}
+
+  public:
+    const Alphabet* getAlphabet() const { return alphabet_; }
+
+    size_t getNumberOfSites() const { return numberOfSites_; }
+
+    size_t getNumberOfStates() const { return numberOfStates_; }
+
+    double getPseudoCount() const { return pseudoCount_; }
+
+    const std::vector<double>& getBackgroundFrequencies() const { return background_; }
+
+    /**
+     * @return The (possibly fractional) count of a resolved state at a given site.
+     */
+    double getCount(size_t site, size_t state) const { return counts_[site * numberOfStates_ + state]; }
+
+    /**
+     * @return The number of gaps at a given site.
+     */
+    double getGapCount(size_t site) const { return gaps_[site]; }
+
+    /**
+     * @return The number of residues (all but gaps) at a given site.
+     */
+    double getResidueCount(size_t site) const;
+
+    /**
+     * @return The frequency, with pseudocounts, of a resolved state at a given site.
+     */
+    double getFrequency(size_t site, size_t state) const { return frequencies_[site * numberOfStates_ + state]; }
+
+    /**
+     * @return The log-odds score in bits of a resolved state at a given site.
+     */
+    double getLogOdds(size_t site, size_t state) const { return scores_[site * width_ + static_cast<size_t>(static_cast<int>(state) - minState_)]; }
+
+    /**
+     * @return The Shannon entropy in bits of the observed frequencies at a given site, 0 if the site has no residue.
+     */
+    double getEntropy(size_t site) const { return entropies_[site]; }
+
+    /**
+     * @return The information content in bits of a given site, that is log2 of the number of states minus the entropy.
+     */
+    double getInformationContent(size_t site) const;
+
+    /**
+     * @return The most frequent state at a given site, the first one in case of ties.
+     * Counts of ambiguous states are split among their aliases, so that the consensus is the one of
+     * SiteContainerTools::getConsensus with resolveUnknown set to true.
+     * @param site      The site index.
+     * @param ignoreGap If true, only sites without residue have a gap in the consensus.
+     * Otherwise, a gap is returned if gaps are at least as frequent as any state.
+     */
+    int getConsensusState(size_t site, bool ignoreGap = true) const;
+
+    /**
+     * @return A new sequence with the consensus state at each site.
+     * @see getConsensusState
+     */
+    Sequence* getConsensus(const std::string& name = "consensus", bool ignoreGap = true) const;
+
+    /**
+     * @return The score of a window of a sequence, aligned without gap to the whole profile.
+     * @param seq   The sequence to score.
+     * @param begin The position in the sequence aligned to the first site of the profile.
+     * @throw AlphabetMismatchException If the sequence does not have the profile alphabet.
+     * @throw IndexOutOfBoundsException If the window goes past the end of the sequence.
+     * @throw BadIntException If the sequence contains a state not supported by the alphabet.
+     */
+    double getScore(const SymbolList& seq, size_t begin = 0) const;
+
+    /**
+     * @brief Score all windows of a sequence.
+     *
+     * @param seq    The sequence to score.
+     * @param scores [out] The score of the window starting at each position, empty if the sequence is shorter than the profile.
+     * @throw AlphabetMismatchException If the sequence does not have the profile alphabet.
+     * @throw BadIntException If the sequence contains a state not supported by the alphabet.
+     */
+    void scan(const SymbolList& seq, std::vector<double>& scores) const;
+
+  private:
+    void compute_(const SiteContainer& sites);
+    void checkSequence_(const SymbolList& seq, const std::string& method) const;
+
+};
+
+} //end of namespace bpp.
+
+#endif //_ALIGNMENTPROFILE_H_
+
@@ -243,7 +243,7 @@ void CompressedVectorSiteContainer::setSite(size_t pos, const Site& site, bool c
   if (site.size() != getNumberOfSequences()) throw SiteException("AlignedSequenceContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("CompressedVectorSiteContainer::setSite", getAlphabet(), site.getAlphabet());
   
   size_t current = index_[pos];
@@ -370,7 +370,7 @@ void CompressedVectorSiteContainer::addSite(const Site& site, bool checkPosition
   if (site.size() != getNumberOfSequences()) throw SiteException("CompressedVectorSiteContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("CompressedVectorSiteContainer::addSite", getAlphabet(), site.getAlphabet());
   }
@@ -395,7 +395,7 @@ void CompressedVectorSiteContainer::addSite(const Site& site, size_t siteIndex,
   if (site.size() != getNumberOfSequences()) throw SiteException("CompressedVectorSiteContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("CompressedVectorSiteContainer::addSite", getAlphabet(), site.getAlphabet());
   }
@@ -191,7 +191,7 @@ void MapSequenceContainer::setSequence(size_t i, const Sequence& sequence, bool
   }
 
   // New sequence's alphabet and sequence container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() == getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() == getAlphabet()->getAlphabetTypeId())
   {
     // Delete old sequence
     delete sequences_[getKey(i)];
@@ -219,7 +219,7 @@ void MapSequenceContainer::setSequence(const string& name, const Sequence& seque
   }
 
   // New sequence's alphabet and sequence container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() == getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() == getAlphabet()->getAlphabetTypeId())
   {
     // Delete old sequence
     delete sequences_[name];
@@ -247,7 +247,7 @@ void MapSequenceContainer::setSequenceByKey(const string& key, const Sequence& s
   }
 
   // New sequence's alphabet and sequence container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() == getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() == getAlphabet()->getAlphabetTypeId())
   {
     // Delete old sequence
     delete sequences_[key];
@@ -358,7 +358,7 @@ void MapSequenceContainer::addSequence(const string& key, const Sequence& sequen
       throw Exception("MapSequenceContainer::addSequence: key already in use. (" + key + ")");
   
   // New sequence's alphabet and sequence container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() == getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() == getAlphabet()->getAlphabetTypeId())
     sequences_.insert(make_pair(key, dynamic_cast<Sequence*>(sequence.clone())));
   else throw AlphabetMismatchException("MapSequenceContainer::addSequence", getAlphabet(), sequence.getAlphabet());
 }
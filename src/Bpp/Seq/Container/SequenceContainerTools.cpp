@@ -39,7 +39,11 @@
 
 #include "SequenceContainerTools.h"
 #include "VectorSequenceContainer.h"
+#include "VectorSiteContainer.h"
 #include "../Alphabet/CodonAlphabet.h"
+#include "../Alphabet/AlphabetTools.h"
+#include "../SequenceTools.h"
+#include "../HaplotypeIterator.h"
 
 // From bpp-core:
 #include <Bpp/Text/TextTools.h>
@@ -200,20 +204,171 @@ void SequenceContainerTools::getCounts(const SequenceContainer& sequences, std::
 
 /******************************************************************************/
 
+namespace
+{
+  /**
+   * Add sequences stored as rows of states to a container, in order.
+   * Site containers are extended in a single call, so that each site is only resized once.
+   */
+  void addRows_(
+      SequenceContainer& output,
+      const vector<string>& names,
+      const vector<Comments>& comments,
+      const vector< vector<int> >& rows)
+  {
+    bool checkNames = output.getNumberOfSequences() > 0;
+    VectorSiteContainer* vsc = dynamic_cast<VectorSiteContainer*>(&output);
+    if (vsc)
+    {
+      size_t first = vsc->getNumberOfSequences();
+      vsc->addSequences(names, rows, checkNames);
+      for (size_t i = 0; i < names.size(); ++i)
+        vsc->setComments(first + i, comments[i]);
+    }
+    else
+    {
+      for (size_t i = 0; i < names.size(); ++i)
+        output.addSequence(BasicSequence(names[i], rows[i], comments[i], output.getAlphabet()), checkNames);
+    }
+  }
+
+  /**
+   * Split all sequences of a codon or nucleotide container into codon positions.
+   * Positions with a null output are not computed.
+   */
+  void splitCodonPositions_(const OrderedSequenceContainer& sequences, SequenceContainer* outputs[3])
+  {
+    const Alphabet* alpha = sequences.getAlphabet();
+    const CodonAlphabet* calpha = dynamic_cast<const CodonAlphabet*>(alpha);
+    if (!calpha && !AlphabetTools::isNucleicAlphabet(alpha))
+      throw AlphabetException("SequenceContainerTools::getCodonPositions. Input sequences should be codon or nucleotide sequences.", alpha);
+    const Alphabet* nalpha = calpha ? calpha->getNucleicAlphabet() : alpha;
+    for (size_t k = 0; k < 3; ++k)
+    {
+      if (outputs[k] && outputs[k]->getAlphabet()->getAlphabetTypeId() != nalpha->getAlphabetTypeId())
+        throw AlphabetMismatchException("SequenceContainerTools::getCodonPositions.", nalpha, outputs[k]->getAlphabet());
+    }
+
+    size_t n = sequences.getNumberOfSequences();
+    vector<string> names(n);
+    vector<Comments> comments(n);
+    vector< vector<int> > rows[3];
+    for (size_t k = 0; k < 3; ++k)
+      if (outputs[k])
+        rows[k].resize(n);
+    int codonGap = alpha->getGapCharacterCode();
+    int gap = nalpha->getGapCharacterCode();
+    int unknown = nalpha->getUnknownCharacterCode();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (size_t i = 0; i < n; ++i)
+    {
+      const Sequence* seq = 0;
+      // Containers may build sequences on the fly, access them one at a time:
+#ifdef _OPENMP
+#pragma omp critical(SequenceContainerTools_access)
+#endif
+      {
+        seq = &sequences.getSequence(i);
+        names[i] = seq->getName();
+        comments[i] = seq->getComments();
+      }
+      SymbolListSpan states(*seq);
+      size_t len = states.size();
+      if (calpha)
+      {
+        // One nucleotide per codon and position, all positions being filled in the same pass:
+        int* pos[3] = { 0, 0, 0 };
+        for (size_t k = 0; k < 3; ++k)
+        {
+          if (outputs[k])
+          {
+            rows[k][i].resize(len);
+            if (len > 0)
+              pos[k] = &rows[k][i][0];
+          }
+        }
+        for (size_t j = 0; j < len; ++j)
+        {
+          int codon = states[j];
+          int nucl[3];
+          if (codon == codonGap)
+            nucl[0] = nucl[1] = nucl[2] = gap;
+          else if (calpha->isUnresolved(codon))
+            nucl[0] = nucl[1] = nucl[2] = unknown;
+          else
+          {
+            nucl[0] = codon / 16;
+            nucl[1] = (codon / 4) % 4;
+            nucl[2] = codon % 4;
+          }
+          for (size_t k = 0; k < 3; ++k)
+            if (pos[k])
+              pos[k][j] = nucl[k];
+        }
+      }
+      else
+      {
+        // Site j goes to position j mod 3:
+        for (size_t k = 0; k < 3; ++k)
+        {
+          if (!outputs[k])
+            continue;
+          vector<int>& row = rows[k][i];
+          row.resize(len > k ? (len - k + 2) / 3 : 0);
+          for (size_t j = k, l = 0; j < len; j += 3, ++l)
+            row[l] = states[j];
+        }
+      }
+    }
+
+    for (size_t k = 0; k < 3; ++k)
+      if (outputs[k])
+        addRows_(*outputs[k], names, comments, rows[k]);
+  }
+}
+
+/******************************************************************************/
+
 SequenceContainer* SequenceContainerTools::getCodonPosition(const SequenceContainer& sequences, size_t pos)
 {
   const CodonAlphabet* calpha = dynamic_cast<const CodonAlphabet*>(sequences.getAlphabet());
   if (!calpha)
     throw AlphabetException("SequenceContainerTools::getCodonPosition. Input sequences should be of type codon.");
-  vector<string> names = sequences.getSequencesNames();
   VectorSequenceContainer* newcont = new VectorSequenceContainer(calpha->getNucleicAlphabet());
+  const OrderedSequenceContainer* osc = dynamic_cast<const OrderedSequenceContainer*>(&sequences);
+  if (osc && pos < 3)
+  {
+    SequenceContainer* outputs[3] = { 0, 0, 0 };
+    outputs[pos] = newcont;
+    try
+    {
+      splitCodonPositions_(*osc, outputs);
+    }
+    catch (...)
+    {
+      delete newcont;
+      throw;
+    }
+    return newcont;
+  }
+  int gap = calpha->getNucleicAlphabet()->getGapCharacterCode();
+  int unknown = calpha->getNucleicAlphabet()->getUnknownCharacterCode();
+  vector<string> names = sequences.getSequencesNames();
   for (size_t j = 0; j < names.size(); j++)
   {
     const Sequence& seq = sequences.getSequence(names[j]);
     vector<int> newseq(seq.size());
     for (size_t i = 0; i < seq.size(); i++)
     {
-      newseq[i] = calpha->getNPosition(seq[i], pos);
+      if (calpha->isGap(seq[i]))
+        newseq[i] = gap;
+      else if (calpha->isUnresolved(seq[i]))
+        newseq[i] = unknown;
+      else
+        newseq[i] = calpha->getNPosition(seq[i], pos);
     }
     BasicSequence s(names[j], newseq, sequences.getComments(names[j]), calpha->getNucleicAlphabet());
     newcont->addSequence(s);
@@ -223,3 +378,189 @@ SequenceContainer* SequenceContainerTools::getCodonPosition(const SequenceContai
 
 /******************************************************************************/
 
+void SequenceContainerTools::getCodonPositions(
+    const OrderedSequenceContainer& sequences,
+    SequenceContainer& position1,
+    SequenceContainer& position2,
+    SequenceContainer& position3)
+{
+  SequenceContainer* outputs[3] = { &position1, &position2, &position3 };
+  splitCodonPositions_(sequences, outputs);
+}
+
+/******************************************************************************/
+
+void SequenceContainerTools::getReadingFrames(
+    const OrderedSequenceContainer& sequences,
+    SequenceContainer& frame1,
+    SequenceContainer& frame2,
+    SequenceContainer& frame3)
+{
+  const Alphabet* nalpha = sequences.getAlphabet();
+  SequenceContainer* outputs[3] = { &frame1, &frame2, &frame3 };
+  const CodonAlphabet* calphas[3];
+  for (size_t k = 0; k < 3; ++k)
+  {
+    calphas[k] = dynamic_cast<const CodonAlphabet*>(outputs[k]->getAlphabet());
+    if (!calphas[k])
+      throw AlphabetException("SequenceContainerTools::getReadingFrames. Output containers should have a codon alphabet.", outputs[k]->getAlphabet());
+    if (calphas[k]->getNucleicAlphabet()->getAlphabetTypeId() != nalpha->getAlphabetTypeId())
+      throw AlphabetMismatchException("SequenceContainerTools::getReadingFrames.", nalpha, calphas[k]->getNucleicAlphabet());
+  }
+
+  size_t n = sequences.getNumberOfSequences();
+  vector<string> names(n);
+  vector<Comments> comments(n);
+  vector< vector<int> > rows[3];
+  for (size_t k = 0; k < 3; ++k)
+    rows[k].resize(n);
+  int gap = nalpha->getGapCharacterCode();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    const Sequence* seq = 0;
+    // Containers may build sequences on the fly, access them one at a time:
+#ifdef _OPENMP
+#pragma omp critical(SequenceContainerTools_access)
+#endif
+    {
+      seq = &sequences.getSequence(i);
+      names[i] = seq->getName();
+      comments[i] = seq->getComments();
+    }
+    SymbolListSpan states(*seq);
+    size_t len = states.size();
+    for (size_t k = 0; k < 3; ++k)
+    {
+      const CodonAlphabet* calpha = calphas[k];
+      vector<int>& row = rows[k][i];
+      row.resize(len > k ? (len - k) / 3 : 0);
+      for (size_t j = k, l = 0; l < row.size(); j += 3, ++l)
+      {
+        int n1 = states[j], n2 = states[j + 1], n3 = states[j + 2];
+        if (n1 == gap && n2 == gap && n3 == gap)
+          row[l] = calpha->getGapCharacterCode();
+        else if (n1 == gap || n2 == gap || n3 == gap)
+          row[l] = calpha->getUnknownCharacterCode();
+        else
+          row[l] = calpha->getCodon(n1, n2, n3);
+      }
+    }
+  }
+
+  for (size_t k = 0; k < 3; ++k)
+    addRows_(*outputs[k], names, comments, rows[k]);
+}
+
+/******************************************************************************/
+
+void SequenceContainerTools::getInvertComplement(const OrderedSequenceContainer& sequences, SequenceContainer& outputCont)
+{
+  const Alphabet* alpha = sequences.getAlphabet();
+  if (!AlphabetTools::isDNAAlphabet(alpha) && !AlphabetTools::isRNAAlphabet(alpha))
+    throw AlphabetException("SequenceContainerTools::getInvertComplement. Input sequences should be DNA or RNA.", alpha);
+  size_t n = sequences.getNumberOfSequences();
+  vector<Sequence*> results(n, 0);
+  string error;
+  bool failed = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    Sequence* seq = 0;
+    // Containers may build sequences on the fly, access them one at a time:
+#ifdef _OPENMP
+#pragma omp critical(SequenceContainerTools_access)
+#endif
+    {
+      if (!failed)
+      {
+        try
+        {
+          seq = sequences.getSequence(i).clone();
+        }
+        catch (exception& e)
+        {
+          failed = true;
+          error = e.what();
+        }
+      }
+    }
+    if (seq)
+    {
+      try
+      {
+        SequenceTools::invertComplement(*seq);
+        results[i] = seq;
+      }
+      catch (exception& e)
+      {
+        delete seq;
+#ifdef _OPENMP
+#pragma omp critical(SequenceContainerTools_access)
+#endif
+        {
+          failed = true;
+          error = e.what();
+        }
+      }
+    }
+  }
+  if (failed)
+  {
+    for (size_t i = 0; i < n; ++i)
+      delete results[i];
+    throw Exception("SequenceContainerTools::getInvertComplement. " + error);
+  }
+  try
+  {
+    for (size_t i = 0; i < n; ++i)
+      outputCont.addSequence(*results[i], true);
+  }
+  catch (...)
+  {
+    for (size_t i = 0; i < n; ++i)
+      delete results[i];
+    throw;
+  }
+  for (size_t i = 0; i < n; ++i)
+    delete results[i];
+}
+
+/******************************************************************************/
+
+void SequenceContainerTools::getPutativeHaplotypes(
+    const OrderedSequenceContainer& genotypes,
+    SequenceContainer& haplotypes,
+    unsigned int level,
+    size_t maxNumberOfHaplotypes)
+{
+  for (size_t i = 0; i < genotypes.getNumberOfSequences(); ++i)
+  {
+    HaplotypeIterator it(genotypes.getSequence(i), level);
+    if (maxNumberOfHaplotypes > 0 && it.getNumberOfHaplotypes() > static_cast<double>(maxNumberOfHaplotypes))
+    {
+      string prefix = genotypes.getSequence(i).getName() + "_sample";
+      for (size_t k = 1; k <= maxNumberOfHaplotypes; ++k)
+      {
+        unique_ptr<Sequence> hap(it.sampleHaplotype(prefix + TextTools::toString(k)));
+        haplotypes.addSequence(*hap, true);
+      }
+    }
+    else
+    {
+      while (it.hasMoreSequences())
+      {
+        unique_ptr<Sequence> hap(it.nextSequence());
+        haplotypes.addSequence(*hap, true);
+      }
+    }
+  }
+}
+
+/******************************************************************************/
+
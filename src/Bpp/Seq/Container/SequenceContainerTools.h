@@ -247,7 +247,7 @@ class SequenceContainerTools
      */
     static void merge(const SequenceContainer& seqCont1, const SequenceContainer& seqCont2, SequenceContainer& outputCont)
     {
-      if (seqCont1.getAlphabet()->getAlphabetType() != seqCont2.getAlphabet()->getAlphabetType())
+      if (seqCont1.getAlphabet()->getAlphabetTypeId() != seqCont2.getAlphabet()->getAlphabetTypeId())
         throw AlphabetMismatchException("SequenceContainerTools::merge.", seqCont1.getAlphabet(), seqCont2.getAlphabet());
 
       std::vector<std::string> seqNames = seqCont1.getSequencesNames();
@@ -281,6 +281,8 @@ class SequenceContainerTools
     /**
      * @brief Extract a certain position (1, 2 or 3) from a container of codon sequences and returns the resulting nucleotide container.
      *
+     * Gap codons give gaps, and unresolved codons unknown characters.
+     *
      * @param sequences The input sequence container, with codon alphabet.
      * @param pos       The codon position to retrieve.
      * @return          A SequenceContainer with a nucleotide alphabet.
@@ -288,6 +290,87 @@ class SequenceContainerTools
      */
     static SequenceContainer* getCodonPosition(const SequenceContainer& sequences, size_t pos);
 
+    /**
+     * @brief Split a container into its three codon positions.
+     *
+     * Input sequences can either be codon sequences, in which case each codon is split into its three nucleotides,
+     * or nucleotide sequences, in which case site i is sent to position (i mod 3) + 1.
+     * Gap codons give three gaps, and unresolved codons three unknown characters.
+     * All positions are extracted in a single pass over each sequence, sequences being processed
+     * in parallel when OpenMP is available. Results are added to the output containers in the input order,
+     * at once when the output is a VectorSiteContainer.
+     * Names will be checked only if the output containers are not empty.
+     *
+     * @param sequences The input sequence container, with a codon or nucleotide alphabet.
+     * @param position1 A container where first codon positions should be added.
+     * @param position2 A container where second codon positions should be added.
+     * @param position3 A container where third codon positions should be added.
+     * @throw AlphabetException If input sequences are neither codon nor nucleotide sequences.
+     * @throw AlphabetMismatchException If an output container does not have the nucleotide alphabet of the input sequences.
+     */
+    static void getCodonPositions(
+        const OrderedSequenceContainer& sequences,
+        SequenceContainer& position1,
+        SequenceContainer& position2,
+        SequenceContainer& position3);
+
+    /**
+     * @brief Translate a container of nucleotide sequences into codons, in the three reading frames.
+     *
+     * Reading frame f (f = 1, 2 or 3) starts at site f of each sequence, and has floor((n - f + 1) / 3) codons,
+     * with n the length of the sequence.
+     * A triplet made only of gaps gives a gap codon, and a triplet with at least one gap or unresolved
+     * nucleotide an unknown codon.
+     * Sequences are processed in parallel when OpenMP is available, and added to the output containers in their original order.
+     * Names will be checked only if the output containers are not empty.
+     *
+     * @param sequences The input sequence container, with a nucleotide alphabet.
+     * @param frame1 A container with a codon alphabet, where codons in the first frame should be added.
+     * @param frame2 A container with a codon alphabet, where codons in the second frame should be added.
+     * @param frame3 A container with a codon alphabet, where codons in the third frame should be added.
+     * @throw AlphabetException If an output container does not have a codon alphabet.
+     * @throw AlphabetMismatchException If the output codon alphabets are not built on the alphabet of the input sequences.
+     */
+    static void getReadingFrames(
+        const OrderedSequenceContainer& sequences,
+        SequenceContainer& frame1,
+        SequenceContainer& frame2,
+        SequenceContainer& frame3);
+
+    /**
+     * @brief Add the reverse complement of all sequences of a container to another.
+     *
+     * Sequences are processed in parallel when OpenMP is available, and added
+     * to the output container in their original order.
+     *
+     * @param sequences The input sequence container, with a DNA or RNA alphabet.
+     * @param outputCont A container where the reverse complemented sequences should be added.
+     * @throw AlphabetException If input sequences are not DNA or RNA.
+     * @throw Exception If a sequence could not be retrieved or complemented. No sequence is added to the output container in that case.
+     * @see SequenceTools::invertComplement
+     */
+    static void getInvertComplement(const OrderedSequenceContainer& sequences, SequenceContainer& outputCont);
+
+    /**
+     * @brief Add the putative haplotypes of all sequences of a container to another.
+     *
+     * Haplotypes are generated one at a time with a HaplotypeIterator, and added to the
+     * output container in the order of the genotypes. When a genotype has more than
+     * maxNumberOfHaplotypes putative haplotypes, maxNumberOfHaplotypes of them are sampled
+     * uniformly (with replacement) instead, and named after the genotype with a "_samplek" suffix.
+     *
+     * @param genotypes The input sequence container.
+     * @param haplotypes A container where the haplotypes should be added.
+     * @param level The maximum number of states that a generic char must code to be resolved.
+     * @param maxNumberOfHaplotypes The maximum number of haplotypes to add per genotype, 0 for no limit.
+     * @see SequenceTools::getPutativeHaplotypes
+     */
+    static void getPutativeHaplotypes(
+        const OrderedSequenceContainer& genotypes,
+        SequenceContainer& haplotypes,
+        unsigned int level = 2,
+        size_t maxNumberOfHaplotypes = 0);
+
 };
 
 } //end of namespace bpp.
@@ -42,10 +42,15 @@
 #include "SequenceContainerTools.h"
 #include "VectorSiteContainer.h"
 #include "SiteContainerIterator.h"
+#include "AlignmentComparison.h"
+#include "../AlphabetIndex/CompiledAlphabetIndex2.h"
 #include "../SiteTools.h"
 #include "../CodonSiteTools.h"
 #include "../Alphabet/AlphabetTools.h"
+#include "../Alphabet/CaseMaskedAlphabet.h"
 #include "../SequenceTools.h"
+#include "../SequencePositionIndex.h"
+#include "../Instrumentation.h"
 #include <Bpp/App/ApplicationTools.h>
 
 using namespace bpp;
@@ -53,7 +58,10 @@ using namespace bpp;
 // From the STL:
 #include <vector>
 #include <deque>
+#include <set>
 #include <string>
+#include <limits>
+#include <algorithm>
 
 using namespace std;
 
@@ -61,31 +69,104 @@ using namespace std;
 
 SiteContainer* SiteContainerTools::getSitesWithoutGaps(const SiteContainer& sites)
 {
-  vector<string> seqNames = sites.getSequencesNames();
-  VectorSiteContainer* noGapCont = new VectorSiteContainer(seqNames.size(), sites.getAlphabet());
-  noGapCont->setSequencesNames(seqNames, false);
-  NoGapSiteContainerIterator ngsi(sites);
-  while (ngsi.hasMoreSites())
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::getSitesWithoutGaps");
+  return getSelectedSites(sites, selectSitesWithoutGaps(sites));
+}
+
+/******************************************************************************/
+
+SiteContainer* SiteContainerTools::getCompleteSites(const SiteContainer& sites)
+{
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::getCompleteSites");
+  return getSelectedSites(sites, selectCompleteSites(sites));
+}
+
+/******************************************************************************/
+
+SiteSelection SiteContainerTools::selectSitesWithoutGaps(const SiteContainer& sites)
+{
+  SiteSelection selection;
+  for (size_t i = 0; i < sites.getNumberOfSites(); ++i)
   {
-    noGapCont->addSite(*ngsi.nextSite());
+    if (!SiteTools::hasGap(SiteView(sites.getSite(i))))
+      selection.push_back(i);
   }
-  return noGapCont;
+  return selection;
 }
 
 /******************************************************************************/
 
-SiteContainer* SiteContainerTools::getCompleteSites(const SiteContainer& sites)
+SiteSelection SiteContainerTools::selectCompleteSites(const SiteContainer& sites)
 {
-  vector<string> seqNames = sites.getSequencesNames();
-  VectorSiteContainer* noGapCont = new VectorSiteContainer(seqNames.size(), sites.getAlphabet());
-  noGapCont->setSequencesNames(seqNames, false);
-  CompleteSiteContainerIterator csi(sites);
-  while (csi.hasMoreSites())
+  SiteSelection selection;
+  for (size_t i = 0; i < sites.getNumberOfSites(); ++i)
   {
-    noGapCont->addSite(*csi.nextSite(), false);
-    // We do not check positions, we suppose that the container passed as an argument is correct.
+    if (SiteTools::isComplete(SiteView(sites.getSite(i))))
+      selection.push_back(i);
+  }
+  return selection;
+}
+
+/******************************************************************************/
+
+SiteSelection SiteContainerTools::selectNonGapOnlySites(const SiteContainer& sites)
+{
+  SiteSelection selection;
+  for (size_t i = 0; i < sites.getNumberOfSites(); ++i)
+  {
+    if (!SiteTools::isGapOnly(SiteView(sites.getSite(i))))
+      selection.push_back(i);
+  }
+  return selection;
+}
+
+/******************************************************************************/
+
+SiteSelection SiteContainerTools::selectNonGapOrUnresolvedOnlySites(const SiteContainer& sites)
+{
+  SiteSelection selection;
+  for (size_t i = 0; i < sites.getNumberOfSites(); ++i)
+  {
+    if (!SiteTools::isGapOrUnresolvedOnly(SiteView(sites.getSite(i))))
+      selection.push_back(i);
+  }
+  return selection;
+}
+
+/******************************************************************************/
+
+SiteSelection SiteContainerTools::selectSitesWithMaxGapFrequency(const SiteContainer& sites, double maxFreqGaps)
+{
+  SiteSelection selection;
+  int gap = sites.getAlphabet()->getGapCharacterCode();
+  for (size_t i = 0; i < sites.getNumberOfSites(); ++i)
+  {
+    SiteView site(sites.getSite(i));
+    size_t nbGaps = 0;
+    for (size_t j = 0; j < site.size(); ++j)
+      if (site[j] == gap)
+        nbGaps++;
+    double freq = site.size() > 0 ? static_cast<double>(nbGaps) / static_cast<double>(site.size()) : 0.;
+    if (freq <= maxFreqGaps)
+      selection.push_back(i);
+  }
+  return selection;
+}
+
+/******************************************************************************/
+
+SiteSelection SiteContainerTools::selectSitesWithoutStopCodons(const SiteContainer& sites, const GeneticCode& gCode)
+{
+  const CodonAlphabet* pca = dynamic_cast<const CodonAlphabet*>(sites.getAlphabet());
+  if (!pca)
+    throw AlphabetException("Not a Codon Alphabet", sites.getAlphabet());
+  SiteSelection selection;
+  for (size_t i = 0; i < sites.getNumberOfSites(); ++i)
+  {
+    if (!CodonSiteTools::hasStop(sites.getSite(i), gCode))
+      selection.push_back(i);
   }
-  return noGapCont;
+  return selection;
 }
 
 /******************************************************************************/
@@ -94,6 +175,7 @@ SiteContainer* SiteContainerTools::getSelectedSites(
   const SiteContainer& sequences,
   const SiteSelection& selection)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::getSelectedSites");
   vector<string> seqNames = sequences.getSequencesNames();
   VectorSiteContainer* sc = new VectorSiteContainer(seqNames.size(), sequences.getAlphabet());
   sc->setSequencesNames(seqNames, false);
@@ -111,37 +193,43 @@ SiteContainer* SiteContainerTools::getSelectedSites(
 SiteContainer* SiteContainerTools::getSelectedPositions(
   const SiteContainer& sequences,
   const SiteSelection& selection)
+{
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::getSelectedPositions");
+  return getSelectedSites(sequences, getSitesFromPositions(sequences, selection));
+}
+
+/******************************************************************************/
+
+SiteSelection SiteContainerTools::getSitesFromPositions(
+  const SiteContainer& sequences,
+  const SiteSelection& selection)
 {
   size_t wsize = sequences.getAlphabet()->getStateCodingSize();
-  if (wsize > 1)
+  if (wsize == 1)
+    return selection;
+  if (selection.size() % wsize != 0)
+    throw IOException("SiteContainerTools::getSitesFromPositions: Positions selection is not compatible with the alphabet in use in the container.");
+  SiteSelection selection2;
+  for (size_t i = 0; i < selection.size(); i += wsize)
   {
-    if (selection.size() % wsize != 0)
-      throw IOException("SiteContainerTools::getSelectedPositions: Positions selection is not compatible with the alphabet in use in the container.");
-    SiteSelection selection2;
-    for (size_t i = 0; i < selection.size(); i += wsize)
-    {
-      if (selection[i] % wsize != 0)
-        throw IOException("SiteContainerTools::getSelectedPositions: Positions selection is not compatible with the alphabet in use in the container.");
+    if (selection[i] % wsize != 0)
+      throw IOException("SiteContainerTools::getSitesFromPositions: Positions selection is not compatible with the alphabet in use in the container.");
 
-      for (size_t j = 1; j < wsize; ++j)
-      {
-        if (selection[i + j] != (selection[i + j - 1] + 1))
-          throw IOException("SiteContainerTools::getSelectedPositions: Positions selection is not compatible with the alphabet in use in the container.");
-      }
-      selection2.push_back(selection[i] / wsize);
+    for (size_t j = 1; j < wsize; ++j)
+    {
+      if (selection[i + j] != (selection[i + j - 1] + 1))
+        throw IOException("SiteContainerTools::getSitesFromPositions: Positions selection is not compatible with the alphabet in use in the container.");
     }
-    return getSelectedSites(sequences, selection2);
-  }
-  else
-  {
-    return getSelectedSites(sequences, selection);
+    selection2.push_back(selection[i] / wsize);
   }
+  return selection2;
 }
 
 /******************************************************************************/
 
 Sequence* SiteContainerTools::getConsensus(const SiteContainer& sc, const std::string& name, bool ignoreGap, bool resolveUnknown)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::getConsensus");
   Vint consensus;
   SimpleSiteContainerIterator ssi(sc);
   const Site* site;
@@ -182,58 +270,261 @@ Sequence* SiteContainerTools::getConsensus(const SiteContainer& sc, const std::s
 
 /******************************************************************************/
 
-void SiteContainerTools::changeGapsToUnknownCharacters(SiteContainer& sites)
+namespace
 {
-  // NB: use iterators for a better algorithm?
-  int unknownCode = sites.getAlphabet()->getUnknownCharacterCode();
-  for (size_t i = 0; i < sites.getNumberOfSites(); i++)
+  // Marks states which can not be translated in a look-up table:
+  const int NO_STATE_ = numeric_limits<int>::min();
+
+  /**
+   * Build a look-up table covering all states supported by an alphabet, initialized to the identity.
+   * Return the state corresponding to the first element of the table.
+   */
+  int initStateTable_(const Alphabet* alpha, vector<int>& table)
+  {
+    const vector<int>& states = alpha->getSupportedInts();
+    table.clear();
+    if (states.empty())
+      return 0;
+    int minState = *min_element(states.begin(), states.end());
+    int maxState = *max_element(states.begin(), states.end());
+    table.resize(static_cast<size_t>(maxState - minState + 1));
+    for (size_t k = 0; k < table.size(); ++k)
+      table[k] = minState + static_cast<int>(k);
+    return minState;
+  }
+
+  /**
+   * Translate all states of a container in place.
+   */
+  void translateStates_(SiteContainer& sites, const vector<int>& table, int offset)
   {
-    for (unsigned int j = 0; j < sites.getNumberOfSequences(); j++)
+    VectorSiteContainer* vsc = dynamic_cast<VectorSiteContainer*>(&sites);
+    if (vsc)
     {
-      int* element = &sites(j, i);
-      if (sites.getAlphabet()->isGap(*element))
-        *element = unknownCode;
+      vsc->translateStates(table, offset);
+      return;
+    }
+    int tableSize = static_cast<int>(table.size());
+    for (size_t i = 0; i < sites.getNumberOfSites(); i++)
+    {
+      for (size_t j = 0; j < sites.getNumberOfSequences(); j++)
+      {
+        int& element = sites(j, i);
+        int k = element - offset;
+        if (k < 0 || k >= tableSize)
+          throw BadIntException(element, "SiteContainerTools. State not covered by the translation table.", sites.getAlphabet());
+        element = table[static_cast<size_t>(k)];
+      }
     }
   }
+
+  /**
+   * Build a new container from the sites of another one, translated through a look-up table.
+   * If dot is a valid state, it is replaced by the state of sequence ref before translation.
+   * Sites are translated by blocks, in parallel when OpenMP is available, and added in their original order.
+   */
+  VectorSiteContainer* translateSites_(
+      const SiteContainer& sites,
+      const vector<int>& table,
+      int offset,
+      const Alphabet* target,
+      int dot,
+      size_t ref,
+      const string& method)
+  {
+    const size_t blockSize = 1024;
+    size_t n = sites.getNumberOfSequences();
+    size_t m = sites.getNumberOfSites();
+    int tableSize = static_cast<int>(table.size());
+    VectorSiteContainer* result = new VectorSiteContainer(n, target);
+    vector<Site*> block(min(m, blockSize), 0);
+    string error;
+    bool failed = false;
+    bool untranslatable = false;
+    int badState = 0;
+    for (size_t begin = 0; begin < m && !failed; begin += blockSize)
+    {
+      size_t end = min(m, begin + blockSize);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (size_t i = begin; i < end; ++i)
+      {
+        try
+        {
+          vector<int> column;
+          int position = 0;
+          // Containers may build sites on the fly, copy them one at a time:
+#ifdef _OPENMP
+#pragma omp critical(SiteContainerTools_access)
+#endif
+          {
+            const Site& site = sites.getSite(i);
+            SiteView view(site);
+            column.assign(view.begin(), view.end());
+            position = site.getPosition();
+          }
+          vector<int> states(n);
+          for (size_t j = 0; j < n; ++j)
+          {
+            int state = column[j];
+            if (state == dot)
+              state = column[ref];
+            int k = state - offset;
+            int translated = (k >= 0 && k < tableSize ? table[static_cast<size_t>(k)] : NO_STATE_);
+            if (translated == NO_STATE_)
+            {
+#ifdef _OPENMP
+#pragma omp critical(SiteContainerTools_access)
+#endif
+              {
+                untranslatable = true;
+                badState = state;
+              }
+              translated = target->getUnknownCharacterCode();
+            }
+            states[j] = translated;
+          }
+          block[i - begin] = new Site(states, target, position);
+        }
+        catch (exception& e)
+        {
+#ifdef _OPENMP
+#pragma omp critical(SiteContainerTools_access)
+#endif
+          {
+            failed = true;
+            error = e.what();
+          }
+        }
+      }
+      for (size_t i = begin; i < end; ++i)
+      {
+        if (block[i - begin])
+        {
+          if (!failed && !untranslatable)
+            result->addSite(*block[i - begin], false);
+          delete block[i - begin];
+          block[i - begin] = 0;
+        }
+      }
+      if (untranslatable)
+        break;
+    }
+    if (untranslatable)
+    {
+      delete result;
+      throw AlphabetException(method + ". State " + sites.getAlphabet()->intToChar(badState) + " has no equivalent in the output alphabet.", target);
+    }
+    if (failed)
+    {
+      delete result;
+      throw Exception(method + ". " + error);
+    }
+    result->setSequencesNames(sites.getSequencesNames(), false);
+    return result;
+  }
+}
+
+/******************************************************************************/
+
+void SiteContainerTools::changeGapsToUnknownCharacters(SiteContainer& sites)
+{
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::changeGapsToUnknownCharacters");
+  const Alphabet* alpha = sites.getAlphabet();
+  vector<int> table;
+  int offset = initStateTable_(alpha, table);
+  int unknownCode = alpha->getUnknownCharacterCode();
+  const vector<int>& states = alpha->getSupportedInts();
+  for (size_t k = 0; k < states.size(); ++k)
+  {
+    if (alpha->isGap(states[k]))
+      table[static_cast<size_t>(states[k] - offset)] = unknownCode;
+  }
+  translateStates_(sites, table, offset);
 }
 
 /******************************************************************************/
 
 void SiteContainerTools::changeUnresolvedCharactersToGaps(SiteContainer& sites)
 {
-  // NB: use iterators for a better algorithm?
-  int gapCode = sites.getAlphabet()->getGapCharacterCode();
-  for (size_t i = 0; i < sites.getNumberOfSites(); i++)
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::changeUnresolvedCharactersToGaps");
+  const Alphabet* alpha = sites.getAlphabet();
+  vector<int> table;
+  int offset = initStateTable_(alpha, table);
+  int gapCode = alpha->getGapCharacterCode();
+  const vector<int>& states = alpha->getSupportedInts();
+  for (size_t k = 0; k < states.size(); ++k)
+  {
+    if (alpha->isUnresolved(states[k]))
+      table[static_cast<size_t>(states[k] - offset)] = gapCode;
+  }
+  translateStates_(sites, table, offset);
+}
+
+/******************************************************************************/
+
+void SiteContainerTools::changeMaskedToUnmaskedCharacters(SiteContainer& sites)
+{
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::changeMaskedToUnmaskedCharacters");
+  const CaseMaskedAlphabet* alpha = dynamic_cast<const CaseMaskedAlphabet*>(sites.getAlphabet());
+  if (!alpha)
+    throw AlphabetException("SiteContainerTools::changeMaskedToUnmaskedCharacters. Alignment alphabet should be of class 'CaseMaskedAlphabet'.", sites.getAlphabet());
+  vector<int> table;
+  int offset = initStateTable_(alpha, table);
+  const vector<int>& states = alpha->getSupportedInts();
+  for (size_t k = 0; k < states.size(); ++k)
+  {
+    table[static_cast<size_t>(states[k] - offset)] = alpha->getUnmaskedEquivalentState(states[k]);
+  }
+  translateStates_(sites, table, offset);
+}
+
+/******************************************************************************/
+
+VectorSiteContainer* SiteContainerTools::translate(const SiteContainer& sites, const Transliterator& transliterator)
+{
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::translate");
+  const Alphabet* alpha = sites.getAlphabet();
+  if (alpha->getAlphabetTypeId() != transliterator.getSourceAlphabet()->getAlphabetTypeId())
+    throw AlphabetMismatchException("SiteContainerTools::translate.", alpha, transliterator.getSourceAlphabet());
+  vector<int> table;
+  int offset = initStateTable_(alpha, table);
+  const vector<int>& states = alpha->getSupportedInts();
+  for (size_t k = 0; k < states.size(); ++k)
   {
-    for (unsigned int j = 0; j < sites.getNumberOfSequences(); j++)
+    int translated = NO_STATE_;
+    try
     {
-      int* element = &sites(j, i);
-      if (sites.getAlphabet()->isUnresolved(*element))
-        *element = gapCode;
+      translated = transliterator.translate(states[k]);
     }
+    catch (Exception&)
+    {
+      // Not an error yet: the state may not occur in the container.
+      // translateSites_ throws an AlphabetException if it does.
+    }
+    table[static_cast<size_t>(states[k] - offset)] = translated;
   }
+  VectorSiteContainer* result = translateSites_(sites, table, offset, transliterator.getTargetAlphabet(), NO_STATE_, 0, "SiteContainerTools::translate");
+  result->setGeneralComments(sites.getGeneralComments());
+  for (size_t i = 0; i < sites.getNumberOfSequences(); ++i)
+    result->setComments(i, sites.getComments(i));
+  return result;
 }
 
 /******************************************************************************/
 
 SiteContainer* SiteContainerTools::removeGapOnlySites(const SiteContainer& sites)
 {
-  vector<string> seqNames = sites.getSequencesNames();
-  VectorSiteContainer* noGapCont = new VectorSiteContainer(seqNames.size(), sites.getAlphabet());
-  noGapCont->setSequencesNames(seqNames, false);
-  for (size_t i = 0; i < sites.getNumberOfSites(); i++)
-  {
-    const Site* site = &sites.getSite(i);
-    if (!SiteTools::isGapOnly(*site))
-      noGapCont->addSite(*site);
-  }
-  return noGapCont;
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeGapOnlySites");
+  return getSelectedSites(sites, selectNonGapOnlySites(sites));
 }
 
 /******************************************************************************/
 
 void SiteContainerTools::removeGapOnlySites(SiteContainer& sites)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeGapOnlySites");
   size_t n = sites.getNumberOfSites();
   size_t i = n;
   while (i > 1)
@@ -265,22 +556,15 @@ void SiteContainerTools::removeGapOnlySites(SiteContainer& sites)
 
 SiteContainer* SiteContainerTools::removeGapOrUnresolvedOnlySites(const SiteContainer& sites)
 {
-  vector<string> seqNames = sites.getSequencesNames();
-  VectorSiteContainer* noGapCont = new VectorSiteContainer(seqNames.size(), sites.getAlphabet());
-  noGapCont->setSequencesNames(seqNames, false);
-  for (size_t i = 0; i < sites.getNumberOfSites(); i++)
-  {
-    const Site* site = &sites.getSite(i);
-    if (!SiteTools::isGapOrUnresolvedOnly(*site))
-      noGapCont->addSite(*site, false);
-  }
-  return noGapCont;
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeGapOrUnresolvedOnlySites");
+  return getSelectedSites(sites, selectNonGapOrUnresolvedOnlySites(sites));
 }
 
 /******************************************************************************/
 
 void SiteContainerTools::removeGapOrUnresolvedOnlySites(SiteContainer& sites)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeGapOrUnresolvedOnlySites");
   size_t n = sites.getNumberOfSites();
   size_t i = n;
   while (i > 1)
@@ -312,22 +596,15 @@ void SiteContainerTools::removeGapOrUnresolvedOnlySites(SiteContainer& sites)
 
 SiteContainer* SiteContainerTools::removeGapSites(const SiteContainer& sites, double maxFreqGaps)
 {
-  vector<string> seqNames = sites.getSequencesNames();
-  VectorSiteContainer* noGapCont = new VectorSiteContainer(seqNames.size(), sites.getAlphabet());
-  noGapCont->setSequencesNames(seqNames, false);
-  for (size_t i = 0; i < sites.getNumberOfSites(); ++i) {
-    map<int, double> freq;
-    SiteTools::getFrequencies(sites.getSite(i), freq);
-    if (freq[-1] <= maxFreqGaps)
-      noGapCont->addSite(sites.getSite(i), false);
-  }
-  return noGapCont;
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeGapSites");
+  return getSelectedSites(sites, selectSitesWithMaxGapFrequency(sites, maxFreqGaps));
 }
 
 /******************************************************************************/
 
 void SiteContainerTools::removeGapSites(SiteContainer& sites, double maxFreqGaps)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeGapSites");
   for (size_t i = sites.getNumberOfSites(); i > 0; --i) {
     map<int, double> freq;
     SiteTools::getFrequencies(sites.getSite(i - 1), freq);
@@ -340,25 +617,15 @@ void SiteContainerTools::removeGapSites(SiteContainer& sites, double maxFreqGaps
 
 SiteContainer* SiteContainerTools::removeStopCodonSites(const SiteContainer& sites, const GeneticCode& gCode)
 {
-  const CodonAlphabet* pca = dynamic_cast<const CodonAlphabet*>(sites.getAlphabet());
-  if (!pca)
-    throw AlphabetException("Not a Codon Alphabet", sites.getAlphabet());
-  vector<string> seqNames = sites.getSequencesNames();
-  VectorSiteContainer* noStopCont = new VectorSiteContainer(seqNames.size(), sites.getAlphabet());
-  noStopCont->setSequencesNames(seqNames, false);
-  for (size_t i = 0; i < sites.getNumberOfSites(); ++i)
-  {
-    const Site& site = sites.getSite(i);
-    if (!CodonSiteTools::hasStop(site, gCode))
-      noStopCont->addSite(site, false);
-  }
-  return noStopCont;
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeStopCodonSites");
+  return getSelectedSites(sites, selectSitesWithoutStopCodons(sites, gCode));
 }
 
 /******************************************************************************/
 
 void SiteContainerTools::removeStopCodonSites(SiteContainer& sites, const GeneticCode& gCode)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::removeStopCodonSites");
   const CodonAlphabet* pca = dynamic_cast<const CodonAlphabet*>(sites.getAlphabet());
   if (!pca)
     throw AlphabetException("Not a Codon Alphabet", sites.getAlphabet());
@@ -376,64 +643,54 @@ SiteContainer* SiteContainerTools::resolveDottedAlignment(
   const SiteContainer& dottedAln,
   const Alphabet* resolvedAlphabet)
 {
-  if (!AlphabetTools::isDefaultAlphabet(dottedAln.getAlphabet()))
-    throw AlphabetException("SiteContainerTools::resolveDottedAlignment. Alignment alphabet should of class 'DefaultAlphabet'.", dottedAln.getAlphabet());
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::resolveDottedAlignment");
+  const Alphabet* alpha = dottedAln.getAlphabet();
+  if (!AlphabetTools::isDefaultAlphabet(alpha))
+    throw AlphabetException("SiteContainerTools::resolveDottedAlignment. Alignment alphabet should of class 'DefaultAlphabet'.", alpha);
 
   // First we look for the reference sequence:
   size_t n = dottedAln.getNumberOfSequences();
   if (n == 0)
     throw Exception("SiteContainerTools::resolveDottedAlignment. Input alignment contains no sequence.");
 
-  const Sequence* refSeq = 0;
-  for (size_t i = 0; i < n; ++i) // Test each sequence
+  int dot = alpha->charToInt(".");
+  vector<bool> hasDot(n, false);
+  for (size_t i = 0; i < dottedAln.getNumberOfSites(); ++i)
   {
-    const Sequence* seq = &dottedAln.getSequence(i);
-    bool isRef = true;
-    for (size_t j = 0; isRef && j < seq->size(); ++j) // For each site in the sequence
-    {
-      if (seq->getChar(j) == ".")
-        isRef = false;
-    }
-    if (isRef) // We found the reference sequence!
+    SiteView site(dottedAln.getSite(i));
+    for (size_t j = 0; j < n; ++j)
     {
-      refSeq = new BasicSequence(*seq);
+      if (site[j] == dot)
+        hasDot[j] = true;
     }
   }
-  if (!refSeq)
+  size_t ref = static_cast<size_t>(find(hasDot.begin(), hasDot.end(), false) - hasDot.begin());
+  if (ref == n)
     throw Exception("SiteContainerTools::resolveDottedAlignment. No reference sequence was found in the input alignment.");
 
-  // Now we build a new VectorSiteContainer:
-  VectorSiteContainer* sites = new VectorSiteContainer(n, resolvedAlphabet);
-
-  // We add each site one by one:
-  size_t m = dottedAln.getNumberOfSites();
-  string state;
-  for (size_t i = 0; i < m; ++i)
+  // Each state is translated once into the output alphabet:
+  vector<int> table;
+  int offset = initStateTable_(alpha, table);
+  const vector<int>& states = alpha->getSupportedInts();
+  for (size_t k = 0; k < states.size(); ++k)
   {
-    string resolved = refSeq->getChar(i);
-    const Site* site = &dottedAln.getSite(i);
-    Site resolvedSite(resolvedAlphabet, site->getPosition());
-    for (size_t j = 0; j < n; ++j)
+    int translated = NO_STATE_;
+    if (states[k] != dot)
     {
-      state = site->getChar(j);
-      if (state == ".")
+      try
+      {
+        translated = resolvedAlphabet->charToInt(alpha->intToChar(states[k]));
+      }
+      catch (Exception&)
       {
-        state = resolved;
+        // Not an error yet: the character may not occur in the alignment.
+        // translateSites_ throws an AlphabetException if it does.
       }
-      resolvedSite.addElement(state);
     }
-    // Add the new site:
-    sites->addSite(resolvedSite);
+    table[static_cast<size_t>(states[k] - offset)] = translated;
   }
 
-  // Seq sequence names:
-  sites->setSequencesNames(dottedAln.getSequencesNames());
-
-  // Delete the copied sequence:
-  delete refSeq;
-
-  // Return result:
-  return sites;
+  return translateSites_(dottedAln, table, offset, resolvedAlphabet, dot, ref, "SiteContainerTools::resolveDottedAlignment");
 }
 
 /******************************************************************************/
@@ -449,7 +706,7 @@ std::map<size_t, size_t> SiteContainerTools::getSequencePositions(const Sequence
     if (seq[i] != -1)
     {
       count++;
-      tln[i + 1] = count;
+      tln.insert(tln.end(), make_pair(i + 1, count));
     }
   }
   return tln;
@@ -468,7 +725,7 @@ std::map<size_t, size_t> SiteContainerTools::getAlignmentPositions(const Sequenc
     if (seq[i] != -1)
     {
       count++;
-      tln[count] = i + 1;
+      tln.insert(tln.end(), make_pair(count, i + 1));
     }
   }
   return tln;
@@ -478,65 +735,21 @@ std::map<size_t, size_t> SiteContainerTools::getAlignmentPositions(const Sequenc
 
 std::map<size_t, size_t> SiteContainerTools::translateAlignment(const Sequence& seq1, const Sequence& seq2)
 {
-  if (seq1.getAlphabet()->getAlphabetType() != seq2.getAlphabet()->getAlphabetType())
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::translateAlignment");
+  if (seq1.getAlphabet()->getAlphabetTypeId() != seq2.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SiteContainerTools::translateAlignment", seq1.getAlphabet(), seq2.getAlphabet());
   map<size_t, size_t> tln;
-  if (seq1.size() == 0)
-    return tln;
-  unsigned int count1 = 0;
-  unsigned int count2 = 0;
-  if (seq2.size() == 0)
-    throw Exception("SiteContainerTools::translateAlignment. Sequences do not match at position " + TextTools::toString(count1 + 1) + " and " + TextTools::toString(count2 + 1) + ".");
-  int state1 = seq1[count1];
-  int state2 = seq2[count2];
-  bool end = false;
-  while (!end)
+  SequencePositionIndex index1(seq1);
+  SequencePositionIndex index2(seq2);
+  for (size_t i = 0; i < index1.getNumberOfResidues(); ++i)
   {
-    while (state1 == -1)
-    {
-      count1++;
-      if (count1 < seq1.size())
-        state1 = seq1[count1];
-      else
-        break;
-    }
-    while (state2 == -1)
-    {
-      count2++;
-      if (count2 < seq2.size())
-        state2 = seq2[count2];
-      else
-        break;
-    }
-    if (state1 != state2)
-      throw Exception("SiteContainerTools::translateAlignment. Sequences do not match at position " + TextTools::toString(count1 + 1) + " and " + TextTools::toString(count2 + 1) + ".");
-    tln[count1 + 1] = count2 + 1; // Count start at 1
-    if (count1 == seq1.size() - 1)
-      end = true;
-    else
-    {
-      if (count2 == seq2.size() - 1)
-      {
-        state1 = seq1[++count1];
-        while (state1 == -1)
-        {
-          count1++;
-          if (count1 < seq1.size())
-            state1 = seq1[count1];
-          else
-            break;
-        }
-        if (state1 == -1)
-          end = true;
-        else
-          throw Exception("SiteContainerTools::translateAlignment. Sequences do not match at position " + TextTools::toString(count1 + 1) + " and " + TextTools::toString(count2 + 1) + ".");
-      }
-      else
-      {
-        state1 = seq1[++count1];
-        state2 = seq2[++count2];
-      }
-    }
+    size_t pos1 = index1.getAlignmentPosition(i);
+    if (i >= index2.getNumberOfResidues())
+      throw Exception("SiteContainerTools::translateAlignment. Sequences do not match at position " + TextTools::toString(pos1 + 1) + " and " + TextTools::toString(seq2.size() + 1) + ".");
+    size_t pos2 = index2.getAlignmentPosition(i);
+    if (seq1[pos1] != seq2[pos2])
+      throw Exception("SiteContainerTools::translateAlignment. Sequences do not match at position " + TextTools::toString(pos1 + 1) + " and " + TextTools::toString(pos2 + 1) + ".");
+    tln.insert(tln.end(), make_pair(pos1 + 1, pos2 + 1)); // Count start at 1
   }
   return tln;
 }
@@ -545,46 +758,58 @@ std::map<size_t, size_t> SiteContainerTools::translateAlignment(const Sequence&
 
 std::map<size_t, size_t> SiteContainerTools::translateSequence(const SiteContainer& sequences, size_t i1, size_t i2)
 {
-  const Sequence* seq1 = &sequences.getSequence(i1);
-  const Sequence* seq2 = &sequences.getSequence(i2);
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::translateSequence");
+  SequencePositionIndex index1(sequences.getSequence(i1));
+  SequencePositionIndex index2(sequences.getSequence(i2));
   map<size_t, size_t> tln;
-  size_t count1 = 0; // Sequence 1 counter
-  size_t count2 = 0; // Sequence 2 counter
-  int state1;
-  int state2;
-  for (size_t i = 0; i <  sequences.getNumberOfSites(); i++)
+  for (size_t i = 0; i < index1.getNumberOfResidues(); ++i)
   {
-    state1 = (*seq1)[i];
-    if (state1 != -1)
-      count1++;
-    state2 = (*seq2)[i];
-    if (state2 != -1)
-      count2++;
-    if (state1 != -1)
-    {
-      tln[count1] = (state2 == -1 ? 0 : count2);
-    }
+    size_t pos = index1.getAlignmentPosition(i);
+    tln.insert(tln.end(), make_pair(i + 1, index2.isGap(pos) ? 0 : index2.getSequencePosition(pos) + 1));
   }
   return tln;
 }
 
 /******************************************************************************/
 
+namespace
+{
+  // Pairs of states used by the alignment but not scored by the original index raise the index's own exception:
+  void checkCompiledScores_(const CompiledAlphabetIndex2& scores, const AlphabetIndex2& s, const Sequence& seq1, const Sequence& seq2)
+  {
+    SymbolListSpan span1(seq1), span2(seq2);
+    set<int> states1(span1.begin(), span1.end());
+    set<int> states2(span2.begin(), span2.end());
+    for (set<int>::const_iterator it1 = states1.begin(); it1 != states1.end(); ++it1)
+    {
+      for (set<int>::const_iterator it2 = states2.begin(); it2 != states2.end(); ++it2)
+      {
+        if (!scores.isDefined(*it1, *it2))
+          s.getIndex(*it1, *it2);
+      }
+    }
+  }
+}
+
 AlignedSequenceContainer* SiteContainerTools::alignNW(
   const Sequence& seq1,
   const Sequence& seq2,
   const AlphabetIndex2& s,
   double gap)
 {
-  if (seq1.getAlphabet()->getAlphabetType() != seq2.getAlphabet()->getAlphabetType())
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::alignNW");
+  if (seq1.getAlphabet()->getAlphabetTypeId() != seq2.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SiteContainerTools::alignNW", seq1.getAlphabet(), seq2.getAlphabet());
-  if (seq1.getAlphabet()->getAlphabetType() != s.getAlphabet()->getAlphabetType())
+  if (seq1.getAlphabet()->getAlphabetTypeId() != s.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SiteContainerTools::alignNW", seq1.getAlphabet(), s.getAlphabet());
   // Check that sequences have no gap!
   unique_ptr<Sequence> s1(seq1.clone());
   SequenceTools::removeGaps(*s1);
   unique_ptr<Sequence> s2(seq2.clone());
   SequenceTools::removeGaps(*s2);
+  // Compile scores once:
+  unique_ptr<CompiledAlphabetIndex2> scores(s.compile());
+  checkCompiledScores_(*scores, s, *s1, *s2);
 
   // 1) Initialize matrix:
   RowMatrix<double> m(s1->size() + 1, s2->size() + 1);
@@ -603,7 +828,7 @@ AlignedSequenceContainer* SiteContainerTools::alignNW(
   {
     for (size_t j = 1; j <= s2->size(); j++)
     {
-      choice1 = m(i - 1, j - 1) + static_cast<double>(s.getIndex((*s1)[i - 1], (*s2)[j - 1]));
+      choice1 = m(i - 1, j - 1) + scores->getScore((*s1)[i - 1], (*s2)[j - 1]);
       choice2 = m(i - 1, j) + gap;
       choice3 = m(i, j - 1) + gap;
       mx = choice1; px = 'd'; // Default in case of equality of scores.
@@ -676,15 +901,19 @@ AlignedSequenceContainer* SiteContainerTools::alignNW(
   double opening,
   double extending)
 {
-  if (seq1.getAlphabet()->getAlphabetType() != seq2.getAlphabet()->getAlphabetType())
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::alignNW");
+  if (seq1.getAlphabet()->getAlphabetTypeId() != seq2.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SiteContainerTools::alignNW", seq1.getAlphabet(), seq2.getAlphabet());
-  if (seq1.getAlphabet()->getAlphabetType() != s.getAlphabet()->getAlphabetType())
+  if (seq1.getAlphabet()->getAlphabetTypeId() != s.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SiteContainerTools::alignNW", seq1.getAlphabet(), s.getAlphabet());
   // Check that sequences have no gap!
   unique_ptr<Sequence> s1(seq1.clone());
   SequenceTools::removeGaps(*s1);
   unique_ptr<Sequence> s2(seq2.clone());
   SequenceTools::removeGaps(*s2);
+  // Compile scores once:
+  unique_ptr<CompiledAlphabetIndex2> scores(s.compile());
+  checkCompiledScores_(*scores, s, *s1, *s2);
 
   // 1) Initialize matrix:
   RowMatrix<double> m(s1->size() + 1, s2->size() + 1);
@@ -716,7 +945,7 @@ AlignedSequenceContainer* SiteContainerTools::alignNW(
   {
     for (size_t j = 1; j <= s2->size(); j++)
     {
-      choice1 = m(i - 1, j - 1) + s.getIndex((*s1)[i - 1], (*s2)[j - 1]);
+      choice1 = m(i - 1, j - 1) + scores->getScore((*s1)[i - 1], (*s2)[j - 1]);
       choice2 = h(i - 1, j - 1) + opening + extending;
       choice3 = v(i - 1, j - 1) + opening + extending;
       mx = choice1; // Default in case of equality of scores.
@@ -808,6 +1037,7 @@ AlignedSequenceContainer* SiteContainerTools::alignNW(
 
 VectorSiteContainer* SiteContainerTools::sampleSites(const SiteContainer& sites, size_t nbSites, vector<size_t>* index)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::sampleSites");
   VectorSiteContainer* sample = new VectorSiteContainer(sites.getSequencesNames(), sites.getAlphabet());
   for (size_t i = 0; i < nbSites; i++)
   {
@@ -823,6 +1053,7 @@ VectorSiteContainer* SiteContainerTools::sampleSites(const SiteContainer& sites,
 
 VectorSiteContainer* SiteContainerTools::bootstrapSites(const SiteContainer& sites)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::bootstrapSites");
   return sampleSites(sites, sites.getNumberOfSites());
 }
 
@@ -837,9 +1068,10 @@ const string SiteContainerTools::SIMILARITY_NOGAP       = "no gap";
 
 double SiteContainerTools::computeSimilarity(const Sequence& seq1, const Sequence& seq2, bool dist, const std::string& gapOption, bool unresolvedAsGap)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::computeSimilarity");
   if (seq1.size() != seq2.size())
     throw SequenceNotAlignedException("SiteContainerTools::computeSimilarity.", &seq2);
-  if (seq1.getAlphabet()->getAlphabetType() != seq2.getAlphabet()->getAlphabetType())
+  if (seq1.getAlphabet()->getAlphabetTypeId() != seq2.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SiteContainerTools::computeSimilarity.", seq1.getAlphabet(), seq2.getAlphabet());
 
   const Alphabet* alpha = seq1.getAlphabet();
@@ -892,6 +1124,7 @@ double SiteContainerTools::computeSimilarity(const Sequence& seq1, const Sequenc
 
 DistanceMatrix* SiteContainerTools::computeSimilarityMatrix(const SiteContainer& sites, bool dist, const std::string& gapOption, bool unresolvedAsGap)
 {
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::computeSimilarityMatrix");
   size_t n = sites.getNumberOfSequences();
   DistanceMatrix* mat = new DistanceMatrix(sites.getSequencesNames());
   string pairwiseGapOption = gapOption;
@@ -935,7 +1168,8 @@ DistanceMatrix* SiteContainerTools::computeSimilarityMatrix(const SiteContainer&
 
 void SiteContainerTools::merge(SiteContainer& seqCont1, const SiteContainer& seqCont2, bool leavePositionAsIs)
 {
-  if (seqCont1.getAlphabet()->getAlphabetType() != seqCont2.getAlphabet()->getAlphabetType())
+  BPP_SEQ_TIME_SCOPE("SiteContainerTools::merge");
+  if (seqCont1.getAlphabet()->getAlphabetTypeId() != seqCont2.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SiteContainerTools::merge.", seqCont1.getAlphabet(), seqCont2.getAlphabet());
 
 
@@ -1002,43 +1236,8 @@ vector<int> SiteContainerTools::getColumnScores(const Matrix<size_t>& positions1
 {
   if (positions1.getNumberOfRows() != positions2.getNumberOfRows())
     throw Exception("SiteContainerTools::getColumnScores. The two input alignments must have the same number of sequences!");
-  vector<int> scores(positions1.getNumberOfColumns());
-  for (size_t i = 0; i < positions1.getNumberOfColumns(); ++i) {
-    //Find an anchor point:
-    size_t whichSeq = 0;
-    size_t whichPos = 0;
-    for (size_t j = 0; j < positions1.getNumberOfRows(); ++j) {
-      if (positions1(j, i) > 0) {
-        whichSeq = j;
-        whichPos = positions1(j, i);
-        break;
-      }
-    }
-    if (whichPos == 0) {
-      //No anchor found, this alignment column is only made of gaps. We assign a score of 'na' and move to the next column.
-      scores[i] = na;
-      continue;
-    }
-    //We look for the anchor in the reference alignment:
-    size_t i2 = 0;
-    bool found = false;
-    for (size_t j = 0; !found && j < positions2.getNumberOfColumns(); ++j) {
-      if (positions2(whichSeq, j) == whichPos) {
-        i2 = j;
-        found = true;
-      }
-    }
-    if (!found) {
-      throw Exception("SiteContainerTools::getColumnScores(). Position " + TextTools::toString(whichPos) + " of sequence " + TextTools::toString(whichSeq) + " not found in reference alignment. Please make sure the two indexes are built from the same data!");
-    }
-    //Now we compare all pairs of sequences between the two positions:
-    bool test = true;
-    for (size_t j = 0; test && j < positions1.getNumberOfRows(); ++j) {
-      test = (positions1(j, i) == positions2(j, i2));
-    }
-    scores[i] = test ? 1 : 0;
-  }
-  return scores;
+  AlignmentComparison comparison(positions2);
+  return comparison.getColumnScores(positions1, na);
 }
 
 /******************************************************************************/
@@ -1047,47 +1246,8 @@ vector<double> SiteContainerTools::getSumOfPairsScores(const Matrix<size_t>& pos
 {
   if (positions1.getNumberOfRows() != positions2.getNumberOfRows())
     throw Exception("SiteContainerTools::getColumnScores. The two input alignments must have the same number of sequences!");
-  vector<double> scores(positions1.getNumberOfColumns());
-  for (size_t i = 0; i < positions1.getNumberOfColumns(); ++i) {
-    //For all positions in alignment 1...
-    size_t countAlignable = 0;
-    size_t countAligned   = 0;
-    for (size_t j = 0; j < positions1.getNumberOfRows(); ++j) {
-      //Get the corresponding column in alignment 2:
-      size_t whichPos = positions1(j, i);
-      if (whichPos == 0) {
-        //No position for this sequence here.
-        continue;
-      }
-      //We look for the position in the second alignment:
-      size_t i2 = 0;
-      bool found = false;
-      for (size_t k = 0; !found && k < positions2.getNumberOfColumns(); ++k) {
-        if (positions2(j, k) == whichPos) {
-          i2 = k;
-          found = true;
-        }
-      }
-      if (!found) {
-        throw Exception("SiteContainerTools::getColumnScores(). Position " + TextTools::toString(whichPos) + " of sequence " + TextTools::toString(j) + " not found in reference alignment. Please make sure the two indexes are built from the same data!");
-      }
-
-      //Now we check all other positions and see if they are aligned with this one:
-      for (size_t k = j + 1; k < positions1.getNumberOfRows(); ++k) {
-        size_t whichPos2 = positions1(k, i);
-        if (whichPos2 == 0) {
-          //Empty position
-          continue;
-        }
-        countAlignable++;
-        //check position in alignment 2:
-        if (positions2(k, i2) == whichPos2)
-          countAligned++;
-      }
-    }
-    scores[i] = countAlignable == 0 ? na : static_cast<double>(countAligned) / static_cast<double>(countAlignable);
-  }
-  return scores;
+  AlignmentComparison comparison(positions2);
+  return comparison.getSumOfPairsScores(positions1, na);
 }
 
 /******************************************************************************/
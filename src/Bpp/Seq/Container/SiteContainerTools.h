@@ -46,6 +46,7 @@
 #include "../AlphabetIndex/AlphabetIndex2.h"
 #include "../DistanceMatrix.h"
 #include "../GeneticCode/GeneticCode.h"
+#include "../Transliterator.h"
 #include <Bpp/Numeric/Matrix/Matrix.h>
 
 //From the STL:
@@ -165,6 +166,56 @@ namespace bpp
      */
     static void removeStopCodonSites(SiteContainer& sites, const GeneticCode& gCode);
 
+    /**
+     * @name Site selections
+     *
+     * These functions return the indices of the sites satisfying a given criterion, without copying any site.
+     * The corresponding container can be built when needed with getSelectedSites.
+     *
+     * @{
+     */
+
+    /**
+     * @param sites The container to analyse.
+     * @return The indices of sites without gaps.
+     */
+    static SiteSelection selectSitesWithoutGaps(const SiteContainer& sites);
+
+    /**
+     * @param sites The container to analyse.
+     * @return The indices of complete sites, i.e. sites with fully resolved states (no gap, no unknown caracters).
+     */
+    static SiteSelection selectCompleteSites(const SiteContainer& sites);
+
+    /**
+     * @param sites The container to analyse.
+     * @return The indices of sites with at least one character which is not a gap.
+     */
+    static SiteSelection selectNonGapOnlySites(const SiteContainer& sites);
+
+    /**
+     * @param sites The container to analyse.
+     * @return The indices of sites with at least one resolved character.
+     */
+    static SiteSelection selectNonGapOrUnresolvedOnlySites(const SiteContainer& sites);
+
+    /**
+     * @param sites The container to analyse.
+     * @param maxFreqGaps The maximum frequency of gaps in each site.
+     * @return The indices of sites with a frequency of gaps lower or equal to maxFreqGaps.
+     */
+    static SiteSelection selectSitesWithMaxGapFrequency(const SiteContainer& sites, double maxFreqGaps);
+
+    /**
+     * @param sites The container to analyse, with a codon alphabet.
+     * @param gCode the genetic code to use to determine stop codons.
+     * @return The indices of sites without stop codons.
+     * @throw AlphabetException If the alphabet of the container is not a codon alphabet.
+     */
+    static SiteSelection selectSitesWithoutStopCodons(const SiteContainer& sites, const GeneticCode& gCode);
+
+    /** @} */
+
     /**
      * @brief Create a new container with a specified set of sites.
      *
@@ -178,6 +229,7 @@ namespace bpp
      * @param sequences The container from wich sequences are to be taken.
      * @param selection The positions of all sites to retrieve.
      * @return A new container with all selected sites.
+     * @see SiteContainerView for a read-only selection without copy.
      */
     static SiteContainer* getSelectedSites(const SiteContainer& sequences, const SiteSelection& selection);
 
@@ -202,6 +254,19 @@ namespace bpp
     
     static SiteContainer* getSelectedPositions(const SiteContainer& sequences, const SiteSelection& selection);
 
+    /**
+     * @brief Convert a selection of positions into a selection of sites.
+     *
+     * Positions are specified by their indice, beginning at 0, and are converted to site
+     * indices given the length of the words of the alphabet (see getSelectedPositions).
+     *
+     * @param sequences The container the positions refer to.
+     * @param selection The positions to convert.
+     * @return The corresponding site indices.
+     * @throw IOException If the selection does not contain complete words.
+     */
+    static SiteSelection getSitesFromPositions(const SiteContainer& sequences, const SiteSelection& selection);
+
     /**
      * @brief create the consensus sequence of the alignment.
      *
@@ -213,9 +278,21 @@ namespace bpp
      * @param resolveUnknown Tell is unknnown characters must resolved. In a DNA sequence for instance, N will be counted as A=1/4, T=1/4, G=1/4 and C=1/4. Otherwise it will be counted as N=1.
      * If this option is set to true, a consensus sequence will never contain an unknown character.
      * @return A new Sequence object with the consensus sequence.
+     * @see AlignmentProfile for frequencies, log-odds scores and entropies of all sites.
      */
     static Sequence* getConsensus(const SiteContainer& sc, const std::string& name = "consensus", bool ignoreGap = true, bool resolveUnknown = false);
     
+    /**
+     * @name Whole alignment state transformations
+     *
+     * These functions translate all states of a container through a look-up table built once
+     * from its alphabet. VectorSiteContainer objects are modified in place, directly in the
+     * storage of their sites, by blocks of consecutive sites processed in parallel when OpenMP
+     * is available. Other containers are modified one state at a time.
+     *
+     * @{
+     */
+
     /**
      * @brief Change all gaps to unknown state in a container, according to its alphabet.
      *
@@ -234,6 +311,30 @@ namespace bpp
      */
     static void changeUnresolvedCharactersToGaps(SiteContainer& sites);
 
+    /**
+     * @brief Change all masked (lower case) states to their unmasked equivalent.
+     *
+     * @param sites The container to be modified, with a CaseMaskedAlphabet.
+     * @throw AlphabetException If the alphabet of the container is not a CaseMaskedAlphabet.
+     */
+    static void changeMaskedToUnmaskedCharacters(SiteContainer& sites);
+
+    /**
+     * @brief Translate a container into another alphabet.
+     *
+     * Each state of the source alphabet is translated once, to build a look-up table.
+     * Sites are then translated by blocks, in parallel when OpenMP is available.
+     *
+     * @param sites The container to translate, with the source alphabet of the transliterator.
+     * @param transliterator The translation rules.
+     * @return A new container with the target alphabet of the transliterator.
+     * @throw AlphabetMismatchException If the alphabet of the container is not the source alphabet of the transliterator.
+     * @throw AlphabetException If a state of the container can not be translated.
+     */
+    static VectorSiteContainer* translate(const SiteContainer& sites, const Transliterator& transliterator);
+
+    /** @} */
+
     /**
      * @brief Resolve a container with "." notations.
      *
@@ -267,7 +368,7 @@ namespace bpp
     /**
      * @name Sequences coordinates.
      *
-     * @see SequenceWalker For an alternative approach.
+     * @see SequenceWalker, SequencePositionIndex For an alternative approach.
      * @{
      */
 
@@ -391,6 +492,7 @@ namespace bpp
      *
      * @param sites An input alignment to sample.
      * @return A sampled alignment with the same number of sites than the input one.
+     * @see SiteResampler for generating many replicates without copying sites.
      */
     static VectorSiteContainer* bootstrapSites(const SiteContainer& sites);
 
@@ -478,6 +580,7 @@ namespace bpp
      * @param na         The score to use if the tested column is full of gap.
      * @return A vector of score, as 0 or 1.
      * @see getSequencePositions for creating the alignment indexes.
+     * @see AlignmentComparison for comparing several alignments to the same reference, and for global scores.
      * @warning The indexes for the two alignments must have the sequences in the exact same order!
      * @author Julien Dutheil
      */
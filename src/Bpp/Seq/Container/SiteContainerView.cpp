@@ -0,0 +1,312 @@
+//
+// File: SiteContainerView.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "SiteContainerView.h"
+#include "SequenceContainerExceptions.h"
+#include "../SiteView.h"
+
+using namespace bpp;
+using namespace std;
+
+/******************************************************************************/
+
+SiteContainerView::SiteContainerView(const SiteContainer& parent, const vector<size_t>& sites) :
+  AbstractSequenceContainer(parent.getAlphabet()),
+  parent_(0),
+  siteIndices_(),
+  sequenceIndices_(),
+  names_(),
+  allSequences_(true),
+  sites_(),
+  sequences_()
+{
+  vector<size_t> sequences(parent.getNumberOfSequences());
+  for (size_t i = 0; i < sequences.size(); ++i)
+    sequences[i] = i;
+  init_(parent, sites, sequences);
+}
+
+/******************************************************************************/
+
+SiteContainerView::SiteContainerView(const SiteContainer& parent, const vector<size_t>& sites, const vector<size_t>& sequences) :
+  AbstractSequenceContainer(parent.getAlphabet()),
+  parent_(0),
+  siteIndices_(),
+  sequenceIndices_(),
+  names_(),
+  allSequences_(true),
+  sites_(),
+  sequences_()
+{
+  init_(parent, sites, sequences);
+}
+
+/******************************************************************************/
+
+SiteContainerView::SiteContainerView(const SiteContainerView& view) :
+  AbstractSequenceContainer(view),
+  parent_(view.parent_),
+  siteIndices_(view.siteIndices_),
+  sequenceIndices_(view.sequenceIndices_),
+  names_(view.names_),
+  allSequences_(view.allSequences_),
+  sites_(view.sites_.size(), 0),
+  sequences_(view.sequences_.size(), 0)
+{}
+
+/******************************************************************************/
+
+SiteContainerView& SiteContainerView::operator=(const SiteContainerView& view)
+{
+  clearCache_();
+  AbstractSequenceContainer::operator=(view);
+  parent_          = view.parent_;
+  siteIndices_     = view.siteIndices_;
+  sequenceIndices_ = view.sequenceIndices_;
+  names_           = view.names_;
+  allSequences_    = view.allSequences_;
+  sites_.assign(view.sites_.size(), 0);
+  sequences_.assign(view.sequences_.size(), 0);
+  return *this;
+}
+
+/******************************************************************************/
+
+void SiteContainerView::init_(const SiteContainer& parent, const vector<size_t>& sites, const vector<size_t>& sequences)
+{
+  size_t nbSites = parent.getNumberOfSites();
+  size_t nbSequences = parent.getNumberOfSequences();
+  for (size_t i = 0; i < sites.size(); ++i)
+  {
+    if (sites[i] >= nbSites)
+      throw IndexOutOfBoundsException("SiteContainerView. Invalid site index.", sites[i], 0, nbSites - 1);
+  }
+  for (size_t i = 0; i < sequences.size(); ++i)
+  {
+    if (sequences[i] >= nbSequences)
+      throw IndexOutOfBoundsException("SiteContainerView. Invalid sequence index.", sequences[i], 0, nbSequences - 1);
+  }
+
+  // Views of views refer to the original container:
+  const SiteContainerView* view = dynamic_cast<const SiteContainerView*>(&parent);
+  if (view)
+  {
+    parent_ = view->parent_;
+    siteIndices_.resize(sites.size());
+    for (size_t i = 0; i < sites.size(); ++i)
+      siteIndices_[i] = view->siteIndices_[sites[i]];
+    sequenceIndices_.resize(sequences.size());
+    for (size_t i = 0; i < sequences.size(); ++i)
+      sequenceIndices_[i] = view->sequenceIndices_[sequences[i]];
+  }
+  else
+  {
+    parent_ = &parent;
+    siteIndices_ = sites;
+    sequenceIndices_ = sequences;
+  }
+
+  allSequences_ = sequenceIndices_.size() == parent_->getNumberOfSequences();
+  names_.resize(sequenceIndices_.size());
+  for (size_t i = 0; i < sequenceIndices_.size(); ++i)
+  {
+    names_[i] = parent_->getName(sequenceIndices_[i]);
+    if (sequenceIndices_[i] != i)
+      allSequences_ = false;
+  }
+  sites_.assign(siteIndices_.size(), 0);
+  sequences_.assign(sequenceIndices_.size(), 0);
+  setGeneralComments(parent.getGeneralComments());
+}
+
+/******************************************************************************/
+
+void SiteContainerView::clearCache_()
+{
+  for (size_t i = 0; i < sites_.size(); ++i)
+  {
+    delete sites_[i];
+    sites_[i] = 0;
+  }
+  for (size_t i = 0; i < sequences_.size(); ++i)
+  {
+    delete sequences_[i];
+    sequences_[i] = 0;
+  }
+}
+
+/******************************************************************************/
+
+const Site& SiteContainerView::getSite(size_t siteIndex) const
+{
+  if (siteIndex >= getNumberOfSites())
+    throw IndexOutOfBoundsException("SiteContainerView::getSite.", siteIndex, 0, getNumberOfSites() - 1);
+  if (allSequences_)
+    return parent_->getSite(siteIndices_[siteIndex]);
+  if (!sites_[siteIndex])
+  {
+    SiteView column(parent_->getSite(siteIndices_[siteIndex]));
+    vector<int> states(sequenceIndices_.size());
+    for (size_t i = 0; i < states.size(); ++i)
+      states[i] = column[sequenceIndices_[i]];
+    sites_[siteIndex] = new Site(states, getAlphabet(), column.getPosition());
+  }
+  return *sites_[siteIndex];
+}
+
+/******************************************************************************/
+
+Vint SiteContainerView::getSitePositions() const
+{
+  Vint parentPositions = parent_->getSitePositions();
+  Vint positions(siteIndices_.size());
+  for (size_t i = 0; i < siteIndices_.size(); ++i)
+    positions[i] = parentPositions[siteIndices_[i]];
+  return positions;
+}
+
+/******************************************************************************/
+
+const Sequence& SiteContainerView::getSequence(size_t sequenceIndex) const
+{
+  if (sequenceIndex >= getNumberOfSequences())
+    throw IndexOutOfBoundsException("SiteContainerView::getSequence.", sequenceIndex, 0, getNumberOfSequences() - 1);
+  if (!sequences_[sequenceIndex])
+  {
+    size_t row = sequenceIndices_[sequenceIndex];
+    vector<int> states(siteIndices_.size());
+    for (size_t i = 0; i < states.size(); ++i)
+      states[i] = (*parent_)(row, siteIndices_[i]);
+    sequences_[sequenceIndex] = new BasicSequence(names_[sequenceIndex], states, parent_->getComments(row), getAlphabet());
+  }
+  return *sequences_[sequenceIndex];
+}
+
+/******************************************************************************/
+
+bool SiteContainerView::hasSequence(const string& name) const
+{
+  for (size_t pos = 0; pos < names_.size(); pos++)
+  {
+    if (names_[pos] == name)
+      return true;
+  }
+  return false;
+}
+
+/******************************************************************************/
+
+size_t SiteContainerView::getSequencePosition(const string& name) const
+{
+  for (size_t pos = 0; pos < names_.size(); pos++)
+  {
+    if (names_[pos] == name)
+      return pos;
+  }
+  throw SequenceNotFoundException("SiteContainerView::getSequencePosition().", name);
+}
+
+/******************************************************************************/
+
+const string& SiteContainerView::getName(size_t sequenceIndex) const
+{
+  if (sequenceIndex >= getNumberOfSequences())
+    throw IndexOutOfBoundsException("SiteContainerView::getName.", sequenceIndex, 0, getNumberOfSequences() - 1);
+  return names_[sequenceIndex];
+}
+
+/******************************************************************************/
+
+const Comments& SiteContainerView::getComments(size_t sequenceIndex) const
+{
+  if (sequenceIndex >= getNumberOfSequences())
+    throw IndexOutOfBoundsException("SiteContainerView::getComments.", sequenceIndex, 0, getNumberOfSequences() - 1);
+  return parent_->getComments(sequenceIndices_[sequenceIndex]);
+}
+
+/******************************************************************************/
+
+void SiteContainerView::clear()
+{
+  clearCache_();
+  siteIndices_.clear();
+  sequenceIndices_.clear();
+  names_.clear();
+  sites_.clear();
+  sequences_.clear();
+  allSequences_ = false;
+}
+
+/******************************************************************************/
+
+VectorSiteContainer* SiteContainerView::createEmptyContainer() const
+{
+  VectorSiteContainer* vsc = new VectorSiteContainer(getAlphabet());
+  vsc->setGeneralComments(getGeneralComments());
+  return vsc;
+}
+
+/******************************************************************************/
+
+VectorSiteContainer* SiteContainerView::materialize() const
+{
+  VectorSiteContainer* vsc = new VectorSiteContainer(names_, getAlphabet());
+  vsc->setGeneralComments(getGeneralComments());
+  for (size_t i = 0; i < names_.size(); ++i)
+    vsc->setComments(i, getComments(i));
+  vector<int> states(sequenceIndices_.size());
+  for (size_t j = 0; j < siteIndices_.size(); ++j)
+  {
+    if (allSequences_ || sites_[j])
+    {
+      vsc->addSite(getSite(j), false);
+    }
+    else
+    {
+      SiteView column(parent_->getSite(siteIndices_[j]));
+      for (size_t i = 0; i < states.size(); ++i)
+        states[i] = column[sequenceIndices_[i]];
+      vsc->addSite(Site(states, getAlphabet(), column.getPosition()), false);
+    }
+  }
+  return vsc;
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,322 @@
+//
+// File: SiteContainerView.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _SITECONTAINERVIEW_H_
+#define _SITECONTAINERVIEW_H_
+
+#include "SiteContainer.h"
+#include "AbstractSequenceContainer.h"
+#include "VectorSiteContainer.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief A read-only subset of a site container, defined by the indices of the selected sites and sequences.
+ *
+ * The view does not copy any data: it stores a pointer toward the parent container,
+ * and the indices of the selected sites and sequences. When all sequences are selected,
+ * sites are directly returned from the parent container. Otherwise, and for sequences,
+ * the requested objects are built on first access and kept for later calls.
+ *
+ * A view of a view refers directly to the original container, with composed indices,
+ * so that views can be nested at no cost.
+ *
+ * The view is only valid as long as the parent container exists and is not modified.
+ * All modifying methods throw a NotImplementedException. Use materialize() to get a
+ * standalone, modifiable copy.
+ *
+ * @warning The SiteContainer interface requires non-const overloads of valueAt() and operator(),
+ * which return modifiable references and therefore also throw. States must be read through a const
+ * reference or pointer to the view (or to the SiteContainer it implements), e.g.
+ * <code>const SiteContainer& sc = view; sc(i, j);</code>
+ *
+ * @see SiteContainerTools::getSelectedSites for a copying equivalent.
+ */
+class SiteContainerView :
+  public AbstractSequenceContainer,
+  public virtual SiteContainer
+{
+private:
+  const SiteContainer* parent_;
+  std::vector<size_t> siteIndices_;
+  std::vector<size_t> sequenceIndices_;
+  std::vector<std::string> names_;
+  bool allSequences_;
+  mutable std::vector<Site*> sites_;
+  mutable std::vector<Sequence*> sequences_;
+
+public:
+  /**
+   * @brief Build a view with all sequences and a subset of the sites of a container.
+   *
+   * @param parent The container to view.
+   * @param sites The indices of the sites to select, in the parent container.
+   * @throw IndexOutOfBoundsException If an index is not valid.
+   */
+  SiteContainerView(const SiteContainer& parent, const std::vector<size_t>& sites);
+
+  /**
+   * @brief Build a view with a subset of the sites and sequences of a container.
+   *
+   * @param parent The container to view.
+   * @param sites The indices of the sites to select, in the parent container.
+   * @param sequences The indices of the sequences to select, in the parent container.
+   * @throw IndexOutOfBoundsException If an index is not valid.
+   */
+  SiteContainerView(const SiteContainer& parent, const std::vector<size_t>& sites, const std::vector<size_t>& sequences);
+
+  SiteContainerView(const SiteContainerView& view);
+
+  SiteContainerView& operator=(const SiteContainerView& view);
+
+  virtual ~SiteContainerView() { clearCache_(); }
+
+public:
+  /**
+   * @name The Clonable interface.
+   * @{
+   */
+  SiteContainerView* clone() const { return new SiteContainerView(*this); }
+  /** @} */
+
+  /**
+   * @return The original container.
+   */
+  const SiteContainer& getParent() const { return *parent_; }
+
+  /**
+   * @return The indices of the selected sites in the original container.
+   */
+  const std::vector<size_t>& getSiteIndices() const { return siteIndices_; }
+
+  /**
+   * @return The indices of the selected sequences in the original container.
+   */
+  const std::vector<size_t>& getSequenceIndices() const { return sequenceIndices_; }
+
+  /**
+   * @brief Copy the selected data into a new container.
+   *
+   * @return A newly allocated container, independent of the original one.
+   */
+  VectorSiteContainer* materialize() const;
+
+  /**
+   * @name The SiteContainer interface implementation:
+   * @{
+   */
+  const Site& getSite(size_t siteIndex) const;
+  size_t getNumberOfSites() const { return siteIndices_.size(); }
+  Vint getSitePositions() const;
+
+  void setSite(size_t siteIndex, const Site& site, bool checkPosition = true)
+  {
+    throw NotImplementedException("SiteContainerView::setSite. Views are read-only.");
+  }
+
+  void addSite(const Site& site, bool checkPosition = true)
+  {
+    throw NotImplementedException("SiteContainerView::addSite. Views are read-only.");
+  }
+
+  void addSite(const Site& site, int position, bool checkPosition = true)
+  {
+    throw NotImplementedException("SiteContainerView::addSite. Views are read-only.");
+  }
+
+  void addSite(const Site& site, size_t siteIndex, bool checkPosition = true)
+  {
+    throw NotImplementedException("SiteContainerView::addSite. Views are read-only.");
+  }
+
+  void addSite(const Site& site, size_t siteIndex, int position, bool checkPosition = true)
+  {
+    throw NotImplementedException("SiteContainerView::addSite. Views are read-only.");
+  }
+
+  Site* removeSite(size_t siteIndex)
+  {
+    throw NotImplementedException("SiteContainerView::removeSite. Views are read-only.");
+  }
+
+  void deleteSite(size_t siteIndex)
+  {
+    throw NotImplementedException("SiteContainerView::deleteSite. Views are read-only.");
+  }
+
+  void deleteSites(size_t siteIndex, size_t length)
+  {
+    throw NotImplementedException("SiteContainerView::deleteSites. Views are read-only.");
+  }
+
+  void reindexSites()
+  {
+    throw NotImplementedException("SiteContainerView::reindexSites. Views are read-only.");
+  }
+  /** @} */
+
+  /**
+   * @name The SequenceContainer interface.
+   * @{
+   */
+  const Sequence& getSequence(size_t sequenceIndex) const;
+  const Sequence& getSequence(const std::string& name) const
+  {
+    return getSequence(getSequencePosition(name));
+  }
+  bool hasSequence(const std::string& name) const;
+  size_t getSequencePosition(const std::string& name) const;
+  size_t getNumberOfSequences() const { return sequenceIndices_.size(); }
+  std::vector<std::string> getSequencesNames() const { return names_; }
+  const std::string& getName(size_t sequenceIndex) const;
+  const Comments& getComments(size_t sequenceIndex) const;
+  const Comments& getComments(const std::string& name) const
+  {
+    return getComments(getSequencePosition(name));
+  }
+
+  void setComments(size_t sequenceIndex, const Comments& comments)
+  {
+    throw NotImplementedException("SiteContainerView::setComments. Views are read-only.");
+  }
+
+  void setSequencesNames(const std::vector<std::string>& names, bool checkNames = true)
+  {
+    throw NotImplementedException("SiteContainerView::setSequencesNames. Views are read-only.");
+  }
+
+  void addSequence(const Sequence& sequence, bool checkName = true)
+  {
+    throw NotImplementedException("SiteContainerView::addSequence. Views are read-only.");
+  }
+
+  void setSequence(const std::string& name, const Sequence& sequence, bool checkName)
+  {
+    throw NotImplementedException("SiteContainerView::setSequence. Views are read-only.");
+  }
+
+  void setSequence(size_t sequenceIndex, const Sequence& sequence, bool checkName)
+  {
+    throw NotImplementedException("SiteContainerView::setSequence. Views are read-only.");
+  }
+
+  Sequence* removeSequence(size_t sequenceIndex)
+  {
+    throw NotImplementedException("SiteContainerView::removeSequence. Views are read-only.");
+  }
+
+  Sequence* removeSequence(const std::string& name)
+  {
+    throw NotImplementedException("SiteContainerView::removeSequence. Views are read-only.");
+  }
+
+  void deleteSequence(size_t sequenceIndex)
+  {
+    throw NotImplementedException("SiteContainerView::deleteSequence. Views are read-only.");
+  }
+
+  void deleteSequence(const std::string& name)
+  {
+    throw NotImplementedException("SiteContainerView::deleteSequence. Views are read-only.");
+  }
+
+  /**
+   * @brief Empty the view. The parent container is not modified.
+   */
+  void clear();
+
+  VectorSiteContainer* createEmptyContainer() const;
+
+  const int& valueAt(const std::string& sequenceName, size_t elementIndex) const
+  {
+    return valueAt(getSequencePosition(sequenceName), elementIndex);
+  }
+  const int& valueAt(size_t sequenceIndex, size_t elementIndex) const
+  {
+    if (sequenceIndex >= getNumberOfSequences()) throw IndexOutOfBoundsException("SiteContainerView::valueAt(size_t, size_t).", sequenceIndex, 0, getNumberOfSequences() - 1);
+    if (elementIndex  >= getNumberOfSites()) throw IndexOutOfBoundsException("SiteContainerView::valueAt(size_t, size_t).", elementIndex, 0, getNumberOfSites() - 1);
+    return (*parent_)(sequenceIndices_[sequenceIndex], siteIndices_[elementIndex]);
+  }
+  const int& operator()(const std::string& sequenceName, size_t elementIndex) const
+  {
+    return (*parent_)(sequenceIndices_[getSequencePosition(sequenceName)], siteIndices_[elementIndex]);
+  }
+  const int& operator()(size_t sequenceIndex, size_t elementIndex) const
+  {
+    return (*parent_)(sequenceIndices_[sequenceIndex], siteIndices_[elementIndex]);
+  }
+
+  /**
+   * @name Modifiable access, not available in views: use the const versions.
+   *
+   * @{
+   */
+  int& valueAt(const std::string& sequenceName, size_t elementIndex)
+  {
+    throw NotImplementedException("SiteContainerView::valueAt. Views are read-only.");
+  }
+  int& valueAt(size_t sequenceIndex, size_t elementIndex)
+  {
+    throw NotImplementedException("SiteContainerView::valueAt. Views are read-only.");
+  }
+  int& operator()(const std::string& sequenceName, size_t elementIndex)
+  {
+    throw NotImplementedException("SiteContainerView::operator(). Views are read-only.");
+  }
+  int& operator()(size_t sequenceIndex, size_t elementIndex)
+  {
+    throw NotImplementedException("SiteContainerView::operator(). Views are read-only.");
+  }
+  /** @} */
+  /** @} */
+
+private:
+  void init_(const SiteContainer& parent, const std::vector<size_t>& sites, const std::vector<size_t>& sequences);
+  void clearCache_();
+};
+
+} // end of namespace bpp.
+
+#endif  // _SITECONTAINERVIEW_H_
+
@@ -0,0 +1,284 @@
+//
+// File: SiteResampler.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "SiteResampler.h"
+
+#include <Bpp/Exceptions.h>
+#include <Bpp/Text/TextTools.h>
+
+// From the STL:
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <memory>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+namespace
+{
+  /**
+   * @brief A small splitmix64 generator, one instance per replicate.
+   */
+  class ReplicateRandom
+  {
+    private:
+      uint64_t state_;
+
+    public:
+      ReplicateRandom(uint64_t seed, size_t replicate):
+        state_(seed ^ (static_cast<uint64_t>(replicate) * 0xD1B54A32D192ED03ULL))
+      {
+        //Decorrelate neighbouring replicates:
+        next();
+        next();
+      }
+
+      uint64_t next()
+      {
+        uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+      }
+
+      /**
+       * @return An unbiased integer in [0, n[, n > 0.
+       */
+      size_t nextIndex(size_t n)
+      {
+        uint64_t bound = static_cast<uint64_t>(n);
+        uint64_t threshold = (0 - bound) % bound;
+        uint64_t r;
+        do {
+          r = next();
+        } while (r < threshold);
+        return static_cast<size_t>(r % bound);
+      }
+  };
+
+  uint64_t hashSite(const Site& site)
+  {
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < site.size(); ++i)
+    {
+      h ^= static_cast<uint64_t>(static_cast<unsigned int>(site[i]));
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+
+  bool sameSite(const Site& site1, const Site& site2)
+  {
+    for (size_t i = 0; i < site1.size(); ++i)
+      if (site1[i] != site2[i]) return false;
+    return true;
+  }
+}
+
+/******************************************************************************/
+
+SiteResampler::SiteResampler(const SiteContainer& sites, uint64_t seed):
+  sites_(&sites),
+  patternIndex_(sites.getNumberOfSites()),
+  patternSites_(),
+  patternWeights_(),
+  seed_(seed)
+{
+  unordered_multimap<uint64_t, size_t> patterns;
+  for (size_t i = 0; i < patternIndex_.size(); ++i)
+  {
+    const Site& site = sites.getSite(i);
+    uint64_t h = hashSite(site);
+    size_t pattern = patternSites_.size();
+    pair<unordered_multimap<uint64_t, size_t>::iterator, unordered_multimap<uint64_t, size_t>::iterator> range = patterns.equal_range(h);
+    for (unordered_multimap<uint64_t, size_t>::iterator it = range.first; it != range.second; ++it)
+    {
+      if (sameSite(sites.getSite(patternSites_[it->second]), site))
+      {
+        pattern = it->second;
+        break;
+      }
+    }
+    if (pattern == patternSites_.size())
+    {
+      patterns.insert(make_pair(h, pattern));
+      patternSites_.push_back(i);
+      patternWeights_.push_back(0);
+    }
+    patternIndex_[i] = pattern;
+    patternWeights_[pattern]++;
+  }
+}
+
+/******************************************************************************/
+
+void SiteResampler::getBootstrapIndex(size_t replicate, size_t nbSites, vector<size_t>& index) const
+{
+  index.resize(nbSites);
+  size_t n = getNumberOfSites();
+  if (n == 0)
+  {
+    index.clear();
+    return;
+  }
+  ReplicateRandom random(seed_, replicate);
+  for (size_t i = 0; i < nbSites; ++i)
+    index[i] = random.nextIndex(n);
+}
+
+/******************************************************************************/
+
+size_t SiteResampler::getJackknifeSize_(double fraction) const
+{
+  if (fraction < 0. || fraction >= 1.)
+    throw Exception("SiteResampler::getJackknifeIndex. Fraction of deleted sites must be in [0, 1[: " + TextTools::toString(fraction));
+  size_t n = getNumberOfSites();
+  return n - static_cast<size_t>(floor(fraction * static_cast<double>(n) + 0.5));
+}
+
+void SiteResampler::getJackknifeIndex(size_t replicate, double fraction, vector<size_t>& index) const
+{
+  size_t n = getNumberOfSites();
+  size_t m = getJackknifeSize_(fraction);
+  //Partial Fisher-Yates shuffle:
+  vector<size_t> sites(n);
+  for (size_t i = 0; i < n; ++i)
+    sites[i] = i;
+  ReplicateRandom random(seed_, replicate);
+  for (size_t i = 0; i < m; ++i)
+    swap(sites[i], sites[i + random.nextIndex(n - i)]);
+  index.assign(sites.begin(), sites.begin() + static_cast<ptrdiff_t>(m));
+  sort(index.begin(), index.end());
+}
+
+/******************************************************************************/
+
+void SiteResampler::getWeights(const vector<size_t>& index, vector<unsigned int>& weights) const
+{
+  weights.assign(getNumberOfPatterns(), 0);
+  for (size_t i = 0; i < index.size(); ++i)
+  {
+    if (index[i] >= getNumberOfSites())
+      throw IndexOutOfBoundsException("SiteResampler::getWeights.", index[i], 0, getNumberOfSites() - 1);
+    weights[patternIndex_[index[i]]]++;
+  }
+}
+
+/******************************************************************************/
+
+void SiteResampler::getBootstrapWeights(size_t replicate, vector<unsigned int>& weights) const
+{
+  size_t n = getNumberOfSites();
+  weights.assign(getNumberOfPatterns(), 0);
+  if (n == 0)
+    return;
+  ReplicateRandom random(seed_, replicate);
+  for (size_t i = 0; i < n; ++i)
+    weights[patternIndex_[random.nextIndex(n)]]++;
+}
+
+void SiteResampler::getJackknifeWeights(size_t replicate, double fraction, vector<unsigned int>& weights) const
+{
+  vector<size_t> index;
+  getJackknifeIndex(replicate, fraction, index);
+  getWeights(index, weights);
+}
+
+/******************************************************************************/
+
+void SiteResampler::getBootstrapWeights(size_t firstReplicate, size_t nbReplicates, vector< vector<unsigned int> >& weights) const
+{
+  weights.resize(nbReplicates);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (size_t i = 0; i < nbReplicates; ++i)
+    getBootstrapWeights(firstReplicate + i, weights[i]);
+}
+
+void SiteResampler::getJackknifeWeights(size_t firstReplicate, size_t nbReplicates, double fraction, vector< vector<unsigned int> >& weights) const
+{
+  getJackknifeSize_(fraction); //Check the fraction before entering the parallel section.
+  weights.resize(nbReplicates);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (size_t i = 0; i < nbReplicates; ++i)
+    getJackknifeWeights(firstReplicate + i, fraction, weights[i]);
+}
+
+/******************************************************************************/
+
+VectorSiteContainer* SiteResampler::getReplicate(const vector<size_t>& index) const
+{
+  unique_ptr<VectorSiteContainer> sample(new VectorSiteContainer(sites_->getSequencesNames(), sites_->getAlphabet()));
+  for (size_t i = 0; i < index.size(); ++i)
+  {
+    if (index[i] >= getNumberOfSites())
+      throw IndexOutOfBoundsException("SiteResampler::getReplicate.", index[i], 0, getNumberOfSites() - 1);
+    sample->addSite(sites_->getSite(index[i]), false);
+  }
+  return sample.release();
+}
+
+VectorSiteContainer* SiteResampler::getWeightedReplicate(const vector<unsigned int>& weights) const
+{
+  if (weights.size() != getNumberOfPatterns())
+    throw DimensionException("SiteResampler::getWeightedReplicate. Weights do not match the number of patterns.", weights.size(), getNumberOfPatterns());
+  unique_ptr<VectorSiteContainer> sample(new VectorSiteContainer(sites_->getSequencesNames(), sites_->getAlphabet()));
+  for (size_t i = 0; i < weights.size(); ++i)
+  {
+    const Site& site = sites_->getSite(patternSites_[i]);
+    for (unsigned int j = 0; j < weights[i]; ++j)
+      sample->addSite(site, false);
+  }
+  return sample.release();
+}
+
+VectorSiteContainer* SiteResampler::getPatterns() const
+{
+  return getReplicate(patternSites_);
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,216 @@
+//
+// File: SiteResampler.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _SITERESAMPLER_H_
+#define _SITERESAMPLER_H_
+
+#include "SiteContainer.h"
+#include "VectorSiteContainer.h"
+
+// From the STL:
+#include <vector>
+#include <cstdint>
+
+namespace bpp
+{
+
+/**
+ * @brief Bootstrap and jackknife resampling of alignment sites.
+ *
+ * Identical sites are grouped into patterns once, at construction. A replicate is then described either
+ * by the indices of the sampled sites (an index view of the original alignment), or by the number of times
+ * each pattern is sampled (a weight vector over patterns). None of these requires copying sites, and a
+ * replicate is only turned into an actual container on request, with getReplicate().
+ *
+ * Each replicate is generated from its own random stream, seeded from the resampler seed and the replicate
+ * number. Replicates are hence reproducible, independent of the order in which they are computed, and can
+ * be generated in parallel: when compiled with OpenMP support, the batch methods use one thread per replicate.
+ * This generator is independent of RandomTools, which is not used here.
+ *
+ * @warning The input container is not copied and must remain valid as long as getReplicate() or getPatterns() are used.
+ * @see SiteContainerTools::bootstrapSites, SiteContainerTools::sampleSites
+ */
+class SiteResampler
+{
+  private:
+    const SiteContainer* sites_;
+    std::vector<size_t> patternIndex_;
+    std::vector<size_t> patternSites_;
+    std::vector<unsigned int> patternWeights_;
+    uint64_t seed_;
+
+  public:
+    /**
+     * @param sites The alignment to resample.
+     * @param seed  The seed of the random streams.
+     */
+    SiteResampler(const SiteContainer& sites, uint64_t seed = 0);
+
+    SiteResampler(const SiteResampler& sr):
+      sites_(sr.sites_), patternIndex_(sr.patternIndex_), patternSites_(sr.patternSites_),
+      patternWeights_(sr.patternWeights_), seed_(sr.seed_) {}
+
+    SiteResampler& operator=(const SiteResampler& sr)
+    {
+      sites_          = sr.sites_;
+      patternIndex_   = sr.patternIndex_;
+      patternSites_   = sr.patternSites_;
+      patternWeights_ = sr.patternWeights_;
+      seed_           = sr.seed_;
+      return *this;
+    }
+
+    virtual ~SiteResampler() {}
+
+  public:
+    size_t getNumberOfSites() const { return patternIndex_.size(); }
+
+    /**
+     * @return The number of distinct sites in the alignment.
+     */
+    size_t getNumberOfPatterns() const { return patternSites_.size(); }
+
+    /**
+     * @return The pattern of each site, as an index in [0, getNumberOfPatterns()[.
+     */
+    const std::vector<size_t>& getPatternIndex() const { return patternIndex_; }
+
+    /**
+     * @return For each pattern, the index of its first occurrence in the alignment.
+     */
+    const std::vector<size_t>& getPatternSites() const { return patternSites_; }
+
+    /**
+     * @return The number of occurrences of each pattern in the alignment.
+     */
+    const std::vector<unsigned int>& getPatternWeights() const { return patternWeights_; }
+
+    uint64_t getSeed() const { return seed_; }
+    void setSeed(uint64_t seed) { seed_ = seed; }
+
+    /**
+     * @brief Draw a bootstrap replicate, as site indices.
+     *
+     * @param replicate The replicate number.
+     * @param nbSites   The number of sites to draw, with replacement.
+     * @param index     [out] The indices of the sampled sites, in the order they were drawn.
+     */
+    void getBootstrapIndex(size_t replicate, size_t nbSites, std::vector<size_t>& index) const;
+
+    /**
+     * @brief Draw a bootstrap replicate with as many sites as the input alignment, as site indices.
+     */
+    void getBootstrapIndex(size_t replicate, std::vector<size_t>& index) const
+    {
+      getBootstrapIndex(replicate, getNumberOfSites(), index);
+    }
+
+    /**
+     * @brief Draw a jackknife (delete-d) replicate, as site indices.
+     *
+     * @param replicate The replicate number.
+     * @param fraction  The proportion of sites to delete, in [0, 1[.
+     * @param index     [out] The indices of the kept sites, in increasing order.
+     * @throw Exception If the fraction is not in [0, 1[.
+     */
+    void getJackknifeIndex(size_t replicate, double fraction, std::vector<size_t>& index) const;
+
+    /**
+     * @brief Draw a bootstrap replicate, as pattern weights.
+     *
+     * This gives the same replicate as getBootstrapIndex(replicate, index).
+     *
+     * @param replicate The replicate number.
+     * @param weights   [out] The number of times each pattern was sampled.
+     */
+    void getBootstrapWeights(size_t replicate, std::vector<unsigned int>& weights) const;
+
+    /**
+     * @brief Draw a jackknife (delete-d) replicate, as pattern weights.
+     *
+     * This gives the same replicate as getJackknifeIndex(replicate, fraction, index).
+     */
+    void getJackknifeWeights(size_t replicate, double fraction, std::vector<unsigned int>& weights) const;
+
+    /**
+     * @brief Draw several bootstrap replicates, as pattern weights.
+     *
+     * @param firstReplicate The number of the first replicate.
+     * @param nbReplicates   The number of replicates to draw.
+     * @param weights        [out] One weight vector per replicate.
+     */
+    void getBootstrapWeights(size_t firstReplicate, size_t nbReplicates, std::vector< std::vector<unsigned int> >& weights) const;
+
+    /**
+     * @brief Draw several jackknife replicates, as pattern weights.
+     */
+    void getJackknifeWeights(size_t firstReplicate, size_t nbReplicates, double fraction, std::vector< std::vector<unsigned int> >& weights) const;
+
+    /**
+     * @brief Convert site indices to pattern weights.
+     */
+    void getWeights(const std::vector<size_t>& index, std::vector<unsigned int>& weights) const;
+
+    /**
+     * @return A new container with the sites at the given indices.
+     * Original site positions are kept, as in SiteContainerTools::sampleSites.
+     * @throw IndexOutOfBoundsException If an index is out of range.
+     */
+    VectorSiteContainer* getReplicate(const std::vector<size_t>& index) const;
+
+    /**
+     * @return A new container with each pattern repeated according to the given weights, in pattern order.
+     * @throw DimensionException If the weight vector does not match the number of patterns.
+     */
+    VectorSiteContainer* getWeightedReplicate(const std::vector<unsigned int>& weights) const;
+
+    /**
+     * @return A new container with one site per pattern.
+     */
+    VectorSiteContainer* getPatterns() const;
+
+  private:
+    size_t getJackknifeSize_(double fraction) const;
+
+};
+
+} //end of namespace bpp.
+
+#endif //_SITERESAMPLER_H_
+
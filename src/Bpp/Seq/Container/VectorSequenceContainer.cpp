@@ -39,6 +39,7 @@
  */
 
 #include "VectorSequenceContainer.h"
+#include "../Instrumentation.h"
 #include <Bpp/Text/TextTools.h>
 
 using namespace bpp;
@@ -228,6 +229,7 @@ size_t VectorSequenceContainer::getSequencePosition(const string& name) const
 
 void VectorSequenceContainer::setSequence(size_t sequenceIndex, const Sequence& sequence, bool checkName)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSequenceContainer::setSequence");
   // Sequence's name existence checking
   if (checkName)
   {
@@ -241,11 +243,12 @@ void VectorSequenceContainer::setSequence(size_t sequenceIndex, const Sequence&
   }
 
   // New sequence's alphabet and sequence container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() == getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() == getAlphabet()->getAlphabetTypeId())
   {
     // Delete old sequence
     delete sequences_[sequenceIndex];
     // New sequence insertion in sequence container
+    BPP_SEQ_COUNT_ALLOCATION("VectorSequenceContainer::Sequence", sequence.size() * sizeof(int));
     sequences_[sequenceIndex] = dynamic_cast<Sequence*>(sequence.clone());
   }
   else
@@ -256,6 +259,7 @@ void VectorSequenceContainer::setSequence(size_t sequenceIndex, const Sequence&
 
 Sequence* VectorSequenceContainer::removeSequence(size_t sequenceIndex)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSequenceContainer::removeSequence");
   // Copy sequence:
   if (sequenceIndex >= sequences_.size())
     throw IndexOutOfBoundsException("VectorSequenceContainer::removeSequence.", sequenceIndex, 0, sequences_.size() - 1);
@@ -270,6 +274,7 @@ Sequence* VectorSequenceContainer::removeSequence(size_t sequenceIndex)
 
 void VectorSequenceContainer::deleteSequence(size_t sequenceIndex)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSequenceContainer::deleteSequence");
   // Delete sequence
   if (sequenceIndex >= sequences_.size())
     throw IndexOutOfBoundsException("VectorSequenceContainer::deleteSequence.", sequenceIndex, 0, sequences_.size() - 1);
@@ -282,6 +287,7 @@ void VectorSequenceContainer::deleteSequence(size_t sequenceIndex)
 
 void VectorSequenceContainer::addSequence(const Sequence& sequence, bool checkName)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSequenceContainer::addSequence");
   // Sequence's name existence checking
   if (checkName)
   {
@@ -294,9 +300,10 @@ void VectorSequenceContainer::addSequence(const Sequence& sequence, bool checkNa
   }
 
   // New sequence's alphabet and sequence container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() == getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() == getAlphabet()->getAlphabetTypeId())
   {
     // push_back(new Sequence(sequence.getName(), sequence.getContent(), alphabet));
+    BPP_SEQ_COUNT_ALLOCATION("VectorSequenceContainer::Sequence", sequence.size() * sizeof(int));
     sequences_.push_back(dynamic_cast<Sequence*>(sequence.clone()));
   }
   else
@@ -305,6 +312,7 @@ void VectorSequenceContainer::addSequence(const Sequence& sequence, bool checkNa
 
 void VectorSequenceContainer::addSequence(const Sequence& sequence, size_t sequenceIndex, bool checkName)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSequenceContainer::addSequence");
   // Sequence's name existence checking
   if (checkName)
   {
@@ -317,9 +325,10 @@ void VectorSequenceContainer::addSequence(const Sequence& sequence, size_t seque
   }
 
   // New sequence's alphabet and sequence container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() == getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() == getAlphabet()->getAlphabetTypeId())
   {
     // insert(begin() + pos, new Sequence(sequence.getName(), sequence.getContent(), alphabet));
+    BPP_SEQ_COUNT_ALLOCATION("VectorSequenceContainer::Sequence", sequence.size() * sizeof(int));
     sequences_.insert(sequences_.begin() + static_cast<ptrdiff_t>(sequenceIndex), dynamic_cast<Sequence*>(sequence.clone()));
   }
   else
@@ -38,8 +38,10 @@
  */
 
 #include "VectorSiteContainer.h"
+#include "../Instrumentation.h"
 
 #include <iostream>
+#include <set>
 
 using namespace std;
 
@@ -297,6 +299,7 @@ const Site& VectorSiteContainer::getSite(size_t i) const
 
 void VectorSiteContainer::setSite(size_t pos, const Site& site, bool checkPositions)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::setSite");
   if (pos >= getNumberOfSites())
     throw IndexOutOfBoundsException("VectorSiteContainer::setSite.", pos, 0, getNumberOfSites() - 1);
 
@@ -305,7 +308,7 @@ void VectorSiteContainer::setSite(size_t pos, const Site& site, bool checkPositi
     throw SiteException("AlignedSequenceContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("VectorSiteContainer::setSite", getAlphabet(), site.getAlphabet());
 
   // Check position:
@@ -320,6 +323,7 @@ void VectorSiteContainer::setSite(size_t pos, const Site& site, bool checkPositi
     }
   }
   delete sites_[pos];
+  BPP_SEQ_COUNT_ALLOCATION("VectorSiteContainer::Site", site.size() * sizeof(int));
   sites_[pos] = dynamic_cast<Site*>(site.clone());
 }
 
@@ -327,6 +331,7 @@ void VectorSiteContainer::setSite(size_t pos, const Site& site, bool checkPositi
 
 Site* VectorSiteContainer::removeSite(size_t i)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::removeSite");
   if (i >= getNumberOfSites())
     throw IndexOutOfBoundsException("VectorSiteContainer::removeSite.", i, 0, getNumberOfSites() - 1);
   Site* site = sites_[i];
@@ -338,6 +343,7 @@ Site* VectorSiteContainer::removeSite(size_t i)
 
 void VectorSiteContainer::deleteSite(size_t i)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::deleteSite");
   if (i >= getNumberOfSites())
     throw IndexOutOfBoundsException("VectorSiteContainer::deleteSite.", i, 0, getNumberOfSites() - 1);
   delete sites_[i];
@@ -348,6 +354,7 @@ void VectorSiteContainer::deleteSite(size_t i)
 
 void VectorSiteContainer::deleteSites(size_t siteIndex, size_t length)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::deleteSites");
   if (siteIndex + length > getNumberOfSites())
     throw IndexOutOfBoundsException("VectorSiteContainer::deleteSites.", siteIndex + length, 0, getNumberOfSites() - 1);
   for (size_t i = siteIndex; i < siteIndex + length; ++i)
@@ -361,12 +368,13 @@ void VectorSiteContainer::deleteSites(size_t siteIndex, size_t length)
 
 void VectorSiteContainer::addSite(const Site& site, bool checkPositions)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::addSite");
   // Check size:
   if (site.size() != getNumberOfSequences())
     throw SiteException("VectorSiteContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("VectorSiteContainer::addSite", getAlphabet(), site.getAlphabet());
   }
@@ -383,6 +391,7 @@ void VectorSiteContainer::addSite(const Site& site, bool checkPositions)
     }
   }
 
+  BPP_SEQ_COUNT_ALLOCATION("VectorSiteContainer::Site", site.size() * sizeof(int));
   sites_.push_back(dynamic_cast<Site*>(site.clone()));
 }
 
@@ -390,12 +399,13 @@ void VectorSiteContainer::addSite(const Site& site, bool checkPositions)
 
 void VectorSiteContainer::addSite(const Site& site, int position, bool checkPositions)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::addSite");
   // Check size:
   if (site.size() != getNumberOfSequences())
     throw SiteException("VectorSiteContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("VectorSiteContainer::addSite", getAlphabet(), site.getAlphabet());
   }
@@ -410,6 +420,7 @@ void VectorSiteContainer::addSite(const Site& site, int position, bool checkPosi
         throw SiteException("VectorSiteContainer::addSite. Site position already exists in container", &site);
     }
   }
+  BPP_SEQ_COUNT_ALLOCATION("VectorSiteContainer::Site", site.size() * sizeof(int));
   Site* copy = dynamic_cast<Site*>(site.clone());
   copy->setPosition(position);
   sites_.push_back(copy);
@@ -419,6 +430,7 @@ void VectorSiteContainer::addSite(const Site& site, int position, bool checkPosi
 
 void VectorSiteContainer::addSite(const Site& site, size_t siteIndex, bool checkPositions)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::addSite");
   if (siteIndex >= getNumberOfSites())
     throw IndexOutOfBoundsException("VectorSiteContainer::addSite", siteIndex, 0, getNumberOfSites() - 1);
 
@@ -427,7 +439,7 @@ void VectorSiteContainer::addSite(const Site& site, size_t siteIndex, bool check
     throw SiteException("VectorSiteContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("VectorSiteContainer::addSite", getAlphabet(), site.getAlphabet());
   }
@@ -445,6 +457,7 @@ void VectorSiteContainer::addSite(const Site& site, size_t siteIndex, bool check
   }
 
   // insert(begin() + pos, new Site(site));
+  BPP_SEQ_COUNT_ALLOCATION("VectorSiteContainer::Site", site.size() * sizeof(int));
   sites_.insert(sites_.begin() + static_cast<ptrdiff_t>(siteIndex), dynamic_cast<Site*>(site.clone()));
 }
 
@@ -452,6 +465,7 @@ void VectorSiteContainer::addSite(const Site& site, size_t siteIndex, bool check
 
 void VectorSiteContainer::addSite(const Site& site, size_t siteIndex, int position, bool checkPositions)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::addSite");
   if (siteIndex >= getNumberOfSites())
     throw IndexOutOfBoundsException("VectorSiteContainer::addSite", siteIndex, 0, getNumberOfSites() - 1);
 
@@ -460,7 +474,7 @@ void VectorSiteContainer::addSite(const Site& site, size_t siteIndex, int positi
     throw SiteException("VectorSiteContainer::addSite. Site does not have the appropriate length", &site);
 
   // New site's alphabet and site container's alphabet matching verification
-  if (site.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (site.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("VectorSiteContainer::addSite", getAlphabet(), site.getAlphabet());
   }
@@ -476,6 +490,7 @@ void VectorSiteContainer::addSite(const Site& site, size_t siteIndex, int positi
     }
   }
 
+  BPP_SEQ_COUNT_ALLOCATION("VectorSiteContainer::Site", site.size() * sizeof(int));
   Site* copy = dynamic_cast<Site*>(site.clone());
   copy->setPosition(position);
   sites_.insert(sites_.begin() + static_cast<ptrdiff_t>(siteIndex), copy);
@@ -527,6 +542,7 @@ void VectorSiteContainer::setSitePositions(Vint vPositions)
 
 const Sequence& VectorSiteContainer::getSequence(size_t i) const
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::getSequence");
   if (i >= getNumberOfSequences())
     throw IndexOutOfBoundsException("VectorSiteContainer::getSequence.", i, 0, getNumberOfSequences() - 1);
 
@@ -539,6 +555,7 @@ const Sequence& VectorSiteContainer::getSequence(size_t i) const
   }
   if (sequences_[i])
     delete sequences_[i];
+  BPP_SEQ_COUNT_ALLOCATION("VectorSiteContainer::Sequence", n * sizeof(int));
   sequences_[i] = new BasicSequence(names_[i], sequence, *comments_[i], getAlphabet());
   return *sequences_[i];
 }
@@ -591,11 +608,12 @@ void VectorSiteContainer::setSequence(const string& name, const Sequence& sequen
 
 void VectorSiteContainer::setSequence(size_t pos, const Sequence& sequence, bool checkNames)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::setSequence");
   if (pos >= getNumberOfSequences())
     throw IndexOutOfBoundsException("VectorSiteContainer::setSequence", pos, 0, getNumberOfSequences() - 1);
 
   // New sequence's alphabet and site container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("VectorSiteContainer::addSite", getAlphabet(), sequence.getAlphabet());
 
   // If the container has only one sequence, we set the size to the size of this sequence:
@@ -634,6 +652,7 @@ void VectorSiteContainer::setSequence(size_t pos, const Sequence& sequence, bool
 
 Sequence* VectorSiteContainer::removeSequence(size_t i)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::removeSequence");
   if (i >= getNumberOfSequences())
     throw IndexOutOfBoundsException("VectorSiteContainer::removeSequence.", i, 0, getNumberOfSequences() - 1);
 
@@ -669,6 +688,7 @@ Sequence* VectorSiteContainer::removeSequence(const string& name)
 
 void VectorSiteContainer::deleteSequence(size_t i)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::deleteSequence");
   if (i >= getNumberOfSequences())
     throw IndexOutOfBoundsException("VectorSiteContainer::demeteSequence.", i, 0, getNumberOfSequences() - 1);
   for (size_t j = 0; j < sites_.size(); j++)
@@ -699,12 +719,13 @@ void VectorSiteContainer::deleteSequence(const string& name)
 
 void VectorSiteContainer::addSequence(const Sequence& sequence, bool checkNames)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::addSequence");
   // If the container has no sequence, we set the size to the size of this sequence:
   if (getNumberOfSequences() == 0)
     realloc(sequence.size());
 
   // New sequence's alphabet and site container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("VectorSiteContainer::addSequence", getAlphabet(), sequence.getAlphabet());
 
   if (sequence.size() != sites_.size())
@@ -742,13 +763,14 @@ void VectorSiteContainer::addSequence(
   size_t pos,
   bool checkNames)
 {
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::addSequence");
   if (pos >= getNumberOfSequences())
     throw IndexOutOfBoundsException("VectorSiteContainer::addSequence.", pos, 0, getNumberOfSequences() - 1);
   if (sequence.size() != sites_.size())
     throw SequenceNotAlignedException("VectorSiteContainer::setSequence", &sequence);
 
   // New sequence's alphabet and site container's alphabet matching verification
-  if (sequence.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("VectorSiteContainer::addSite", getAlphabet(), sequence.getAlphabet());
   }
@@ -775,6 +797,107 @@ void VectorSiteContainer::addSequence(
 
 /******************************************************************************/
 
+void VectorSiteContainer::addSequences(const vector<string>& names, const vector< vector<int> >& sequences, bool checkNames)
+{
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::addSequences");
+  if (names.size() != sequences.size())
+    throw DimensionException("VectorSiteContainer::addSequences. There must be one name per sequence.", names.size(), sequences.size());
+  if (sequences.empty())
+    return;
+
+  // Check everything before modifying the container:
+  size_t nbSites = (getNumberOfSequences() == 0 ? sequences[0].size() : sites_.size());
+  for (size_t i = 0; i < sequences.size(); ++i)
+  {
+    if (sequences[i].size() != nbSites)
+      throw Exception("VectorSiteContainer::addSequences. Sequence " + names[i] + " has not the appropriate length: " + TextTools::toString(sequences[i].size()) + ", should be " + TextTools::toString(nbSites) + ".");
+    for (size_t j = 0; j < nbSites; ++j)
+      if (!getAlphabet()->isIntInAlphabet(sequences[i][j]))
+        throw BadIntException(sequences[i][j], "VectorSiteContainer::addSequences", getAlphabet());
+  }
+  if (checkNames)
+  {
+    set<string> allNames(names_.begin(), names_.end());
+    for (size_t i = 0; i < names.size(); ++i)
+      if (!allNames.insert(names[i]).second)
+        throw Exception("VectorSiteContainer::addSequences. Name already exists in container: " + names[i]);
+  }
+
+  if (getNumberOfSequences() == 0)
+    realloc(nbSites);
+  // Each site is rebuilt once with all its new states:
+  vector<int> column;
+  for (size_t j = 0; j < nbSites; ++j)
+  {
+    const int* data = sites_[j]->getData();
+    column.assign(data, data + sites_[j]->size());
+    for (size_t i = 0; i < sequences.size(); ++i)
+      column.push_back(sequences[i][j]);
+    sites_[j]->setContent(column);
+  }
+  BPP_SEQ_COUNT_ALLOCATION("VectorSiteContainer::Site", nbSites * sequences.size() * sizeof(int));
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    names_.push_back(names[i]);
+    comments_.push_back(new Comments());
+    sequences_.push_back(0);
+  }
+}
+
+/******************************************************************************/
+
+void VectorSiteContainer::translateStates(const vector<int>& table, int offset)
+{
+  BPP_SEQ_TIME_SCOPE("VectorSiteContainer::translateStates");
+  size_t nbSites = sites_.size();
+  int tableSize = static_cast<int>(table.size());
+  bool failed = false;
+  int badState = 0;
+  // All states are checked first, so that the container is left unchanged on failure:
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (size_t i = 0; i < nbSites; ++i)
+  {
+    const Site& site = *sites_[i];
+    size_t n = site.size();
+    if (n == 0)
+      continue;
+    const int* states = &site[0];
+    for (size_t j = 0; j < n; ++j)
+    {
+      int k = states[j] - offset;
+      if (k < 0 || k >= tableSize)
+      {
+#ifdef _OPENMP
+#pragma omp critical(VectorSiteContainer_access)
+#endif
+        {
+          failed = true;
+          badState = states[j];
+        }
+        break;
+      }
+    }
+  }
+  if (failed)
+    throw BadIntException(badState, "VectorSiteContainer::translateStates. State not covered by the translation table.", getAlphabet());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (size_t i = 0; i < nbSites; ++i)
+  {
+    size_t n = sites_[i]->size();
+    if (n == 0)
+      continue;
+    int* states = &(*sites_[i])[0];
+    for (size_t j = 0; j < n; ++j)
+      states[j] = table[static_cast<size_t>(states[j] - offset)];
+  }
+}
+
+/******************************************************************************/
+
 void VectorSiteContainer::clear()
 {
   // Must delete all sites in the container:
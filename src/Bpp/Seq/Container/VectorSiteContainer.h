@@ -228,6 +228,35 @@ public:
   void addSequence(const Sequence& sequence,                             bool checkName = true);
   void addSequence(const Sequence& sequence, size_t sequenceIndex, bool checkName = true);
 
+  /**
+   * @brief Add several sequences at once.
+   *
+   * Each site is extended only once, instead of once per added sequence.
+   *
+   * @param names      The names of the sequences to add.
+   * @param sequences  The states of the sequences to add. All sequences must have the number of sites of the
+   * container, or the same length if the container is empty.
+   * @param checkNames Tell if the names should be checked for unicity.
+   * @throw DimensionException If there is not one name per sequence.
+   * @throw Exception If a sequence does not have the appropriate length, or if a name already exists.
+   * @throw BadIntException If a state is not in the alphabet.
+   */
+  void addSequences(const std::vector<std::string>& names, const std::vector< std::vector<int> >& sequences, bool checkNames = true);
+
+  /**
+   * @brief Replace all states in place, through a look-up table.
+   *
+   * Each state s is replaced by table[s - offset]. The states of each site are contiguous,
+   * and sites are processed in blocks of consecutive sites, in parallel when OpenMP is available.
+   * New states are not checked: they must be valid states of the alphabet of the container.
+   *
+   * @param table  The new value of each state.
+   * @param offset The state corresponding to the first element of the table.
+   * @throw BadIntException If a state is not covered by the table. All states are checked before any is replaced,
+   * so that the container is left unchanged in that case.
+   */
+  void translateStates(const std::vector<int>& table, int offset);
+
   void setSequence(const std::string& name,    const Sequence& sequence, bool checkName);
   void setSequence(size_t sequenceIndex, const Sequence& sequence, bool checkName);
 
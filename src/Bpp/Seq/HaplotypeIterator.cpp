@@ -0,0 +1,158 @@
+//
+// File: HaplotypeIterator.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "HaplotypeIterator.h"
+
+#include <Bpp/Text/TextTools.h>
+#include <Bpp/Numeric/Random/RandomTools.h>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+HaplotypeIterator::HaplotypeIterator(const Sequence& seq, unsigned int level):
+  alphabet_(seq.getAlphabet()),
+  name_(seq.getName()),
+  comments_(seq.getComments()),
+  content_(seq.size()),
+  positions_(),
+  alternatives_(),
+  choices_(),
+  index_(0),
+  hasMore_(true)
+{
+  for (size_t i = 0; i < seq.size(); ++i)
+  {
+    int state = seq[i];
+    vector<int> st = alphabet_->getAlias(state);
+    if (st.size() > 1 && st.size() <= level)
+    {
+      positions_.push_back(i);
+      alternatives_.push_back(st);
+      content_[i] = st[0];
+    }
+    else if (st.size() == 1)
+    {
+      content_[i] = st[0];
+    }
+    else
+    {
+      content_[i] = st.size() == 0 ? alphabet_->getGapCharacterCode() : state;
+    }
+  }
+  choices_.resize(positions_.size(), 0);
+}
+
+/******************************************************************************/
+
+const vector<int>& HaplotypeIterator::nextHaplotype()
+{
+  if (!hasMore_)
+    throw Exception("HaplotypeIterator::nextHaplotype. No more haplotypes.");
+  if (index_ > 0)
+  {
+    // Increment the last heterozygous site, and carry over:
+    for (size_t k = positions_.size(); k > 0; --k)
+    {
+      size_t& choice = choices_[k - 1];
+      const vector<int>& alt = alternatives_[k - 1];
+      if (++choice < alt.size())
+      {
+        content_[positions_[k - 1]] = alt[choice];
+        break;
+      }
+      choice = 0;
+      content_[positions_[k - 1]] = alt[0];
+    }
+  }
+  index_++;
+  hasMore_ = false;
+  for (size_t k = 0; k < choices_.size() && !hasMore_; ++k)
+    hasMore_ = choices_[k] + 1 < alternatives_[k].size();
+  return content_;
+}
+
+/******************************************************************************/
+
+Sequence* HaplotypeIterator::nextSequence()
+{
+  const vector<int>& haplotype = nextHaplotype();
+  return new BasicSequence(name_ + "_hap" + TextTools::toString(index_), haplotype, comments_, alphabet_);
+}
+
+/******************************************************************************/
+
+double HaplotypeIterator::getNumberOfHaplotypes() const
+{
+  double n = 1.;
+  for (size_t k = 0; k < alternatives_.size(); ++k)
+    n *= static_cast<double>(alternatives_[k].size());
+  return n;
+}
+
+/******************************************************************************/
+
+Sequence* HaplotypeIterator::sampleHaplotype(const string& name) const
+{
+  vector<int> haplotype(content_);
+  for (size_t k = 0; k < positions_.size(); ++k)
+  {
+    const vector<int>& alt = alternatives_[k];
+    haplotype[positions_[k]] = alt[RandomTools::giveIntRandomNumberBetweenZeroAndEntry(alt.size())];
+  }
+  return new BasicSequence(name, haplotype, comments_, alphabet_);
+}
+
+/******************************************************************************/
+
+void HaplotypeIterator::reset()
+{
+  for (size_t k = 0; k < positions_.size(); ++k)
+  {
+    choices_[k] = 0;
+    content_[positions_[k]] = alternatives_[k][0];
+  }
+  index_ = 0;
+  hasMore_ = true;
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,170 @@
+//
+// File: HaplotypeIterator.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _HAPLOTYPEITERATOR_H_
+#define _HAPLOTYPEITERATOR_H_
+
+#include "Sequence.h"
+#include "SequenceIterator.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+  /**
+   * @brief Lazy enumeration of the putative haplotypes of an heterozygous sequence.
+   *
+   * Each generic character coding for at most 'level' states is resolved into each of its states,
+   * other characters are left unchanged (see SequenceTools::getPutativeHaplotypes).
+   * Haplotypes are generated one at a time, the last heterozygous site changing fastest,
+   * so that memory usage is linear in the sequence length whatever the number of haplotypes.
+   * The k-th haplotype is named after the genotype, with a "_hapk" suffix.
+   *
+   * The number of haplotypes can be computed, and haplotypes can be sampled uniformly, without enumerating them.
+   *
+   * @code
+   * HaplotypeIterator it(genotype);
+   * while (it.hasMoreSequences()) {
+   *   const std::vector<int>& haplotype = it.nextHaplotype();
+   *   ...
+   * }
+   * @endcode
+   */
+  class HaplotypeIterator:
+    public virtual SequenceIterator
+  {
+  private:
+    const Alphabet* alphabet_;
+    std::string name_;
+    Comments comments_;
+    std::vector<int> content_;
+    std::vector<size_t> positions_;
+    std::vector< std::vector<int> > alternatives_;
+    std::vector<size_t> choices_;
+    size_t index_;
+    bool hasMore_;
+
+  public:
+    /**
+     * @param seq The sequence to resolve.
+     * @param level The maximum number of states that a generic char must code
+     * (if this number is higher than level, the state will not be resolved).
+     */
+    HaplotypeIterator(const Sequence& seq, unsigned int level = 2);
+
+    HaplotypeIterator(const HaplotypeIterator& it):
+      alphabet_(it.alphabet_), name_(it.name_), comments_(it.comments_),
+      content_(it.content_), positions_(it.positions_), alternatives_(it.alternatives_),
+      choices_(it.choices_), index_(it.index_), hasMore_(it.hasMore_) {}
+    HaplotypeIterator& operator=(const HaplotypeIterator& it)
+    {
+      alphabet_     = it.alphabet_;
+      name_         = it.name_;
+      comments_     = it.comments_;
+      content_      = it.content_;
+      positions_    = it.positions_;
+      alternatives_ = it.alternatives_;
+      choices_      = it.choices_;
+      index_        = it.index_;
+      hasMore_      = it.hasMore_;
+      return *this;
+    }
+
+    virtual ~HaplotypeIterator() {}
+
+  public:
+    /**
+     * @return The next haplotype, as a newly allocated sequence.
+     * @throw Exception If there are no more haplotypes.
+     */
+    Sequence* nextSequence();
+
+    bool hasMoreSequences() const { return hasMore_; }
+
+    /**
+     * @brief Move to the next haplotype, without allocating a new sequence.
+     *
+     * @return The states of the haplotype. The reference is only valid until the next call.
+     * @throw Exception If there are no more haplotypes.
+     */
+    const std::vector<int>& nextHaplotype();
+
+    /**
+     * @return The number of haplotypes already returned.
+     */
+    size_t getNumberOfHaplotypesReturned() const { return index_; }
+
+    /**
+     * @return The number of heterozygous sites, that is, sites with more than one putative state.
+     */
+    size_t getNumberOfHeterozygousSites() const { return positions_.size(); }
+
+    /**
+     * @return The positions of the heterozygous sites in the sequence.
+     */
+    const std::vector<size_t>& getHeterozygousSites() const { return positions_; }
+
+    /**
+     * @return The total number of putative haplotypes.
+     * It is returned as a double, as it grows exponentially with the number of heterozygous sites.
+     */
+    double getNumberOfHaplotypes() const;
+
+    /**
+     * @brief Draw a haplotype uniformly among all putative haplotypes, without enumerating them.
+     *
+     * @param name The name of the new sequence.
+     * @return A newly allocated sequence.
+     */
+    Sequence* sampleHaplotype(const std::string& name) const;
+
+    /**
+     * @brief Restart the enumeration from the first haplotype.
+     */
+    void reset();
+
+  };
+
+} //end of namespace bpp.
+
+#endif //_HAPLOTYPEITERATOR_H_
+
@@ -0,0 +1,129 @@
+//
+// File: Instrumentation.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "Instrumentation.h"
+
+// From the STL:
+#include <map>
+#include <memory>
+#include <mutex>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+namespace
+{
+  //Counters are never destroyed before the end of the program, as references to them are
+  //kept in function-level static variables.
+  mutex& registryMutex()
+  {
+    static mutex m;
+    return m;
+  }
+
+  map<string, unique_ptr<InstrumentationCounter> >& registry()
+  {
+    static map<string, unique_ptr<InstrumentationCounter> >* counters = new map<string, unique_ptr<InstrumentationCounter> >();
+    return *counters;
+  }
+}
+
+/******************************************************************************/
+
+bool SeqInstrumentation::isEnabled()
+{
+#ifdef BPP_SEQ_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+/******************************************************************************/
+
+InstrumentationCounter& SeqInstrumentation::getCounter(const string& name)
+{
+  lock_guard<mutex> lock(registryMutex());
+  unique_ptr<InstrumentationCounter>& counter = registry()[name];
+  if (!counter)
+    counter.reset(new InstrumentationCounter(name));
+  return *counter;
+}
+
+/******************************************************************************/
+
+vector<const InstrumentationCounter*> SeqInstrumentation::getCounters()
+{
+  lock_guard<mutex> lock(registryMutex());
+  vector<const InstrumentationCounter*> counters;
+  for (map<string, unique_ptr<InstrumentationCounter> >::const_iterator it = registry().begin(); it != registry().end(); ++it)
+    counters.push_back(it->second.get());
+  return counters;
+}
+
+/******************************************************************************/
+
+void SeqInstrumentation::reset()
+{
+  lock_guard<mutex> lock(registryMutex());
+  for (map<string, unique_ptr<InstrumentationCounter> >::iterator it = registry().begin(); it != registry().end(); ++it)
+    it->second->reset();
+}
+
+/******************************************************************************/
+
+void SeqInstrumentation::report(ostream& out)
+{
+  vector<const InstrumentationCounter*> counters = getCounters();
+  out << "Name\tCalls\tTotal_us\tMean_us\tAllocations\tBytes" << endl;
+  for (size_t i = 0; i < counters.size(); ++i)
+  {
+    const InstrumentationCounter& c = *counters[i];
+    double total = static_cast<double>(c.getTotalTime()) / 1000.;
+    double mean = c.getNumberOfCalls() > 0 ? total / static_cast<double>(c.getNumberOfCalls()) : 0.;
+    out << c.getName() << "\t" << c.getNumberOfCalls() << "\t" << total << "\t" << mean
+        << "\t" << c.getNumberOfAllocations() << "\t" << c.getAllocatedBytes() << endl;
+  }
+}
+
+/******************************************************************************/
+
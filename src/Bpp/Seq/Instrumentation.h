@@ -0,0 +1,228 @@
+//
+// File: Instrumentation.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _INSTRUMENTATION_H_
+#define _INSTRUMENTATION_H_
+
+// From the STL:
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Counters attached to an instrumented code location.
+ *
+ * Counters are updated atomically, so that instrumented functions can be called from
+ * several threads. They are created and owned by SeqInstrumentation.
+ */
+class InstrumentationCounter
+{
+  private:
+    std::string name_;
+    std::atomic<uint64_t> calls_;
+    std::atomic<uint64_t> time_;
+    std::atomic<uint64_t> allocations_;
+    std::atomic<uint64_t> bytes_;
+
+  public:
+    InstrumentationCounter(const std::string& name):
+      name_(name), calls_(0), time_(0), allocations_(0), bytes_(0) {}
+
+    InstrumentationCounter(const InstrumentationCounter&) = delete;
+    InstrumentationCounter& operator=(const InstrumentationCounter&) = delete;
+
+  public:
+    const std::string& getName() const { return name_; }
+
+    void addCall() { calls_.fetch_add(1, std::memory_order_relaxed); }
+    void addTime(uint64_t nanoseconds) { time_.fetch_add(nanoseconds, std::memory_order_relaxed); }
+    void addAllocation(size_t bytes)
+    {
+      allocations_.fetch_add(1, std::memory_order_relaxed);
+      bytes_.fetch_add(static_cast<uint64_t>(bytes), std::memory_order_relaxed);
+    }
+
+    uint64_t getNumberOfCalls() const { return calls_.load(std::memory_order_relaxed); }
+    /**
+     * @return The total time spent in timed scopes, in nanoseconds.
+     */
+    uint64_t getTotalTime() const { return time_.load(std::memory_order_relaxed); }
+    uint64_t getNumberOfAllocations() const { return allocations_.load(std::memory_order_relaxed); }
+    uint64_t getAllocatedBytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+    void reset()
+    {
+      calls_.store(0, std::memory_order_relaxed);
+      time_.store(0, std::memory_order_relaxed);
+      allocations_.store(0, std::memory_order_relaxed);
+      bytes_.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Count a call and measure the time spent until the end of the enclosing scope.
+ *
+ * Nested timers are all counted, so the time of a function includes the time of the
+ * instrumented functions it calls.
+ */
+class ScopedInstrumentationTimer
+{
+  private:
+    InstrumentationCounter& counter_;
+    std::chrono::steady_clock::time_point start_;
+
+  public:
+    explicit ScopedInstrumentationTimer(InstrumentationCounter& counter):
+      counter_(counter), start_(std::chrono::steady_clock::now())
+    {
+      counter_.addCall();
+    }
+
+    ~ScopedInstrumentationTimer()
+    {
+      std::chrono::steady_clock::duration d = std::chrono::steady_clock::now() - start_;
+      counter_.addTime(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()));
+    }
+
+    ScopedInstrumentationTimer(const ScopedInstrumentationTimer&) = delete;
+    ScopedInstrumentationTimer& operator=(const ScopedInstrumentationTimer&) = delete;
+};
+
+/**
+ * @brief Registry of the instrumentation counters of the library.
+ *
+ * The library can be compiled with the BPP_SEQ_INSTRUMENTATION macro defined
+ * (CMake option ENABLE_INSTRUMENTATION), in which case sequence readers, alphabet
+ * lookups, container mutations and SiteContainerTools algorithms record call counts,
+ * times and allocated states. Otherwise, the instrumentation macros expand to nothing
+ * and there is no runtime cost. The registry itself is always available, and can
+ * also be used by client code through the same macros:
+ * @code
+ * void myFunction()
+ * {
+ *   BPP_SEQ_TIME_SCOPE("myFunction");
+ *   ...
+ * }
+ * ...
+ * SeqInstrumentation::report(std::cerr);
+ * @endcode
+ */
+class SeqInstrumentation
+{
+  public:
+    /**
+     * @return True if the library was compiled with instrumentation.
+     */
+    static bool isEnabled();
+
+    /**
+     * @brief Get the counter with a given name, creating it if needed.
+     *
+     * The returned reference remains valid until the end of the program.
+     * This function is thread-safe.
+     */
+    static InstrumentationCounter& getCounter(const std::string& name);
+
+    /**
+     * @return All counters, sorted by name.
+     */
+    static std::vector<const InstrumentationCounter*> getCounters();
+
+    /**
+     * @brief Set all counters to zero.
+     */
+    static void reset();
+
+    /**
+     * @brief Write all counters as a tab-separated table.
+     *
+     * Columns are the counter name, the number of calls, the total and mean time in
+     * microseconds, the number of allocations and the number of allocated bytes.
+     */
+    static void report(std::ostream& out);
+};
+
+} //end of namespace bpp.
+
+#define BPP_SEQ_CONCAT_(a, b) a ## b
+#define BPP_SEQ_CONCAT(a, b) BPP_SEQ_CONCAT_(a, b)
+
+#ifdef BPP_SEQ_INSTRUMENTATION
+
+/**
+ * @brief Count a call and time the rest of the enclosing scope.
+ */
+#define BPP_SEQ_TIME_SCOPE(name) \
+  static bpp::InstrumentationCounter& BPP_SEQ_CONCAT(bppSeqCounter, __LINE__) = bpp::SeqInstrumentation::getCounter(name); \
+  bpp::ScopedInstrumentationTimer BPP_SEQ_CONCAT(bppSeqTimer, __LINE__)(BPP_SEQ_CONCAT(bppSeqCounter, __LINE__))
+
+/**
+ * @brief Count a call, without timing. Meant for functions too short to be timed.
+ */
+#define BPP_SEQ_COUNT_CALL(name) \
+  do { \
+    static bpp::InstrumentationCounter& bppSeqCounter = bpp::SeqInstrumentation::getCounter(name); \
+    bppSeqCounter.addCall(); \
+  } while (0)
+
+/**
+ * @brief Record an allocation of a given number of bytes.
+ */
+#define BPP_SEQ_COUNT_ALLOCATION(name, bytes) \
+  do { \
+    static bpp::InstrumentationCounter& bppSeqCounter = bpp::SeqInstrumentation::getCounter(name); \
+    bppSeqCounter.addAllocation(bytes); \
+  } while (0)
+
+#else
+
+#define BPP_SEQ_TIME_SCOPE(name)
+#define BPP_SEQ_COUNT_CALL(name) do {} while (0)
+#define BPP_SEQ_COUNT_ALLOCATION(name, bytes) do {} while (0)
+
+#endif //BPP_SEQ_INSTRUMENTATION
+
+#endif //_INSTRUMENTATION_H_
+
@@ -0,0 +1,412 @@
+//
+// File: AbstractInsdcReader.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "AbstractInsdcReader.h"
+#include "../SequenceWithAnnotation.h"
+#include "../Instrumentation.h"
+
+#include <Bpp/Text/TextTools.h>
+
+// From the STL:
+#include <cctype>
+#include <algorithm>
+
+using namespace bpp;
+using namespace std;
+
+/******************************************************************************/
+
+bool AbstractInsdcReader::nextRecord(istream& input, string& record) const
+{
+  if (!input)
+    throw IOException(getFormatName() + "::nextRecord: can't read from istream input");
+  record.clear();
+  string line;
+  while (getline(input, line))
+  {
+    // Skip blank lines between records:
+    if (record.empty() && TextTools::isEmpty(line))
+      continue;
+    record += line;
+    record += '\n';
+    if (line.size() >= 2 && line[0] == '/' && line[1] == '/')
+      break;
+  }
+  return !record.empty();
+}
+
+/******************************************************************************/
+
+bool AbstractInsdcReader::nextSequence(istream& input, Sequence& seq) const
+{
+  vector<SequenceFeature> features;
+  return nextSequence(input, seq, features);
+}
+
+bool AbstractInsdcReader::nextSequence(istream& input, Sequence& seq, vector<SequenceFeature>& features) const
+{
+  string record;
+  if (!nextRecord(input, record))
+    return false;
+  parseRecord(record, seq, features);
+  return true;
+}
+
+/******************************************************************************/
+
+bool AbstractInsdcReader::parseRecord(const string& record, Sequence& seq, vector<SequenceFeature>& features) const
+{
+  BPP_SEQ_COUNT_CALL("AbstractInsdcReader::parseRecord");
+  string name, raw;
+  vector<string> featureTable;
+  bool hasSequence = splitRecord_(record, name, raw, featureTable);
+  if (name == "")
+    throw IOException(getFormatName() + "::parseRecord. Record with no accession number.");
+
+  // Keep sequence characters only, skipping positions and blanks:
+  string content;
+  content.reserve(raw.size());
+  for (size_t i = 0; i < raw.size(); ++i)
+  {
+    char c = raw[i];
+    if (!isdigit(c) && !isspace(c))
+      content += static_cast<char>(toupper(c));
+  }
+
+  size_t first = features.size();
+  parseFeatureTable_(featureTable, name, features);
+  seq.setName(name);
+  seq.setContent(content);
+
+  SequenceWithAnnotation* swa = dynamic_cast<SequenceWithAnnotation*>(&seq);
+  if (swa && features.size() > first)
+  {
+    // Setting the content cleared any previous feature set, which now has the new size:
+    SequenceFeatureSet* set = 0;
+    bool attached = swa->hasAnnotation(SequenceFeatureSet::FEATURES);
+    if (attached)
+      set = dynamic_cast<SequenceFeatureSet*>(&swa->getAnnotation(SequenceFeatureSet::FEATURES));
+    else
+      set = new SequenceFeatureSet(content.size());
+    for (size_t i = first; i < features.size(); ++i)
+    {
+      // Records without sequence (e.g. contig records) can still have features:
+      if (features[i].getEnd() <= content.size())
+        set->addFeature(features[i]);
+    }
+    if (!attached)
+      swa->addAnnotation(set);
+  }
+  return hasSequence;
+}
+
+/******************************************************************************/
+
+void AbstractInsdcReader::parseFeatureTable_(const vector<string>& featureTable, const string& sequenceId, vector<SequenceFeature>& features) const
+{
+  SequenceFeature feature;
+  string location, qualifier, value;
+  bool inFeature = false, inQualifier = false, openQuote = false;
+  for (size_t i = 0; i <= featureTable.size(); ++i)
+  {
+    bool last = (i == featureTable.size());
+    const string* line = last ? 0 : &featureTable[i];
+    if (!last && TextTools::isEmpty(*line))
+      continue;
+    size_t start = 0;
+    bool newFeature = last || (*line)[0] != ' ';
+    if (!last)
+    {
+      start = line->find_first_not_of(' ', newFeature ? line->find(' ') : 0);
+      if (start == string::npos)
+        start = line->size();
+    }
+    bool newQualifier = !last && !newFeature && !openQuote && (*line)[start] == '/';
+
+    // Store the previous qualifier:
+    if (inQualifier && (newFeature || newQualifier))
+    {
+      if (value.size() >= 2 && value[0] == '"' && value[value.size() - 1] == '"')
+        value = value.substr(1, value.size() - 2);
+      // Quotes within values are doubled:
+      size_t pos = 0;
+      while ((pos = value.find("\"\"", pos)) != string::npos)
+        value.erase(pos++, 1);
+      if (feature.hasAttribute(qualifier))
+        feature.setAttribute(qualifier, feature.getAttribute(qualifier) + "," + value);
+      else
+        feature.setAttribute(qualifier, value);
+      inQualifier = false;
+    }
+    // Store the previous feature:
+    if (inFeature && newFeature)
+    {
+      parseLocation(location, feature, features);
+      inFeature = false;
+    }
+    if (last)
+      break;
+
+    string text = TextTools::removeSurroundingWhiteSpaces(line->substr(start));
+    if (newFeature)
+    {
+      string key = line->substr(0, line->find(' '));
+      feature = SequenceFeature(sequenceId, source_, key);
+      location = TextTools::removeWhiteSpaces(text);
+      inFeature = true;
+    }
+    else if (newQualifier)
+    {
+      size_t eq = text.find('=');
+      qualifier = text.substr(1, eq == string::npos ? string::npos : eq - 1);
+      value = (eq == string::npos ? "" : text.substr(eq + 1));
+      openQuote = (count(value.begin(), value.end(), '"') % 2 == 1);
+      inQualifier = true;
+    }
+    else if (inQualifier)
+    {
+      // Translations are split without separator, other values are split between words:
+      if (qualifier != "translation")
+        value += " ";
+      value += text;
+      if (count(text.begin(), text.end(), '"') % 2 == 1)
+        openQuote = !openQuote;
+    }
+    else if (inFeature)
+      location += TextTools::removeWhiteSpaces(text);
+  }
+}
+
+/******************************************************************************/
+
+namespace
+{
+  struct LocationSegment_
+  {
+    size_t begin;
+    size_t end;
+    bool complement;
+  };
+
+  size_t parsePosition_(const string& location, const string& position)
+  {
+    string digits;
+    for (size_t i = 0; i < position.size(); ++i)
+    {
+      if (isdigit(position[i]))
+        digits += position[i];
+      else if (position[i] != '<' && position[i] != '>')
+        throw IOException("AbstractInsdcReader::parseLocation. Invalid position in location: " + location);
+    }
+    if (digits.empty())
+      throw IOException("AbstractInsdcReader::parseLocation. Missing position in location: " + location);
+    size_t pos = TextTools::to<size_t>(digits);
+    if (pos == 0)
+      throw IOException("AbstractInsdcReader::parseLocation. Positions start at 1 in location: " + location);
+    return pos;
+  }
+
+  void parseLocationExpression_(const string& location, size_t& pos, bool complement, vector<LocationSegment_>& segments)
+  {
+    size_t end = location.find_first_of("(),", pos);
+    if (end != string::npos && location[end] == '(')
+    {
+      string op = location.substr(pos, end - pos);
+      pos = end + 1;
+      if (op == "complement")
+        parseLocationExpression_(location, pos, !complement, segments);
+      else if (op == "join" || op == "order")
+      {
+        parseLocationExpression_(location, pos, complement, segments);
+        while (pos < location.size() && location[pos] == ',')
+          parseLocationExpression_(location, ++pos, complement, segments);
+      }
+      else
+      {
+        // Other operators (e.g. gap()) do not describe positions on the sequence:
+        size_t depth = 1;
+        for (; pos < location.size() && depth > 0; ++pos)
+        {
+          if (location[pos] == '(') depth++;
+          else if (location[pos] == ')') depth--;
+        }
+        return;
+      }
+      if (pos >= location.size() || location[pos] != ')')
+        throw IOException("AbstractInsdcReader::parseLocation. Missing closing parenthesis in location: " + location);
+      pos++;
+      return;
+    }
+
+    if (end == string::npos)
+      end = location.size();
+    string range = location.substr(pos, end - pos);
+    pos = end;
+    // Segments on another entry are ignored:
+    if (range.find(':') != string::npos)
+      return;
+    LocationSegment_ segment;
+    segment.complement = complement;
+    size_t sep;
+    if ((sep = range.find("..")) != string::npos)
+    {
+      segment.begin = parsePosition_(location, range.substr(0, sep)) - 1;
+      segment.end = parsePosition_(location, range.substr(sep + 2));
+    }
+    else if ((sep = range.find('^')) != string::npos)
+    {
+      // A site between two bases:
+      segment.begin = parsePosition_(location, range.substr(0, sep));
+      segment.end = segment.begin;
+    }
+    else if ((sep = range.find('.')) != string::npos)
+    {
+      // A single base within a range:
+      segment.begin = parsePosition_(location, range.substr(0, sep)) - 1;
+      segment.end = parsePosition_(location, range.substr(sep + 1));
+    }
+    else
+    {
+      segment.end = parsePosition_(location, range);
+      segment.begin = segment.end - 1;
+    }
+    if (segment.begin > segment.end)
+      throw IOException("AbstractInsdcReader::parseLocation. Begin position is after end position in location: " + location);
+    segments.push_back(segment);
+  }
+}
+
+void AbstractInsdcReader::parseLocation(const string& location, const SequenceFeature& feature, vector<SequenceFeature>& features)
+{
+  string loc = TextTools::removeWhiteSpaces(location);
+  vector<LocationSegment_> segments;
+  size_t pos = 0;
+  parseLocationExpression_(loc, pos, false, segments);
+  if (pos != loc.size())
+    throw IOException("AbstractInsdcReader::parseLocation. Unexpected character in location: " + location);
+  for (size_t i = 0; i < segments.size(); ++i)
+  {
+    features.push_back(feature);
+    features.back().setRange(segments[i].begin, segments[i].end);
+    features.back().setStrand(segments[i].complement ? '-' : '+');
+  }
+}
+
+/******************************************************************************/
+
+void AbstractInsdcReader::appendSequencesFromStream(istream& input, SequenceContainer& sc) const
+{
+  BPP_SEQ_TIME_SCOPE("AbstractInsdcReader::appendSequencesFromStream");
+  if (!input)
+    throw IOException(getFormatName() + "::read: fail to open file");
+
+  // Names are checked here rather than by the container, which may scan all its sequences:
+  vector<string> existing = sc.getSequencesNames();
+  set<string> names(existing.begin(), existing.end());
+  vector<string> records;
+  string record;
+  bool more = true;
+  while (more)
+  {
+    records.clear();
+    while (records.size() < recordsPerBatch_ && (more = nextRecord(input, record)))
+      records.push_back(record);
+    if (!records.empty())
+      appendRecords_(records, sc, names);
+  }
+}
+
+void AbstractInsdcReader::appendRecords_(const vector<string>& records, SequenceContainer& sc, set<string>& names) const
+{
+  size_t n = records.size();
+  vector<Sequence*> sequences(n, 0);
+  // Not vector<bool>: its packed elements cannot be written concurrently.
+  vector<char> hasSequence(n, 0);
+  string error;
+  bool failed = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    SequenceWithAnnotation* seq = new SequenceWithAnnotation(sc.getAlphabet());
+    sequences[i] = seq;
+    try
+    {
+      vector<SequenceFeature> features;
+      hasSequence[i] = parseRecord(records[i], *seq, features);
+    }
+    catch (exception& e)
+    {
+#ifdef _OPENMP
+#pragma omp critical(AbstractInsdcReader_error)
+#endif
+      {
+        if (!failed)
+          error = e.what();
+        failed = true;
+      }
+    }
+  }
+  try
+  {
+    if (failed)
+      throw IOException(error);
+    for (size_t i = 0; i < n; ++i)
+    {
+      // Records without sequence are not added to the container:
+      if (!hasSequence[i])
+        continue;
+      if (!names.insert(sequences[i]->getName()).second)
+        throw Exception(getFormatName() + "::read. Duplicated sequence name: " + sequences[i]->getName());
+      sc.addSequence(*sequences[i], false);
+    }
+  }
+  catch (...)
+  {
+    for (size_t i = 0; i < n; ++i)
+      delete sequences[i];
+    throw;
+  }
+  for (size_t i = 0; i < n; ++i)
+    delete sequences[i];
+}
+
+/******************************************************************************/
+
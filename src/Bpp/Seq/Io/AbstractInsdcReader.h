@@ -0,0 +1,179 @@
+//
+// File: AbstractInsdcReader.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _ABSTRACTINSDCREADER_H_
+#define _ABSTRACTINSDCREADER_H_
+
+#include "AbstractISequence.h"
+#include "ISequenceStream.h"
+#include "../Sequence.h"
+#include "../SequenceFeatures.h"
+#include "../Container/SequenceContainer.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+#include <set>
+#include <iostream>
+
+namespace bpp
+{
+
+/**
+ * @brief Partial implementation of the readers for the INSDC flat file formats (GenBank, EMBL).
+ *
+ * Files are read one record at a time (up to the '//' terminator line), so that the memory used
+ * only depends on the size of the largest record. The feature table of each record is parsed into
+ * SequenceFeature objects: feature locations are converted to 0-based half-open intervals, and
+ * join() or order() locations are split into one feature per segment, sharing the same qualifiers.
+ * Qualifiers are stored as attributes, with quotes removed. Segments located on another entry
+ * (e.g. J00194.1:100..202) are ignored. When the sequence to fill is a SequenceWithAnnotation,
+ * the features are also attached to it as a SequenceFeatureSet.
+ *
+ * When reading a whole stream into a container, records are read by batches and the records of
+ * a batch are parsed in parallel if OpenMP is enabled.
+ */
+class AbstractInsdcReader :
+  public AbstractISequence,
+  public virtual ISequenceStream
+{
+  private:
+    std::string source_;
+    size_t recordsPerBatch_;
+
+  public:
+    /**
+     * @param source          The source name given to the parsed features.
+     * @param recordsPerBatch The number of records read before they are parsed, when reading into a container.
+     */
+    AbstractInsdcReader(const std::string& source, size_t recordsPerBatch = 64):
+      source_(source), recordsPerBatch_(recordsPerBatch > 0 ? recordsPerBatch : 1) {}
+
+    virtual ~AbstractInsdcReader() {}
+
+  public:
+    /**
+     * @name The AbstractISequence interface.
+     *
+     * Records without a sequence section (e.g. contig records) are skipped.
+     *
+     * @{
+     */
+    void appendSequencesFromStream(std::istream& input, SequenceContainer& sc) const;
+    /** @} */
+
+    /**
+     * @name The ISequenceStream interface.
+     *
+     * @{
+     */
+    bool nextSequence(std::istream& input, Sequence& seq) const;
+    /** @} */
+
+    /**
+     * @brief Read the next record from a stream, and get its features.
+     *
+     * @param input    The stream to read.
+     * @param seq      The sequence to fill.
+     * @param features [out] The features of the record are appended to this vector.
+     * @return true if a record was read, false at the end of the stream.
+     * @throw IOException If the record is malformed.
+     */
+    bool nextSequence(std::istream& input, Sequence& seq, std::vector<SequenceFeature>& features) const;
+
+    /**
+     * @brief Get the raw text of the next record in a stream.
+     *
+     * @param input  The stream to read.
+     * @param record [out] The lines of the record, up to and including the '//' terminator.
+     * @return true if a record was read, false at the end of the stream.
+     */
+    bool nextRecord(std::istream& input, std::string& record) const;
+
+    /**
+     * @brief Parse the raw text of a record.
+     *
+     * This method does not modify the reader and can be called concurrently.
+     *
+     * Records without a sequence section (e.g. contig records) give an empty sequence.
+     *
+     * @param record   The text of the record, as returned by nextRecord.
+     * @param seq      The sequence to fill.
+     * @param features [out] The features of the record are appended to this vector.
+     * @return true if the record has a sequence section.
+     * @throw IOException If the record is malformed.
+     */
+    bool parseRecord(const std::string& record, Sequence& seq, std::vector<SequenceFeature>& features) const;
+
+    size_t getNumberOfRecordsPerBatch() const { return recordsPerBatch_; }
+    void setNumberOfRecordsPerBatch(size_t n) { recordsPerBatch_ = (n > 0 ? n : 1); }
+
+    /**
+     * @brief Convert a feature location to features.
+     *
+     * @param location The location, as found in a feature table.
+     * @param feature  The model for the new features (sequence id, type, attributes).
+     * @param features [out] One feature per segment of the location is appended to this vector.
+     * @throw IOException If the location is malformed.
+     */
+    static void parseLocation(const std::string& location, const SequenceFeature& feature, std::vector<SequenceFeature>& features);
+
+  protected:
+    /**
+     * @brief Split a record into its components.
+     *
+     * @param record       The text of the record.
+     * @param name         [out] The name of the sequence.
+     * @param content      [out] The raw sequence lines, concatenated.
+     * @param featureTable [out] The lines of the feature table, without their first five characters,
+     * so that feature keys start at column 0 and locations and qualifiers at column 16.
+     * @return true if the record has a sequence section.
+     */
+    virtual bool splitRecord_(const std::string& record, std::string& name, std::string& content, std::vector<std::string>& featureTable) const = 0;
+
+  private:
+    void parseFeatureTable_(const std::vector<std::string>& featureTable, const std::string& sequenceId, std::vector<SequenceFeature>& features) const;
+
+    void appendRecords_(const std::vector<std::string>& records, SequenceContainer& sc, std::set<std::string>& names) const;
+};
+
+} //end of namespace bpp.
+
+#endif // _ABSTRACTINSDCREADER_H_
+
@@ -42,6 +42,7 @@
 #include "Phylip.h"
 #include "Fasta.h"
 #include "Clustal.h"
+#include "Stockholm.h"
 #include "Dcse.h"
 #include "NexusIoSequence.h"
 
@@ -113,6 +114,10 @@ IAlignment* BppOAlignmentReaderFormat::read(const std::string& description)
   {
     iAln.reset(new NexusIOSequence());
   }
+  else if (format == "Stockholm")
+  {
+    iAln.reset(new Stockholm());
+  }
   else
   {
     throw Exception("Sequence format '" + format + "' unknown.");
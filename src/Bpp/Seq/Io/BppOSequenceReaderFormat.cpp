@@ -44,6 +44,7 @@
 #include "Clustal.h"
 #include "Dcse.h"
 #include "GenBank.h"
+#include "Embl.h"
 #include "NexusIoSequence.h"
 
 #include <Bpp/Text/KeyvalTools.h>
@@ -114,6 +115,10 @@ ISequence* BppOSequenceReaderFormat::read(const std::string& description)
   {
     iSeq.reset(new GenBank()); // This is required to remove a strict-aliasing warning in gcc 4.4
   }
+  else if (format == "EMBL")
+  {
+    iSeq.reset(new Embl());
+  }
   else if (format == "Nexus")
   {
     iSeq.reset(new NexusIOSequence());
@@ -39,6 +39,8 @@
 
 #include "BppOSequenceStreamReaderFormat.h"
 #include "Fasta.h"
+#include "GenBank.h"
+#include "Embl.h"
 
 #include <Bpp/Text/KeyvalTools.h>
 
@@ -60,6 +62,14 @@ ISequenceStream* BppOSequenceStreamReaderFormat::read(const std::string& descrip
     bool extended    = ApplicationTools::getBooleanParameter("extended", unparsedArguments_, false, "", true, false);
     iSeq.reset(new Fasta(100, true, extended, strictNames));
   }
+  else if (format == "GenBank")
+  {
+    iSeq.reset(new GenBank());
+  }
+  else if (format == "EMBL")
+  {
+    iSeq.reset(new Embl());
+  }
   else
   {
     throw Exception("Sequence format '" + format + "' unknown.");
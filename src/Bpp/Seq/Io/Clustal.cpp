@@ -38,6 +38,9 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include "Clustal.h"
+#include "InterleavedAlignmentBuilder.h"
+#include "StateCharTable.h"
+#include "../Instrumentation.h"
 #include <Bpp/Text/TextTools.h>
 #include <Bpp/Text/StringTokenizer.h>
 #include <Bpp/Io/FileTools.h>
@@ -51,11 +54,12 @@ using namespace std;
 
 void Clustal::appendAlignmentFromStream(std::istream& input, SiteContainer & sc) const
 {
+  BPP_SEQ_TIME_SCOPE("Clustal::appendAlignmentFromStream");
   // Checking the existence of specified file
   if (!input) { throw IOException ("Clustal::read : fail to open file"); }
 
-  const Alphabet * alpha = sc.getAlphabet();
-  vector<BasicSequence> sequences;
+  // Residues are encoded while reading blocks:
+  InterleavedAlignmentBuilder builder(sc.getAlphabet());
 
   string lineRead("");
 
@@ -84,7 +88,7 @@ void Clustal::appendAlignmentFromStream(std::istream& input, SiteContainer & sc)
   //Read first sequences block:
   bool test = true;
   do {
-    sequences.push_back(BasicSequence(TextTools::removeSurroundingWhiteSpaces(lineRead.substr(0, beginSeq - nbSpacesBeforeSeq_)), lineRead.substr(beginSeq), alpha));
+    builder.addSequence(TextTools::removeSurroundingWhiteSpaces(lineRead.substr(0, beginSeq - nbSpacesBeforeSeq_)), lineRead, beginSeq);
     getline(input, lineRead, '\n');
     countSequences++;
     test = !TextTools::isEmpty(lineRead) && !TextTools::isEmpty(lineRead.substr(0, beginSeq - nbSpacesBeforeSeq_));
@@ -99,15 +103,14 @@ void Clustal::appendAlignmentFromStream(std::istream& input, SiteContainer & sc)
       // Complete sequences
       if (TextTools::isEmpty(lineRead))
         throw IOException("Clustal::read. Bad intput file.");
-       sequences[i].append(lineRead.substr(beginSeq));
+      builder.append(i, lineRead, beginSeq);
       getline(input, lineRead, '\n');
     }
     //At this point, lineRead is the first line after the current block.
     lineRead = FileTools::getNextLine(input);
   }
 
-  for (unsigned int i = 0; i < countSequences; ++i)
-    sc.addSequence(sequences[i], checkNames_);
+  builder.fill(sc, checkNames_);
   sc.setGeneralComments(comments);
 }
 
@@ -118,21 +121,33 @@ void Clustal::writeAlignment(std::ostream& output, const SiteContainer& sc) cons
   if (sc.getNumberOfSequences() == 0)
     return;
 
-  vector<string> text;
+  // Format all sequences once with the alphabet char table, then write blocks to a buffer:
+  StateCharTable table(sc.getAlphabet());
+  vector<string> names = sc.getSequencesNames();
+  vector<string> text(names.size());
   size_t length = 0;
-  for (size_t i = 0; i < sc.getNumberOfSequences(); ++i ) {
-    const Sequence& seq = sc.getSequence(i);
-    if (seq.getName().size() > length)
-      length = seq.getName().size();
-    text.push_back(sc.getSequence(i).toString());
+  for (size_t i = 0; i < names.size(); ++i) {
+    if (names[i].size() > length)
+      length = names[i].size();
+    text[i] = table.toString(sc.getSequence(i));
   }
   length += nbSpacesBeforeSeq_;
-  for (unsigned int j = 0; j < text[0].size(); j += charsByLine_) {
-    for (unsigned int i = 0; i < sc.getNumberOfSequences(); ++i ) {
-      output << TextTools::resizeRight(sc.getSequence(i).getName(), length);
-      output << text[i].substr(j, charsByLine_) << endl;
+  for (size_t i = 0; i < names.size(); ++i)
+    names[i] = TextTools::resizeRight(names[i], length);
+
+  string buffer;
+  for (size_t j = 0; j < text[0].size(); j += charsByLine_) {
+    for (size_t i = 0; i < names.size(); ++i) {
+      buffer += names[i];
+      buffer.append(text[i], j, charsByLine_);
+      buffer += '\n';
+    }
+    buffer += '\n';
+    if (buffer.size() >= StateCharTable::BUFFER_SIZE) {
+      output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+      buffer.clear();
     }
-    output << endl;
   }
+  output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
 }
 
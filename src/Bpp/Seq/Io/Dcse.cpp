@@ -40,6 +40,7 @@ knowledge of the CeCILL license and that you accept its terms.
 #include "Dcse.h"
 #include "AbstractIAlignment.h"
 #include "../Sequence.h"
+#include "../Instrumentation.h"
 #include "../Container/SequenceContainer.h"
 #include "../Container/VectorSequenceContainer.h"
 #include <Bpp/Text/TextTools.h>
@@ -51,6 +52,7 @@ using namespace std;
 
 void DCSE::appendAlignmentFromStream(istream& input, SiteContainer& sc) const
 {
+  BPP_SEQ_TIME_SCOPE("DCSE::appendAlignmentFromStream");
   // Checking the existence of specified file
   if (!input) { throw IOException ("DCSE::read : fail to open file"); }
 
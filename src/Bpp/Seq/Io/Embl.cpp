@@ -0,0 +1,87 @@
+//
+// File: Embl.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "Embl.h"
+
+#include <Bpp/Text/StringTokenizer.h>
+
+using namespace bpp;
+using namespace std;
+
+/****************************************************************************************/
+
+bool Embl::splitRecord_(const string& record, string& name, string& content, vector<string>& featureTable) const
+{
+  string id;
+  bool inSequence = false;
+  size_t pos = 0;
+  while (pos < record.size())
+  {
+    size_t next = record.find('\n', pos);
+    if (next == string::npos)
+      next = record.size();
+    size_t len = next - pos;
+    if (len >= 2 && record[pos] == '/' && record[pos + 1] == '/')
+      break;
+    // Each line starts with a two-letter code, sequence lines with blanks:
+    if (len > 5 && record.compare(pos, 2, "FT") == 0)
+      featureTable.push_back(record.substr(pos + 5, len - 5));
+    else if (len > 5 && name == "" && record.compare(pos, 2, "AC") == 0)
+    {
+      StringTokenizer st(record.substr(pos + 5, len - 5), " ;");
+      if (st.hasMoreToken()) name = st.nextToken();
+    }
+    else if (len > 5 && record.compare(pos, 2, "ID") == 0)
+    {
+      StringTokenizer st(record.substr(pos + 5, len - 5), " ;");
+      if (st.hasMoreToken()) id = st.nextToken();
+    }
+    else if (record.compare(pos, 2, "SQ") == 0)
+      inSequence = true;
+    else if (inSequence && len > 0 && record[pos] == ' ')
+      content.append(record, pos, len);
+    pos = next + 1;
+  }
+  if (name == "")
+    name = id;
+  return inSequence;
+}
+
+/****************************************************************************************/
+
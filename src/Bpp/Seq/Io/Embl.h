@@ -0,0 +1,90 @@
+//
+// File: Embl.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _EMBL_H_
+#define _EMBL_H_
+
+#include "AbstractInsdcReader.h"
+
+namespace bpp
+{
+
+/**
+ * @brief The EMBL sequence file format.
+ *
+ * Sequences are named after the first accession number of their record (AC line), or after the
+ * entry name (ID line) if there is no AC line. Features are read from the FT lines, see
+ * AbstractInsdcReader for details.
+ *
+ * See http://www.ebi.ac.uk/ena/submit/data-formats for the format specification.
+ */
+class Embl :
+  public AbstractInsdcReader
+{
+  public:
+  
+    /**
+     * @brief Build a new Embl object.
+     */
+    Embl(): AbstractInsdcReader("EMBL") {}
+
+    virtual ~Embl() {}
+
+  public:
+
+    /**
+     * @name The IOSequence interface.
+     *
+     * @{
+     */
+    const std::string getFormatName() const { return "EMBL file"; };
+    const std::string getFormatDescription() const
+    {
+      return "Sequences following the EMBL data base format.";
+    }
+    /** @} */
+
+  protected:
+    bool splitRecord_(const std::string& record, std::string& name, std::string& content, std::vector<std::string>& featureTable) const;
+};
+
+} //end of namespace bpp.
+
+#endif // _EMBL_H_
+
@@ -42,8 +42,11 @@ knowledge of the CeCILL license and that you accept its terms.
 #include "Fasta.h"
 
 #include <fstream>
+#include <cctype>
 
 #include "../StringSequenceTools.h"
+#include "../SequenceWithAnnotationTools.h"
+#include "../Instrumentation.h"
 #include <Bpp/Text/TextTools.h>
 #include <Bpp/Text/StringTokenizer.h>
 #include <Bpp/Io/FileTools.h>
@@ -54,6 +57,17 @@ using namespace std;
 /******************************************************************************/
 
 bool Fasta::nextSequence(istream& input, Sequence& seq) const {
+  return nextSequence_(input, seq, 0);
+}
+
+bool Fasta::nextSoftMaskedSequence(istream& input, Sequence& seq, RunLengthSequenceMask& mask) const {
+  return nextSequence_(input, seq, &mask);
+}
+
+/******************************************************************************/
+
+bool Fasta::nextSequence_(istream& input, Sequence& seq, RunLengthSequenceMask* mask) const {
+  BPP_SEQ_TIME_SCOPE("Fasta::nextSequence");
   if (!input)
     throw IOException("Fasta::nextSequence: can't read from istream input");
   string seqname = "";
@@ -61,6 +75,7 @@ bool Fasta::nextSequence(istream& input, Sequence& seq) const {
   Comments seqcmts;
   short seqcpt = 0;
   string linebuffer = "";
+  vector<size_t> maskBegins, maskEnds;
   char c;
   while (!input.eof())
   {
@@ -83,7 +98,21 @@ bool Fasta::nextSequence(istream& input, Sequence& seq) const {
     }
     if (c != '>' && !TextTools::isWhiteSpaceCharacter(c)) {
       // Sequence content
-      content += TextTools::toUpper(TextTools::removeWhiteSpaces(linebuffer));
+      string line = TextTools::removeWhiteSpaces(linebuffer);
+      if (mask) {
+        // Lower case runs are masked
+        for (size_t i = 0; i < line.size(); ++i) {
+          if (islower(static_cast<unsigned char>(line[i]))) {
+            if (!maskBegins.empty() && maskEnds.back() == content.size() + i)
+              maskEnds.back()++;
+            else {
+              maskBegins.push_back(content.size() + i);
+              maskEnds.push_back(content.size() + i + 1);
+            }
+          }
+        }
+      }
+      content += TextTools::toUpper(line);
     }
   }
 
@@ -108,6 +137,11 @@ bool Fasta::nextSequence(istream& input, Sequence& seq) const {
   }
   seq.setName(seqname);
   seq.setContent(content);
+  if (mask) {
+    mask->init(seq);
+    for (size_t i = 0; i < maskBegins.size(); ++i)
+      mask->setMask(maskBegins[i], maskEnds[i], true);
+  }
   return res;
 }
 
@@ -146,6 +180,7 @@ void Fasta::writeSequence(ostream& output, const Sequence& seq) const
 
 void Fasta::appendSequencesFromStream(istream& input, SequenceContainer& vsc) const
 {
+  BPP_SEQ_TIME_SCOPE("Fasta::appendSequencesFromStream");
   if (!input)
     throw IOException("Fasta::appendFromStream: can't read from istream input");
   char c = '\n';
@@ -55,6 +55,8 @@ knowledge of the CeCILL license and that you accept its terms.
 namespace bpp
 {
 
+class RunLengthSequenceMask;
+
 /**
  * @brief The fasta sequence file format.
  *
@@ -77,6 +79,9 @@ class Fasta:
     bool extended_;            // If using HUPO-PSI extensions
     bool strictNames_;         // If name is between '>' and first space
 
+  private:
+    bool nextSequence_(std::istream& input, Sequence& seq, RunLengthSequenceMask* mask) const;
+
   public:
   
     /**
@@ -145,6 +150,20 @@ class Fasta:
     bool nextSequence(std::istream& input, Sequence& seq) const;
     /** @} */
 
+    /**
+     * @brief Read a soft-masked sequence from stream.
+     *
+     * Sequence content is converted to upper case as in nextSequence,
+     * and runs of lower case characters are stored in a mask.
+     *
+     * @param input The stream to read.
+     * @param seq The sequence to fill.
+     * @param mask The mask to fill, resized to the sequence length.
+     * @return true if a sequence was read or false if not.
+     * @throw Exception IOExecption and Sequence related Exceptions.
+     */
+    bool nextSoftMaskedSequence(std::istream& input, Sequence& seq, RunLengthSequenceMask& mask) const;
+
     /**
      * @name The OSequenceStream interface.
      *
@@ -177,6 +196,8 @@ class Fasta:
      */
     void strictNames(bool yn) { strictNames_ = yn; }
 
+  public:
+
     /**
      * @brief The SequenceFileIndex class for Fasta format
      * @author Sylvain Gaillard
@@ -47,39 +47,52 @@ using namespace std;
 
 /****************************************************************************************/
 
-void GenBank::appendSequencesFromStream(std::istream& input, SequenceContainer& vsc) const
+bool GenBank::splitRecord_(const string& record, string& name, string& content, vector<string>& featureTable) const
 {
-  if (!input) { throw IOException ("GenBank::read: fail to open file"); }
-
-  string temp, name, sequence = "";  // Initialization
-
-  // Main loop : for all file lines
-  while (!input.eof())
+  string locus;
+  bool hasSequence = false;
+  // Sections spanning several lines: none, features or sequence.
+  enum { NONE, FEATURES, ORIGIN } section = NONE;
+  size_t pos = 0;
+  while (pos < record.size())
   {
-    getline(input, temp, '\n');  // Copy current line in temporary string
-
-    if(temp.size() >= 9 && temp.substr(0,9) == "ACCESSION")
-    {
-      name = TextTools::removeSurroundingWhiteSpaces(temp.substr(10));
-      StringTokenizer st(name, " ");
-      name = st.nextToken();
-      //cout << name << endl;
-    }
-    if (temp.size() >=6 && temp.substr(0,6) == "ORIGIN")
+    size_t next = record.find('\n', pos);
+    if (next == string::npos)
+      next = record.size();
+    size_t len = next - pos;
+    if (len >= 2 && record[pos] == '/' && record[pos + 1] == '/')
+      break;
+    if (len > 0 && record[pos] != ' ')
     {
-      sequence = "";
-      getline(input, temp, '\n');  // Copy current line in temporary string
-      while (!input.eof() && temp.size() > 2 && temp.substr(0,2) != "//")
+      // A new keyword:
+      section = NONE;
+      if (record.compare(pos, 9, "ACCESSION") == 0 && len > 10)
+      {
+        StringTokenizer st(record.substr(pos + 10, len - 10), " ");
+        if (st.hasMoreToken()) name = st.nextToken();
+      }
+      else if (record.compare(pos, 5, "LOCUS") == 0 && len > 5)
+      {
+        StringTokenizer st(record.substr(pos + 5, len - 5), " ");
+        if (st.hasMoreToken()) locus = st.nextToken();
+      }
+      else if (record.compare(pos, 8, "FEATURES") == 0)
+        section = FEATURES;
+      else if (record.compare(pos, 6, "ORIGIN") == 0)
       {
-        sequence += TextTools::removeWhiteSpaces(temp.substr(10));
-        getline(input, temp, '\n');  // Copy current line in temporary string
+        section = ORIGIN;
+        hasSequence = true;
       }
-      if(name == "") throw Exception("GenBank::read(). Sequence with no ACCESSION number!");
-      Sequence* seq = new BasicSequence(name, sequence, vsc.getAlphabet());
-      vsc.addSequence(*seq, true);
-      name = "";
     }
-  }  
+    else if (section == FEATURES && len > 5)
+      featureTable.push_back(record.substr(pos + 5, len - 5));
+    else if (section == ORIGIN)
+      content.append(record, pos, len);
+    pos = next + 1;
+  }
+  if (name == "")
+    name = locus;
+  return hasSequence;
 }
 
 /****************************************************************************************/
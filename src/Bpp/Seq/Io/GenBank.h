@@ -40,10 +40,7 @@ knowledge of the CeCILL license and that you accept its terms.
 #ifndef _GENBANK_H_
 #define _GENBANK_H_
 
-#include "AbstractISequence.h"
-#include "../Sequence.h"
-#include "../Container/SequenceContainer.h"
-#include "../Container/VectorSequenceContainer.h"
+#include "AbstractInsdcReader.h"
 
 namespace bpp
 {
@@ -51,30 +48,26 @@ namespace bpp
 /**
  * @brief The GenBank sequence file format.
  *
- * For now, only read raw sequences. Features are not yet supported.
+ * Sequences are named after the first accession number of their record, or after the
+ * locus name if there is no ACCESSION line. Features are read from the FEATURES table,
+ * see AbstractInsdcReader for details.
+ *
+ * See http://www.ncbi.nlm.nih.gov/Sitemap/samplerecord.html for the format specification.
  */
 class GenBank :
-  public AbstractISequence
+  public AbstractInsdcReader
 {
   public:
   
     /**
      * @brief Build a new GenBank object.
      */
-    GenBank() {}
+    GenBank(): AbstractInsdcReader("GenBank") {}
 
     virtual ~GenBank() {}
 
   public:
 
-    /**
-     * @name The AbstractISequence interface.
-     *
-     * @{
-     */
-    void appendSequencesFromStream(std::istream& input, SequenceContainer& sc) const;
-    /** @} */
-  
     /**
      * @name The IOSequence interface.
      *
@@ -86,6 +79,9 @@ class GenBank :
       return "Sequences following the GenBank data base format.";
     }
     /** @} */
+
+  protected:
+    bool splitRecord_(const std::string& record, std::string& name, std::string& content, std::vector<std::string>& featureTable) const;
 };
 
 } //end of namespace bpp.
@@ -0,0 +1,179 @@
+//
+// File: GffFeatureReader.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "GffFeatureReader.h"
+#include "../Instrumentation.h"
+
+#include <Bpp/Exceptions.h>
+#include <Bpp/Text/TextTools.h>
+
+// From the STL:
+#include <cstdlib>
+#include <cctype>
+
+using namespace std;
+using namespace bpp;
+
+/******************************************************************************/
+
+string GffFeatureReader::decode(const string& field)
+{
+  if (field.find('%') == string::npos)
+    return field;
+  string decoded;
+  decoded.reserve(field.size());
+  for (size_t i = 0; i < field.size(); ++i)
+  {
+    if (field[i] == '%' && i + 2 < field.size() && isxdigit(field[i + 1]) && isxdigit(field[i + 2]))
+    {
+      decoded += static_cast<char>(strtol(field.substr(i + 1, 2).c_str(), 0, 16));
+      i += 2;
+    }
+    else
+    {
+      decoded += field[i];
+    }
+  }
+  return decoded;
+}
+
+/******************************************************************************/
+
+bool GffFeatureReader::nextFeature(istream& input, SequenceFeature& feature) const
+{
+  BPP_SEQ_TIME_SCOPE("GffFeatureReader::nextFeature");
+  string line;
+  while (getline(input, line))
+  {
+    if (!line.empty() && line[line.size() - 1] == '\r')
+      line.erase(line.size() - 1);
+    if (TextTools::startsWith(line, "##FASTA"))
+      return false;
+    if (line.empty() || line[0] == '#' || TextTools::isEmpty(line))
+      continue;
+
+    //Split the nine columns:
+    vector<string> fields;
+    size_t start = 0;
+    for (size_t tab = line.find('\t'); tab != string::npos; tab = line.find('\t', start))
+    {
+      fields.push_back(line.substr(start, tab - start));
+      start = tab + 1;
+    }
+    fields.push_back(line.substr(start));
+    if (fields.size() < 9)
+      throw IOException("GffFeatureReader::nextFeature. Expected 9 columns, found " + TextTools::toString(fields.size()) + " in line: " + line);
+
+    if (!TextTools::isDecimalInteger(fields[3]) || !TextTools::isDecimalInteger(fields[4]))
+      throw IOException("GffFeatureReader::nextFeature. Bad coordinates in line: " + line);
+    size_t begin = TextTools::to<size_t>(fields[3]);
+    size_t end   = TextTools::to<size_t>(fields[4]);
+    if (begin == 0 || end + 1 < begin)
+      throw IOException("GffFeatureReader::nextFeature. Bad coordinates in line: " + line);
+
+    feature = SequenceFeature(decode(fields[0]), decode(fields[1]), decode(fields[2]), begin - 1, end);
+    if (fields[5] != ".")
+    {
+      if (!TextTools::isDecimalNumber(fields[5]))
+        throw IOException("GffFeatureReader::nextFeature. Bad score in line: " + line);
+      feature.setScore(TextTools::toDouble(fields[5]));
+    }
+    if (fields[6].size() != 1 || string("+-.?").find(fields[6][0]) == string::npos)
+      throw IOException("GffFeatureReader::nextFeature. Bad strand in line: " + line);
+    feature.setStrand(fields[6][0]);
+    if (fields[7] != ".")
+    {
+      if (fields[7].size() != 1 || fields[7][0] < '0' || fields[7][0] > '2')
+        throw IOException("GffFeatureReader::nextFeature. Bad phase in line: " + line);
+      feature.setPhase(fields[7][0] - '0');
+    }
+
+    //Attributes:
+    const string& attributes = fields[8];
+    if (attributes != ".")
+    {
+      size_t pos = 0;
+      while (pos < attributes.size())
+      {
+        size_t sc = attributes.find(';', pos);
+        if (sc == string::npos) sc = attributes.size();
+        string attribute = TextTools::removeSurroundingWhiteSpaces(attributes.substr(pos, sc - pos));
+        if (!attribute.empty())
+        {
+          size_t eq = attribute.find('=');
+          if (eq == string::npos)
+            throw IOException("GffFeatureReader::nextFeature. Bad attribute '" + attribute + "' in line: " + line);
+          feature.setAttribute(decode(attribute.substr(0, eq)), decode(attribute.substr(eq + 1)));
+        }
+        pos = sc + 1;
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
+/******************************************************************************/
+
+void GffFeatureReader::readFeatures(istream& input, vector<SequenceFeature>& features) const
+{
+  SequenceFeature feature;
+  while (nextFeature(input, feature))
+    features.push_back(feature);
+}
+
+/******************************************************************************/
+
+size_t GffFeatureReader::readFeatures(istream& input, const string& sequenceId, SequenceFeatureSet& features) const
+{
+  SequenceFeature feature;
+  size_t n = 0;
+  while (nextFeature(input, feature))
+  {
+    if (feature.getSequenceId() == sequenceId)
+    {
+      features.addFeature(feature);
+      ++n;
+    }
+  }
+  return n;
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,110 @@
+//
+// File: GffFeatureReader.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _GFFFEATUREREADER_H_
+#define _GFFFEATUREREADER_H_
+
+#include "../SequenceFeatures.h"
+
+// From the STL:
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Streaming reader for features in the GFF3 format.
+ *
+ * Records are read one line at a time, so that files of any size can be processed with constant memory.
+ * Comment and directive lines are skipped, and reading stops at a ##FASTA directive.
+ * GFF3 coordinates (1-based, inclusive) are converted to 0-based half-open intervals,
+ * and escaped characters (%XX) in attribute values are decoded.
+ *
+ * See http://www.sequenceontology.org/gff3.shtml for the format specification.
+ */
+class GffFeatureReader
+{
+  public:
+    GffFeatureReader() {}
+    virtual ~GffFeatureReader() {}
+
+  public:
+    /**
+     * @brief Read the next feature in a stream.
+     *
+     * @param input   The stream to read.
+     * @param feature [out] The feature to fill.
+     * @return true if a feature was read, false at the end of the feature section.
+     * @throw IOException If a record is malformed.
+     */
+    bool nextFeature(std::istream& input, SequenceFeature& feature) const;
+
+    /**
+     * @brief Read all features in a stream.
+     *
+     * @param input    The stream to read.
+     * @param features [out] The features are appended to this vector.
+     * @throw IOException If a record is malformed.
+     */
+    void readFeatures(std::istream& input, std::vector<SequenceFeature>& features) const;
+
+    /**
+     * @brief Read the features of one sequence and add them to a feature set.
+     *
+     * @param input      The stream to read.
+     * @param sequenceId Only features on this sequence are kept.
+     * @param features   The set to fill.
+     * @return The number of features added.
+     * @throw IOException If a record is malformed.
+     * @throw IndexOutOfBoundsException If a feature ends after the annotated sequence.
+     */
+    size_t readFeatures(std::istream& input, const std::string& sequenceId, SequenceFeatureSet& features) const;
+
+    /**
+     * @return A GFF3 field with escaped characters (%XX) decoded.
+     */
+    static std::string decode(const std::string& field);
+};
+
+} //end of namespace bpp.
+
+#endif //_GFFFEATUREREADER_H_
+
@@ -0,0 +1,147 @@
+//
+// File: InterleavedAlignmentBuilder.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "InterleavedAlignmentBuilder.h"
+#include "../Alphabet/AlphabetTools.h"
+#include "../Container/VectorSiteContainer.h"
+#include "../Sequence.h"
+
+#include <Bpp/Text/TextTools.h>
+
+using namespace bpp;
+using namespace std;
+
+/******************************************************************************/
+
+InterleavedAlignmentBuilder::InterleavedAlignmentBuilder(const Alphabet* alphabet, size_t numberOfSites):
+  alphabet_(alphabet),
+  codingSize_(AlphabetTools::getAlphabetCodingSize(alphabet)),
+  states_(256, 0),
+  supported_(256, false),
+  numberOfSites_(numberOfSites),
+  names_(),
+  sequences_(),
+  pending_()
+{
+  if (codingSize_ == 1)
+  {
+    // Only ASCII characters can be states:
+    for (size_t c = 0; c < 128; ++c)
+    {
+      string s(1, static_cast<char>(c));
+      if (alphabet_->isCharInAlphabet(s))
+      {
+        states_[c] = alphabet_->charToInt(s);
+        supported_[c] = true;
+      }
+    }
+  }
+}
+
+/******************************************************************************/
+
+size_t InterleavedAlignmentBuilder::addSequence(const string& name, const string& line, size_t begin)
+{
+  size_t index = names_.size();
+  names_.push_back(name);
+  sequences_.push_back(vector<int>());
+  sequences_.back().reserve(numberOfSites_);
+  pending_.push_back("");
+  encode_(index, line, begin);
+  return index;
+}
+
+void InterleavedAlignmentBuilder::append(size_t index, const string& line, size_t begin)
+{
+  if (index >= names_.size())
+    throw IndexOutOfBoundsException("InterleavedAlignmentBuilder::append. Invalid sequence index.", index, 0, names_.size());
+  encode_(index, line, begin);
+}
+
+void InterleavedAlignmentBuilder::encode_(size_t index, const string& line, size_t begin)
+{
+  vector<int>& sequence = sequences_[index];
+  for (size_t i = begin; i < line.size(); ++i)
+  {
+    char c = line[i];
+    if (c == ' ' || c == '\t' || c == '\r')
+      continue;
+    if (codingSize_ == 1)
+    {
+      size_t k = static_cast<unsigned char>(c);
+      if (!supported_[k])
+        throw BadCharException(string(1, c), "InterleavedAlignmentBuilder. Invalid character in sequence " + names_[index] + ".", alphabet_);
+      sequence.push_back(states_[k]);
+    }
+    else
+    {
+      string& state = pending_[index];
+      state += c;
+      if (state.size() == codingSize_)
+      {
+        sequence.push_back(alphabet_->charToInt(state));
+        state.clear();
+      }
+    }
+  }
+}
+
+/******************************************************************************/
+
+void InterleavedAlignmentBuilder::fill(SiteContainer& sc, bool checkNames)
+{
+  for (size_t i = 0; i < names_.size(); ++i)
+    if (!pending_[i].empty())
+      throw Exception("InterleavedAlignmentBuilder::fill. Incomplete state at the end of sequence " + names_[i] + ".");
+
+  VectorSiteContainer* vsc = dynamic_cast<VectorSiteContainer*>(&sc);
+  if (vsc)
+    vsc->addSequences(names_, sequences_, checkNames);
+  else
+  {
+    for (size_t i = 0; i < names_.size(); ++i)
+      sc.addSequence(BasicSequence(names_[i], sequences_[i], alphabet_), checkNames);
+  }
+  names_.clear();
+  sequences_.clear();
+  pending_.clear();
+}
+
+/******************************************************************************/
+
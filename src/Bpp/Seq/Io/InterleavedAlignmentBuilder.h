@@ -0,0 +1,142 @@
+//
+// File: InterleavedAlignmentBuilder.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _INTERLEAVEDALIGNMENTBUILDER_H_
+#define _INTERLEAVEDALIGNMENTBUILDER_H_
+
+#include "../Alphabet/Alphabet.h"
+#include "../Container/SiteContainer.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Parsing core for the interleaved alignment formats (Phylip, Clustal, Nexus).
+ *
+ * Residues are encoded as soon as a line is read, directly into one state buffer per sequence,
+ * using a character lookup table built once for the alphabet. Blanks within lines are skipped.
+ * When all blocks have been read, the container is filled in one go: VectorSiteContainer objects
+ * are built site by site, avoiding one transposition per sequence.
+ */
+class InterleavedAlignmentBuilder
+{
+  private:
+    const Alphabet* alphabet_;
+    unsigned int codingSize_;
+    std::vector<int> states_;
+    std::vector<bool> supported_;
+    size_t numberOfSites_;
+    std::vector<std::string> names_;
+    std::vector< std::vector<int> > sequences_;
+    std::vector<std::string> pending_; //Incomplete states, for alphabets with multi-character states.
+
+  public:
+    /**
+     * @param alphabet      The alphabet of the alignment.
+     * @param numberOfSites The expected number of sites (0 if unknown), used to preallocate sequences.
+     */
+    InterleavedAlignmentBuilder(const Alphabet* alphabet, size_t numberOfSites = 0);
+
+    InterleavedAlignmentBuilder(const InterleavedAlignmentBuilder& iab):
+      alphabet_(iab.alphabet_), codingSize_(iab.codingSize_), states_(iab.states_), supported_(iab.supported_),
+      numberOfSites_(iab.numberOfSites_), names_(iab.names_), sequences_(iab.sequences_), pending_(iab.pending_) {}
+
+    InterleavedAlignmentBuilder& operator=(const InterleavedAlignmentBuilder& iab)
+    {
+      alphabet_      = iab.alphabet_;
+      codingSize_    = iab.codingSize_;
+      states_        = iab.states_;
+      supported_     = iab.supported_;
+      numberOfSites_ = iab.numberOfSites_;
+      names_         = iab.names_;
+      sequences_     = iab.sequences_;
+      pending_       = iab.pending_;
+      return *this;
+    }
+
+    virtual ~InterleavedAlignmentBuilder() {}
+
+  public:
+    /**
+     * @brief Add a new sequence, with the content of its first block.
+     *
+     * @param name  The name of the sequence.
+     * @param line  The line holding the content.
+     * @param begin The position of the content in the line.
+     * @return The index of the new sequence.
+     * @throw BadCharException If the content has characters which are not in the alphabet.
+     */
+    size_t addSequence(const std::string& name, const std::string& line, size_t begin = 0);
+
+    /**
+     * @brief Append the content of a block to a sequence.
+     *
+     * @param index The index of the sequence.
+     * @param line  The line holding the content.
+     * @param begin The position of the content in the line.
+     * @throw IndexOutOfBoundsException If the index is invalid.
+     * @throw BadCharException If the content has characters which are not in the alphabet.
+     */
+    void append(size_t index, const std::string& line, size_t begin = 0);
+
+    size_t getNumberOfSequences() const { return names_.size(); }
+
+    const std::string& getName(size_t index) const { return names_[index]; }
+
+    /**
+     * @brief Add all sequences to a container and clear the builder.
+     *
+     * @param sc         The container to fill.
+     * @param checkNames Tell if the names should be checked for unicity.
+     * @throw Exception If a sequence ends with an incomplete state, or if the sequences cannot be added.
+     */
+    void fill(SiteContainer& sc, bool checkNames);
+
+  private:
+    void encode_(size_t index, const std::string& line, size_t begin);
+};
+
+} //end of namespace bpp.
+
+#endif //_INTERLEAVEDALIGNMENTBUILDER_H_
+
@@ -44,6 +44,7 @@ knowledge of the CeCILL license and that you accept its terms.
 #include "Dcse.h"
 #include "Phylip.h"
 #include "GenBank.h"
+#include "Embl.h"
 #include "NexusIoSequence.h"
 
 using namespace bpp;
@@ -58,6 +59,7 @@ const string IoSequenceFactory::PHYLIP_FORMAT_SEQUENTIAL  = "Phylip S";
 const string IoSequenceFactory::PAML_FORMAT_INTERLEAVED   = "PAML I";  
 const string IoSequenceFactory::PAML_FORMAT_SEQUENTIAL    = "PAML S";  
 const string IoSequenceFactory::GENBANK_FORMAT            = "GenBank";  
+const string IoSequenceFactory::EMBL_FORMAT               = "EMBL";  
 const string IoSequenceFactory::NEXUS_FORMAT              = "Nexus";  
 
 ISequence* IoSequenceFactory::createReader(const string& format)
@@ -71,6 +73,7 @@ ISequence* IoSequenceFactory::createReader(const string& format)
   else if(format == PAML_FORMAT_INTERLEAVED) return new Phylip(true, false);
   else if(format == PAML_FORMAT_SEQUENTIAL) return new Phylip(true, true);
   else if(format == GENBANK_FORMAT) return new GenBank();
+  else if(format == EMBL_FORMAT) return new Embl();
   else if(format == NEXUS_FORMAT) return new NexusIOSequence();
   else throw Exception("Format " + format + " is not supported for sequences input.");
 }
@@ -62,6 +62,7 @@ class IoSequenceFactory
     static const std::string PAML_FORMAT_INTERLEAVED;  
     static const std::string PAML_FORMAT_SEQUENTIAL;  
     static const std::string GENBANK_FORMAT;  
+    static const std::string EMBL_FORMAT;  
     static const std::string NEXUS_FORMAT;  
 
   public:
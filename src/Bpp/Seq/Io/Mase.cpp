@@ -39,7 +39,9 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include "Mase.h"
+#include "StateCharTable.h"
 #include "../StringSequenceTools.h"
+#include "../Instrumentation.h"
 
 using namespace bpp;
 using namespace std;
@@ -48,6 +50,7 @@ using namespace std;
 
 void Mase::appendSequencesFromStream(std::istream& input, SequenceContainer& vsc) const
 {
+  BPP_SEQ_TIME_SCOPE("Mase::appendSequencesFromStream");
   if (!input) { throw IOException ("Mase::read : fail to open file"); }
   
   // Initialization
@@ -122,16 +125,18 @@ void Mase::writeSequences(ostream& output, const SequenceContainer& sc) const
   if (!output) { throw IOException ("Mase::write : failed to open file"); }
 
   Comments comments = sc.getGeneralComments();
+  string buffer;
 
   // Writing all general comments in file
   if (comments.size() == 0) {
-    output << ";;" << endl;
+    buffer += ";;\n";
   }
   for (size_t i = 0 ; i < comments.size() ; i++) {
-    output << ";;" << comments[i] << endl;
+    buffer += ";;" + comments[i] + "\n";
   }
 
-  string seq, temp = "";  // Initialization
+  StateCharTable table(sc.getAlphabet());
+  string seq;
 
   // Main loop : for all sequences
   vector<string> names = sc.getSequencesNames();
@@ -143,37 +148,33 @@ void Mase::writeSequences(ostream& output, const SequenceContainer& sc) const
     // If no comments are associated with current sequence, an empy commentary line will be writed
     if (comments.size() == 0)
     {
-      output << ";" << endl;
+      buffer += ";\n";
     }
     else
     {
       for (size_t j = 0 ; j < comments.size() ; j++)
       {
-        output << ";" << comments[j] << endl;
+        buffer += ";" + comments[j] + "\n";
       }
     }
 
     // Sequence name writing
-    output << names[i] << endl;
+    buffer += names[i] + "\n";
 
     // Sequence cutting to specified characters number per line
-    seq = sc.toString(names[i]);
-    while (seq != "")
+    seq = table.toString(sc.getSequence(names[i]));
+    for (size_t j = 0; j < seq.size(); j += charsByLine_)
     {
-      if (seq.size() > charsByLine_)
-      {
-        temp = seq;
-        temp.erase(temp.begin() + static_cast<ptrdiff_t>(charsByLine_), temp.end());
-        output << temp  << endl;
-        seq.erase(seq.begin(), seq.begin() + static_cast<ptrdiff_t>(charsByLine_));
-      }
-      else
-      {
-        output << seq << endl;
-        seq = "";
-      }
+      buffer.append(seq, j, charsByLine_);
+      buffer += '\n';
+    }
+    if (buffer.size() >= StateCharTable::BUFFER_SIZE)
+    {
+      output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+      buffer.clear();
     }
   }
+  output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
 }
 
 /****************************************************************************************/
@@ -170,6 +170,29 @@ SequenceContainer* MaseTools::getSelectedSequences(
 
 /******************************************************************************/
 
+const SiteContainerView* MaseTools::getSelectedSitesView(
+  const SiteContainer& sequences,
+  const string& setName)
+{
+  SiteSelection ss = getSiteSet(sequences.getGeneralComments(), setName);
+  return new SiteContainerView(sequences, SiteContainerTools::getSitesFromPositions(sequences, ss));
+}
+
+/******************************************************************************/
+
+const SiteContainerView* MaseTools::getSelectedSequencesView(
+  const SiteContainer& sequences,
+  const string& setName)
+{
+  SequenceSelection ss = getSequenceSet(sequences.getGeneralComments(), setName);
+  vector<size_t> sites(sequences.getNumberOfSites());
+  for (size_t i = 0; i < sites.size(); ++i)
+    sites[i] = i;
+  return new SiteContainerView(sequences, sites, ss);
+}
+
+/******************************************************************************/
+
 map<string, size_t> MaseTools::getAvailableSiteSelections(const Comments& maseHeader)
 {
   map<string, size_t> selections;
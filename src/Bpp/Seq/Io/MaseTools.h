@@ -45,6 +45,7 @@
 #include "../Container/SequenceContainerTools.h"
 #include "../Container/SiteContainer.h"
 #include "../Container/SiteContainerTools.h"
+#include "../Container/SiteContainerView.h"
 #include <Bpp/Exceptions.h>
 
 namespace bpp
@@ -110,6 +111,34 @@ namespace bpp
      */
     static SequenceContainer* getSelectedSequences(const OrderedSequenceContainer& sequences, const std::string & setName);
 
+    /**
+     * @brief Create a read-only view of the sites of a site set given in the mase+ format.
+     *
+     * Contrary to getSelectedSites(), no data is copied. The view is only valid as long as
+     * the original container exists and is not modified. Its destruction is up to the user.
+     * The view is returned as const, so that states are read with the const accessors (see SiteContainerView).
+     *
+     * @param sequences The container to get the sites from.
+     * @param setName   The name of the set to retrieve.
+     * @throw IOException If the specified set is not found.
+     * @see SiteContainerView
+     */
+    static const SiteContainerView* getSelectedSitesView(const SiteContainer& sequences, const std::string& setName);
+
+    /**
+     * @brief Create a read-only view of the sequences of a sequence set given in the mase+ format.
+     *
+     * Contrary to getSelectedSequences(), no data is copied. The view is only valid as long as
+     * the original container exists and is not modified. Its destruction is up to the user.
+     * The view is returned as const, so that states are read with the const accessors (see SiteContainerView).
+     *
+     * @param sequences The container to get the sequences from.
+     * @param setName   The name of the set to retrieve.
+     * @throw IOException If the specified set is not found.
+     * @see SiteContainerView
+     */
+    static const SiteContainerView* getSelectedSequencesView(const SiteContainer& sequences, const std::string& setName);
+
     /**
      * @brief Get a list of all available site selections.
      *
@@ -38,8 +38,10 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include "NexusIoSequence.h"
+#include "InterleavedAlignmentBuilder.h"
 #include "NexusTools.h"
 #include "../Container/SiteContainerTools.h"
+#include "../Instrumentation.h"
 #include "../Alphabet/AlphabetTools.h"
 #include <Bpp/Text/TextTools.h>
 #include <Bpp/Text/KeyvalTools.h>
@@ -69,6 +71,7 @@ const std::vector<std::string> NexusIOSequence::splitNameAndSequence_(const std:
 
 void NexusIOSequence::appendAlignmentFromStream(std::istream& input, SiteContainer& vsc) const
 {
+  BPP_SEQ_TIME_SCOPE("NexusIOSequence::appendAlignmentFromStream");
   // Checking the existence of specified file
   if (!input) { throw IOException ("NexusIOSequence::read(). Fail to open file"); }
 
@@ -98,6 +101,9 @@ void NexusIOSequence::appendAlignmentFromStream(std::istream& input, SiteContain
   if (argsUp["NTAX"] == "")
     throw Exception("NexusIOSequence::appendFromStream(). DIMENSIONS command does not have a NTAX argument.");
   unsigned int ntax = TextTools::to<unsigned int>(argsUp["NTAX"]);
+  size_t nchar = 0;
+  if (TextTools::isDecimalInteger(argsUp["NCHAR"]))
+    nchar = TextTools::to<size_t>(argsUp["NCHAR"]);
 
   //Look for the FORMAT command:
   while (cmdName != "FORMAT")
@@ -129,7 +135,8 @@ void NexusIOSequence::appendAlignmentFromStream(std::istream& input, SiteContain
   }
   line = FileTools::getNextLine(input);
 
-  vector<string> names, seqs;
+  //Residues are encoded while reading, into sequences sized from the header:
+  InterleavedAlignmentBuilder builder(alignment->getAlphabet(), nchar);
   // Read first block:
   bool commandFinished = false;
   for (unsigned int i = 0; i < ntax && !input.eof(); i++)
@@ -145,8 +152,7 @@ void NexusIOSequence::appendAlignmentFromStream(std::istream& input, SiteContain
       }
     }
     vector<string> v = splitNameAndSequence_(line);
-    names.push_back(v[0]);
-    seqs.push_back(v[1]);
+    builder.addSequence(v[0], v[1]);
     line = FileTools::getNextLine(input);
   }
   
@@ -168,17 +174,14 @@ void NexusIOSequence::appendAlignmentFromStream(std::istream& input, SiteContain
       }
 
       vector<string> v = splitNameAndSequence_(line);
-      if (v[0] != names[i])
+      if (i >= builder.getNumberOfSequences() || v[0] != builder.getName(i))
         throw IOException("NexusIOSequence::appendFromStream. Bad file, the sequences are not in the same order in interleaved blocks, or one taxon is missing.");
-      seqs[i] += v[1];      
+      builder.append(i, v[1]);
       line = FileTools::getNextLine(input);
       commandFinished = TextTools::removeSurroundingWhiteSpaces(line) == ";"; //In case the end of command is on a separate line.
     }
   }
-  for (unsigned int i = 0; i < names.size(); i++)
-  {
-    alignment->addSequence(BasicSequence(names[i], seqs[i], vsc.getAlphabet()), checkNames_);
-  }
+  builder.fill(*alignment, checkNames_);
 
   if (matchChar)
   {
@@ -38,7 +38,10 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include "Phylip.h"
+#include "InterleavedAlignmentBuilder.h"
+#include "PhylipStreamWriter.h"
 #include "../Container/SequenceContainerTools.h"
+#include "../Instrumentation.h"
 #include <Bpp/Text/TextTools.h>
 #include <Bpp/Text/StringTokenizer.h>
 #include <Bpp/Io/FileTools.h>
@@ -137,16 +140,22 @@ void Phylip::readInterleaved(std::istream& in, SiteContainer& asc) const
   getline(in, temp, '\n'); // Copy current line in temporary string
   StringTokenizer st(temp);
   unsigned int nbSequences = TextTools::to<unsigned int>(st.nextToken());
-  //int nbSites     = TextTools::toInt(st.nextToken());
+  size_t nbSites = 0;
+  if (st.hasMoreToken())
+  {
+    string token = st.nextToken();
+    if (TextTools::isDecimalInteger(token))
+      nbSites = TextTools::to<size_t>(token);
+  }
   temp = FileTools::getNextLine(in);
   
-  vector<string> names, seqs;
+  //Residues are encoded while reading, into sequences sized from the header:
+  InterleavedAlignmentBuilder builder(asc.getAlphabet(), nbSites);
   // Read first block:
   for (unsigned int i = 0; i < nbSequences && !in.eof() && !TextTools::isEmpty(temp); i++)
   {
     vector<string> v = splitNameAndSequence(temp);
-    names.push_back(v[0]);
-    seqs.push_back(v[1]);
+    builder.addSequence(v[0], v[1]);
     getline(in, temp, '\n');  // read next line in file.
   }
   
@@ -154,25 +163,23 @@ void Phylip::readInterleaved(std::istream& in, SiteContainer& asc) const
   temp = FileTools::getNextLine(in);
   while (!in.eof())
   {
-    for (unsigned int i = 0; i < names.size(); i++)
+    for (size_t i = 0; i < builder.getNumberOfSequences(); i++)
     {
       if (TextTools::isEmpty(temp))
         throw IOException("Phylip::readInterleaved. Bad file,there are not the same number of sequence in each block.");
-      seqs[i] += TextTools::removeWhiteSpaces(temp);      
+      builder.append(i, temp);
       getline(in, temp, '\n');  // read next line in file.
     }
     temp = FileTools::getNextLine(in);
   }
-  for (unsigned int i = 0; i < names.size(); i++)
-  {
-    asc.addSequence(BasicSequence(names[i], seqs[i], asc.getAlphabet()), checkNames_);
-  }
+  builder.fill(asc, checkNames_);
 }
   
 /******************************************************************************/
 
 void Phylip::appendAlignmentFromStream(std::istream& input, SiteContainer& vsc) const
 {
+  BPP_SEQ_TIME_SCOPE("Phylip::appendAlignmentFromStream");
   // Checking the existence of specified file
   if (!input) { throw IOException ("Phylip::read: fail to open file"); }
   
@@ -226,52 +233,28 @@ std::vector<std::string> Phylip::getSizedNames(const std::vector<std::string>& n
 void Phylip::writeSequential(std::ostream& out, const SequenceContainer& sc) const
 {
   //cout << "Write sequential" << endl;
-  size_t numberOfSites = sc.getSequence(sc.getSequencesNames()[0]).size() * sc.getAlphabet()->getStateCodingSize();
-  out << sc.getNumberOfSequences() << " " << numberOfSites << endl;
-  
   vector<string> seqNames = sc.getSequencesNames();
-  vector<string> names = getSizedNames(seqNames);
+  PhylipStreamWriter writer(out, *this, sc.getAlphabet(), seqNames, sc.getSequence(seqNames[0]).size());
   for (size_t i = 0; i < seqNames.size(); ++i)
   {
-    vector<string> seq = TextTools::split(sc.toString(seqNames[i]), charsByLine_);
-    out << names[i] << seq[0] << endl;
-    for (size_t j = 1; j < seq.size(); ++j)
-    {
-      out << string(names[i].size(), ' ') << seq[j] << endl;
-    }
-    out << endl;
+    writer.addSequence(sc.getSequence(seqNames[i]));
   }
+  writer.close();
 }
 
 void Phylip::writeInterleaved(std::ostream& out, const SequenceContainer& sc) const
 {
   //cout << "Write interleaved;" << endl;
-  size_t numberOfSites = sc.getSequence(sc.getSequencesNames()[0]).size() * sc.getAlphabet()->getStateCodingSize();
-  out << sc.getNumberOfSequences() << " " << numberOfSites << endl;
-  
   vector<string> seqNames = sc.getSequencesNames();
-  vector<string> names = getSizedNames(seqNames);
-  //Split sequences:
-  vector< vector<string> > seqs(sc.getNumberOfSequences());
+  vector<const SymbolList*> seqs(seqNames.size());
   for (size_t i = 0; i < seqNames.size(); ++i)
   {
-    seqs[i] = TextTools::split(sc.toString(seqNames[i]), charsByLine_);
-  }
-  //Write first block:
-  for (size_t i = 0; i < names.size(); ++i)
-  {
-    out << names[i] << seqs[i][0] << endl;
-  }
-  out << endl;
-  //Write other blocks:
-  for (size_t j = 1; j < seqs[0].size(); ++j)
-  {
-    for (size_t i = 0; i < sc.getNumberOfSequences(); ++i)
-    {
-      out << seqs[i][j] << endl;
-    }
-    out << endl;
+    seqs[i] = &sc.getSequence(seqNames[i]);
   }
+  size_t numberOfSites = seqs[0]->size();
+  PhylipStreamWriter writer(out, *this, sc.getAlphabet(), seqNames, numberOfSites);
+  writer.addColumns(seqs, 0, numberOfSites);
+  writer.close();
 }
 
 /******************************************************************************/
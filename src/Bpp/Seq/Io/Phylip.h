@@ -178,6 +178,15 @@ class Phylip :
      * @param split The string to be used to split sequence name from content.
      */
     void setSplit(const std::string& split) { namesSplit_ = split; }
+
+    bool isExtended() const { return extended_; }
+    bool isSequential() const { return sequential_; }
+    unsigned int getCharsByLine() const { return charsByLine_; }
+
+    /**
+     * @return The names padded (extended format) or truncated to 10 characters, as written in files.
+     */
+    std::vector<std::string> getSizedNames(const std::vector<std::string>& names) const;
      
   protected:
     //Reading tools:
@@ -185,7 +194,6 @@ class Phylip :
     void readSequential (std::istream& in, SiteContainer& asc) const;
     void readInterleaved(std::istream& in, SiteContainer& asc) const;
     //Writing tools:
-    std::vector<std::string> getSizedNames(const std::vector<std::string>& names) const;
     void writeSequential(std::ostream& out, const SequenceContainer& sc) const;
     void writeInterleaved(std::ostream& out, const SequenceContainer& sc) const;
 };
@@ -0,0 +1,204 @@
+//
+// File: PhylipStreamWriter.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "PhylipStreamWriter.h"
+
+#include <Bpp/Exceptions.h>
+#include <Bpp/Numeric/VectorExceptions.h>
+#include <Bpp/Text/TextTools.h>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+PhylipStreamWriter::PhylipStreamWriter(ostream& out, const Phylip& format, const Alphabet* alphabet, const vector<string>& names, size_t numberOfSites, size_t bufferSize):
+  out_(&out),
+  table_(alphabet),
+  sequential_(format.isSequential()),
+  charsByLine_(format.getCharsByLine()),
+  names_(format.getSizedNames(names)),
+  numberOfSites_(numberOfSites),
+  currentSequence_(0),
+  currentSite_(0),
+  row_(),
+  rows_(),
+  firstBlock_(true),
+  buffer_(),
+  bufferSize_(bufferSize),
+  closed_(false)
+{
+  if (!out)
+    throw IOException("PhylipStreamWriter: can't write to ostream output");
+  if (charsByLine_ == 0)
+    throw Exception("PhylipStreamWriter: the number of characters by line must be strictly positive.");
+  if (!sequential_)
+    rows_.resize(names_.size());
+  buffer_.reserve(bufferSize_ + charsByLine_ + 256);
+  buffer_ += TextTools::toString(names_.size()) + " " + TextTools::toString(numberOfSites_ * alphabet->getStateCodingSize()) + "\n";
+}
+
+PhylipStreamWriter::~PhylipStreamWriter()
+{
+  if (out_ && buffer_.size() > 0)
+    out_->write(buffer_.data(), static_cast<streamsize>(buffer_.size()));
+}
+
+/******************************************************************************/
+
+void PhylipStreamWriter::flush_()
+{
+  out_->write(buffer_.data(), static_cast<streamsize>(buffer_.size()));
+  buffer_.clear();
+  if (!*out_)
+    throw IOException("PhylipStreamWriter: can't write to ostream output");
+}
+
+/******************************************************************************/
+
+void PhylipStreamWriter::addSequence(const SymbolList& sequence)
+{
+  if (!sequential_)
+    throw Exception("PhylipStreamWriter::addSequence. Sequences can only be added in sequential format.");
+  if (closed_ || currentSequence_ == names_.size())
+    throw Exception("PhylipStreamWriter::addSequence. All sequences were already written.");
+  if (sequence.size() != numberOfSites_)
+    throw DimensionException("PhylipStreamWriter::addSequence. Sequence does not have the expected length.", sequence.size(), numberOfSites_);
+
+  // Format the sequence, then split it according to the number of characters by line:
+  row_.clear();
+  table_.append(sequence, 0, sequence.size(), row_);
+  const string& name = names_[currentSequence_];
+  for (size_t pos = 0; pos < row_.size() || pos == 0; pos += charsByLine_)
+  {
+    if (pos == 0)
+      buffer_ += name;
+    else
+      buffer_.append(name.size(), ' ');
+    buffer_.append(row_, pos, charsByLine_);
+    buffer_ += '\n';
+    if (buffer_.size() >= bufferSize_)
+      flush_();
+  }
+  buffer_ += '\n';
+  currentSequence_++;
+}
+
+/******************************************************************************/
+
+void PhylipStreamWriter::checkInterleaved_(size_t numberOfSequences, size_t numberOfSites)
+{
+  if (sequential_)
+    throw Exception("PhylipStreamWriter. Sites can only be added in interleaved format.");
+  if (closed_ || currentSite_ + numberOfSites > numberOfSites_)
+    throw Exception("PhylipStreamWriter. Too many sites written.");
+  if (numberOfSequences != names_.size())
+    throw DimensionException("PhylipStreamWriter. Wrong number of sequences.", numberOfSequences, names_.size());
+}
+
+void PhylipStreamWriter::addSite(const SymbolList& site)
+{
+  checkInterleaved_(site.size(), 1);
+  for (size_t i = 0; i < rows_.size(); ++i)
+    rows_[i] += table_.getChar(site[i]);
+  currentSite_++;
+  if (rows_.size() > 0 && rows_[0].size() >= charsByLine_)
+    writeBlock_(charsByLine_);
+}
+
+void PhylipStreamWriter::addColumns(const vector<const SymbolList*>& sequences, size_t begin, size_t end)
+{
+  checkInterleaved_(sequences.size(), end > begin ? end - begin : 0);
+  for (size_t i = 0; i < sequences.size(); ++i)
+  {
+    if (sequences[i]->size() < end)
+      throw DimensionException("PhylipStreamWriter::addColumns. Sequence is too short.", sequences[i]->size(), end);
+  }
+  // Format chunks of at most one line per sequence, so that the pending rows stay small:
+  while (begin < end)
+  {
+    size_t chunk = min(end - begin, charsByLine_);
+    for (size_t i = 0; i < sequences.size(); ++i)
+      table_.append(*sequences[i], begin, begin + chunk, rows_[i]);
+    begin += chunk;
+    currentSite_ += chunk;
+    while (rows_.size() > 0 && rows_[0].size() >= charsByLine_)
+      writeBlock_(charsByLine_);
+  }
+}
+
+/******************************************************************************/
+
+void PhylipStreamWriter::writeBlock_(size_t length)
+{
+  for (size_t i = 0; i < rows_.size(); ++i)
+  {
+    if (firstBlock_)
+      buffer_ += names_[i];
+    buffer_.append(rows_[i], 0, length);
+    buffer_ += '\n';
+    rows_[i].erase(0, length);
+    if (buffer_.size() >= bufferSize_)
+      flush_();
+  }
+  buffer_ += '\n';
+  firstBlock_ = false;
+}
+
+/******************************************************************************/
+
+void PhylipStreamWriter::close()
+{
+  if (closed_) return;
+  if (sequential_ && currentSequence_ != names_.size())
+    throw Exception("PhylipStreamWriter::close. Only " + TextTools::toString(currentSequence_) + " sequences written out of " + TextTools::toString(names_.size()) + ".");
+  if (!sequential_)
+  {
+    if (currentSite_ != numberOfSites_)
+      throw Exception("PhylipStreamWriter::close. Only " + TextTools::toString(currentSite_) + " sites written out of " + TextTools::toString(numberOfSites_) + ".");
+    if (firstBlock_ || (rows_.size() > 0 && rows_[0].size() > 0))
+      writeBlock_(rows_.size() > 0 ? rows_[0].size() : 0);
+  }
+  flush_();
+  closed_ = true;
+}
+
+/******************************************************************************/
+
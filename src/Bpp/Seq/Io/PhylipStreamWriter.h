@@ -0,0 +1,149 @@
+//
+// File: PhylipStreamWriter.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _PHYLIPSTREAMWRITER_H_
+#define _PHYLIPSTREAMWRITER_H_
+
+#include "Phylip.h"
+#include "StateCharTable.h"
+
+// From the STL:
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Write a Phylip alignment incrementally.
+ *
+ * The sequence names and the alignment dimensions are given first, then the content is pushed
+ * either sequence by sequence (sequential format) or site by site / by blocks of columns
+ * (interleaved format), so that the whole alignment never has to be stored in memory.
+ * The output is formatted with a StateCharTable into a large buffer, which is written to the
+ * stream when full.
+ *
+ * The output is identical to the one of Phylip::writeAlignment with the same format options.
+ */
+class PhylipStreamWriter
+{
+  private:
+    std::ostream* out_;
+    StateCharTable table_;
+    bool sequential_;
+    size_t charsByLine_;
+    std::vector<std::string> names_;
+    size_t numberOfSites_;
+    size_t currentSequence_;
+    size_t currentSite_;
+    std::string row_;
+    std::vector<std::string> rows_;
+    bool firstBlock_;
+    std::string buffer_;
+    size_t bufferSize_;
+    bool closed_;
+
+  public:
+    /**
+     * @param out           The output stream.
+     * @param format        The Phylip format options (extended, sequential, characters by line, names split).
+     * @param alphabet      The alphabet of the sequences.
+     * @param names         The names of the sequences, in the order in which they will be written.
+     * @param numberOfSites The number of sites in the alignment.
+     * @param bufferSize    The size of the output buffer.
+     * @throw IOException If the stream can't be written.
+     */
+    PhylipStreamWriter(std::ostream& out, const Phylip& format, const Alphabet* alphabet, const std::vector<std::string>& names, size_t numberOfSites, size_t bufferSize = StateCharTable::BUFFER_SIZE);
+
+    PhylipStreamWriter(const PhylipStreamWriter& writer) = delete;
+    PhylipStreamWriter& operator=(const PhylipStreamWriter& writer) = delete;
+
+    /**
+     * @brief Flush pending output. Use close() to check that the alignment is complete.
+     */
+    virtual ~PhylipStreamWriter();
+
+  public:
+    /**
+     * @brief Write the next sequence (sequential format only).
+     *
+     * @throw Exception If the writer is interleaved, closed, or all sequences were already written.
+     * @throw DimensionException If the sequence does not have the expected length.
+     */
+    void addSequence(const SymbolList& sequence);
+
+    /**
+     * @brief Write the next site (interleaved format only).
+     *
+     * @param site The states of all sequences at this site, in the order of the names.
+     * @throw Exception If the writer is sequential, closed, or all sites were already written.
+     * @throw DimensionException If the site does not have the expected number of sequences.
+     */
+    void addSite(const SymbolList& site);
+
+    /**
+     * @brief Write the next block of columns (interleaved format only).
+     *
+     * @param sequences Pointers toward all sequences, in the order of the names.
+     * @param begin     The first position to write.
+     * @param end       The position following the last one to write.
+     * @throw Exception If the writer is sequential, closed, or too many sites are written.
+     * @throw DimensionException If the number of sequences is wrong.
+     */
+    void addColumns(const std::vector<const SymbolList*>& sequences, size_t begin, size_t end);
+
+    /**
+     * @brief Write all pending output.
+     *
+     * @throw Exception If the alignment is not complete.
+     * @throw IOException If the stream can't be written.
+     */
+    void close();
+
+  private:
+    void checkInterleaved_(size_t numberOfSequences, size_t numberOfSites);
+    void writeBlock_(size_t length);
+    void flush_();
+};
+
+} //end of namespace bpp.
+
+#endif //_PHYLIPSTREAMWRITER_H_
+
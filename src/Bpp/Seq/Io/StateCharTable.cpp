@@ -0,0 +1,109 @@
+//
+// File: StateCharTable.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "StateCharTable.h"
+#include "../Alphabet/AlphabetExceptions.h"
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+const size_t StateCharTable::BUFFER_SIZE = 1048576;
+
+/******************************************************************************/
+
+StateCharTable::StateCharTable(const Alphabet* alphabet):
+  minState_(0), chars_(), supported_(), singleChar_(true)
+{
+  const vector<int>& states = alphabet->getSupportedInts();
+  if (states.size() == 0) return;
+  int maxState = states[0];
+  minState_ = states[0];
+  for (size_t i = 1; i < states.size(); ++i)
+  {
+    if (states[i] < minState_) minState_ = states[i];
+    if (states[i] > maxState) maxState = states[i];
+  }
+  size_t n = static_cast<size_t>(maxState - minState_) + 1;
+  chars_.resize(n);
+  supported_.resize(n, false);
+  for (size_t i = 0; i < states.size(); ++i)
+  {
+    size_t j = static_cast<size_t>(states[i] - minState_);
+    // Several characters may code for the same state, the first one is used, as in intToChar.
+    if (!supported_[j])
+    {
+      chars_[j] = alphabet->intToChar(states[i]);
+      supported_[j] = true;
+      if (chars_[j].size() != 1) singleChar_ = false;
+    }
+  }
+}
+
+/******************************************************************************/
+
+size_t StateCharTable::index_(int state) const
+{
+  if (state < minState_ || static_cast<size_t>(state - minState_) >= chars_.size() || !supported_[static_cast<size_t>(state - minState_)])
+    throw BadIntException(state, "StateCharTable::getChar. Unsupported state.");
+  return static_cast<size_t>(state - minState_);
+}
+
+/******************************************************************************/
+
+void StateCharTable::append(const SymbolList& list, size_t begin, size_t end, string& buffer) const
+{
+  if (singleChar_)
+  {
+    size_t offset = buffer.size();
+    buffer.resize(offset + end - begin);
+    for (size_t i = begin; i < end; ++i)
+      buffer[offset + i - begin] = chars_[index_(list[i])][0];
+  }
+  else
+  {
+    for (size_t i = begin; i < end; ++i)
+      buffer += chars_[index_(list[i])];
+  }
+}
+
+/******************************************************************************/
+
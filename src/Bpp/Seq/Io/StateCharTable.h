@@ -0,0 +1,121 @@
+//
+// File: StateCharTable.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _STATECHARTABLE_H_
+#define _STATECHARTABLE_H_
+
+#include "../Alphabet/Alphabet.h"
+#include "../SymbolList.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Lookup table from int states to their character representation.
+ *
+ * The table is built once per alphabet, so that writers can format
+ * sequences without calling Alphabet::intToChar for each position.
+ */
+class StateCharTable
+{
+  private:
+    int minState_;
+    std::vector<std::string> chars_;
+    std::vector<bool> supported_;
+    bool singleChar_;
+
+  public:
+    /**
+     * @brief Size (in bytes) of the text buffers filled by writers before being flushed to their stream.
+     */
+    static const size_t BUFFER_SIZE;
+
+  public:
+    /**
+     * @param alphabet The alphabet of the states to format.
+     */
+    StateCharTable(const Alphabet* alphabet);
+
+    virtual ~StateCharTable() {}
+
+  public:
+    /**
+     * @return The character representation of a state.
+     * @throw BadIntException If the state is not supported by the alphabet.
+     */
+    const std::string& getChar(int state) const
+    {
+      size_t i = index_(state);
+      return chars_[i];
+    }
+
+    /**
+     * @brief Append the character representation of a range of states to a string.
+     *
+     * @param list   The states to format.
+     * @param begin  The first position to format.
+     * @param end    The position following the last one to format.
+     * @param buffer The output string.
+     * @throw BadIntException If a state is not supported by the alphabet.
+     */
+    void append(const SymbolList& list, size_t begin, size_t end, std::string& buffer) const;
+
+    /**
+     * @return The character representation of a whole list.
+     * @throw BadIntException If a state is not supported by the alphabet.
+     */
+    std::string toString(const SymbolList& list) const
+    {
+      std::string s;
+      append(list, 0, list.size(), s);
+      return s;
+    }
+
+  private:
+    size_t index_(int state) const;
+};
+
+} //end of namespace bpp.
+
+#endif //_STATECHARTABLE_H_
+
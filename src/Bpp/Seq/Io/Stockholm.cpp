@@ -40,23 +40,190 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include "Stockholm.h"
+#include "../Instrumentation.h"
 
-#include "../StringSequenceTools.h"
 #include <Bpp/Text/TextTools.h>
-#include <Bpp/Text/StringTokenizer.h>
-#include <Bpp/Io/FileTools.h>
+
+// From the STL:
+#include <algorithm>
 
 using namespace bpp;
 using namespace std;
 
 /******************************************************************************/
 
+const string& StockholmAnnotation::getColumnAnnotation(const string& tag) const
+{
+  map<string, string>::const_iterator it = columnAnnotations_.find(tag);
+  if (it == columnAnnotations_.end())
+    throw Exception("StockholmAnnotation::getColumnAnnotation. No column annotation with tag: " + tag);
+  return it->second;
+}
+
+bool StockholmAnnotation::hasResidueAnnotation(const string& sequenceName, const string& tag) const
+{
+  map<string, map<string, string> >::const_iterator it = residueAnnotations_.find(sequenceName);
+  return it != residueAnnotations_.end() && it->second.find(tag) != it->second.end();
+}
+
+const string& StockholmAnnotation::getResidueAnnotation(const string& sequenceName, const string& tag) const
+{
+  map<string, map<string, string> >::const_iterator it = residueAnnotations_.find(sequenceName);
+  if (it != residueAnnotations_.end())
+  {
+    map<string, string>::const_iterator it2 = it->second.find(tag);
+    if (it2 != it->second.end())
+      return it2->second;
+  }
+  throw Exception("StockholmAnnotation::getResidueAnnotation. No residue annotation with tag " + tag + " for sequence " + sequenceName + ".");
+}
+
+/******************************************************************************/
+
+namespace
+{
+  // Get the next field of a line, starting at pos, and move pos after it.
+  string nextField_(const string& line, size_t& pos)
+  {
+    size_t begin = line.find_first_not_of(" \t", pos);
+    if (begin == string::npos)
+    {
+      pos = line.size();
+      return "";
+    }
+    size_t end = line.find_first_of(" \t", begin);
+    if (end == string::npos)
+      end = line.size();
+    pos = end;
+    return line.substr(begin, end - begin);
+  }
+
+  // Get the rest of a line, starting at pos, without surrounding blanks.
+  string lineEnd_(const string& line, size_t pos)
+  {
+    size_t begin = line.find_first_not_of(" \t", pos);
+    if (begin == string::npos)
+      return "";
+    size_t end = line.find_last_not_of(" \t\r");
+    return line.substr(begin, end + 1 - begin);
+  }
+}
+
+bool Stockholm::nextAlignment(istream& input, SiteContainer& sc, StockholmAnnotation* annotation) const
+{
+  BPP_SEQ_TIME_SCOPE("Stockholm::nextAlignment");
+  if (!input)
+    throw IOException("Stockholm::nextAlignment: can't read from istream input");
+
+  // Sequences are indexed by name, as they can be split into several blocks:
+  vector<string> names, contents;
+  map<string, size_t> index;
+  Comments comments = sc.getGeneralComments();
+  bool started = false;
+  string line;
+  while (getline(input, line))
+  {
+    if (TextTools::isEmpty(line))
+      continue;
+    if (!started)
+    {
+      if (line.compare(0, 11, "# STOCKHOLM") != 0)
+        throw IOException("Stockholm::nextAlignment. Missing '# STOCKHOLM' header.");
+      started = true;
+      continue;
+    }
+    if (line.size() >= 2 && line[0] == '/' && line[1] == '/')
+      break;
+    size_t pos = 0;
+    if (line[0] == '#')
+    {
+      string type = nextField_(line, pos);
+      if (type == "#=GF")
+      {
+        string tag = nextField_(line, pos);
+        if (tag == "CC")
+          comments.push_back(lineEnd_(line, pos));
+        else if (annotation)
+          annotation->addFileAnnotation(tag, lineEnd_(line, pos));
+      }
+      else if (annotation && type == "#=GS")
+      {
+        string name = nextField_(line, pos);
+        string tag = nextField_(line, pos);
+        annotation->addSequenceAnnotation(name, tag, lineEnd_(line, pos));
+      }
+      else if (annotation && type == "#=GC")
+      {
+        string tag = nextField_(line, pos);
+        annotation->appendColumnAnnotation(tag, nextField_(line, pos));
+      }
+      else if (annotation && type == "#=GR")
+      {
+        string name = nextField_(line, pos);
+        string tag = nextField_(line, pos);
+        annotation->appendResidueAnnotation(name, tag, nextField_(line, pos));
+      }
+      // Other comment lines are ignored.
+      continue;
+    }
+    string name = nextField_(line, pos);
+    string data = nextField_(line, pos);
+    map<string, size_t>::iterator it = index.find(name);
+    if (it == index.end())
+    {
+      index[name] = names.size();
+      names.push_back(name);
+      contents.push_back(data);
+    }
+    else
+      contents[it->second] += data;
+  }
+  if (!started)
+    return false;
+
+  // Pfam and Rfam write gaps in insert columns as '.':
+  const Alphabet* alpha = sc.getAlphabet();
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    replace(contents[i].begin(), contents[i].end(), '.', '-');
+    sc.addSequence(BasicSequence(names[i], contents[i], alpha), checkNames_);
+  }
+  sc.setGeneralComments(comments);
+  return true;
+}
+
+/******************************************************************************/
+
+void Stockholm::appendAlignmentFromStream(istream& input, SiteContainer& sc) const
+{
+  if (!nextAlignment(input, sc))
+    throw IOException("Stockholm::read. No alignment found.");
+}
+
+/******************************************************************************/
+
 void Stockholm::writeAlignment(ostream& output, const SiteContainer& sc) const
+{
+  writeAlignment_(output, sc, 0);
+}
+
+void Stockholm::writeAlignment(ostream& output, const SiteContainer& sc, const StockholmAnnotation& annotation) const
+{
+  writeAlignment_(output, sc, &annotation);
+}
+
+void Stockholm::writeAlignment_(ostream& output, const SiteContainer& sc, const StockholmAnnotation* annotation) const
 {
 	if (!output)
     throw IOException("Stockholm::writeAlignment: can't write to ostream output");
 
   output << "# STOCKHOLM 1.0" << endl; 
+  if (annotation)
+  {
+    const StockholmAnnotation::TaggedTexts& gf = annotation->getFileAnnotations();
+    for (size_t i = 0; i < gf.size(); ++i)
+      output << "#=GF " << gf[i].first << " " << gf[i].second << endl;
+  }
   // Loop for all general comments
   for (size_t i = 0; i < sc.getGeneralComments().size(); ++i)
   {
@@ -71,13 +238,93 @@ void Stockholm::writeAlignment(ostream& output, const SiteContainer& sc) const
     names[i] = TextTools::removeWhiteSpaces(names[i]);
     if (names[i].size() > maxSize) maxSize = names[i].size();
   }
+  if (annotation)
+  {
+    const map<string, StockholmAnnotation::TaggedTexts>& gs = annotation->getSequenceAnnotations();
+    for (map<string, StockholmAnnotation::TaggedTexts>::const_iterator it = gs.begin(); it != gs.end(); ++it)
+      for (size_t i = 0; i < it->second.size(); ++i)
+        output << "#=GS " << it->first << " " << it->second[i].first << " " << it->second[i].second << endl;
+    // Annotation lines are aligned with the sequences:
+    const map<string, map<string, string> >& gr = annotation->getResidueAnnotations();
+    for (map<string, map<string, string> >::const_iterator it = gr.begin(); it != gr.end(); ++it)
+      for (map<string, string>::const_iterator it2 = it->second.begin(); it2 != it->second.end(); ++it2)
+        maxSize = max(maxSize, it->first.size() + it2->first.size() + 6);
+    const map<string, string>& gc = annotation->getColumnAnnotations();
+    for (map<string, string>::const_iterator it = gc.begin(); it != gc.end(); ++it)
+      maxSize = max(maxSize, it->first.size() + 5);
+  }
   if (maxSize > 255) maxSize = 255;
   for (size_t i = 0; i < sc.getNumberOfSequences(); ++i)
   {
     output << TextTools::resizeRight(names[i], maxSize) << " " << sc.getSequence(i).toString() << endl;
+    if (annotation)
+    {
+      map<string, map<string, string> >::const_iterator it = annotation->getResidueAnnotations().find(names[i]);
+      if (it != annotation->getResidueAnnotations().end())
+        for (map<string, string>::const_iterator it2 = it->second.begin(); it2 != it->second.end(); ++it2)
+          output << TextTools::resizeRight("#=GR " + names[i] + " " + it2->first, maxSize) << " " << it2->second << endl;
+    }
 	}
+  if (annotation)
+  {
+    const map<string, string>& gc = annotation->getColumnAnnotations();
+    for (map<string, string>::const_iterator it = gc.begin(); it != gc.end(); ++it)
+      output << TextTools::resizeRight("#=GC " + it->first, maxSize) << " " << it->second << endl;
+  }
   output << "//" << endl;
 }
 
 /******************************************************************************/
 
+StockholmAlignmentIterator::StockholmAlignmentIterator(const Stockholm& reader, istream& stream, const Alphabet* alphabet):
+  reader_(&reader),
+  stream_(&stream),
+  alphabet_(alphabet),
+  nextAlignment_(0),
+  nextAnnotation_()
+{
+  readAhead_();
+}
+
+void StockholmAlignmentIterator::readAhead_()
+{
+  nextAnnotation_.clear();
+  nextAlignment_ = new AlignedSequenceContainer(alphabet_);
+  bool test = false;
+  try
+  {
+    test = reader_->nextAlignment(*stream_, *nextAlignment_, &nextAnnotation_);
+  }
+  catch (...)
+  {
+    delete nextAlignment_;
+    nextAlignment_ = 0;
+    throw;
+  }
+  if (!test) {
+    delete nextAlignment_;
+    nextAlignment_ = 0; //No more alignment available
+  }
+}
+
+AlignedSequenceContainer* StockholmAlignmentIterator::nextAlignment(StockholmAnnotation* annotation)
+{
+  AlignedSequenceContainer* aln = nextAlignment_;
+  if (nextAlignment_) {
+    if (annotation)
+      *annotation = nextAnnotation_;
+    try
+    {
+      readAhead_();
+    }
+    catch (...)
+    {
+      delete aln;
+      throw;
+    }
+  }
+  return aln;
+}
+
+/******************************************************************************/
+
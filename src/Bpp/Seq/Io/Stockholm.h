@@ -40,22 +40,107 @@ knowledge of the CeCILL license and that you accept its terms.
 #ifndef _STOCKHOLM_H_
 #define _STOCKHOLM_H_
 
+#include "AbstractIAlignment.h"
 #include "AbstractOAlignment.h"
+#include "ISequence.h"
 #include "../Sequence.h"
 #include "../Container/SequenceContainer.h"
 #include "../Container/AlignedSequenceContainer.h"
 
+// From the STL:
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+
 namespace bpp
 {
 
+/**
+ * @brief Annotations of an alignment in the Stockholm format.
+ *
+ * - File annotations (#=GF lines) are stored as (tag, text) pairs, in the order of the file.
+ *   Comments (#=GF CC) are not stored here but in the general comments of the alignment.
+ * - Sequence annotations (#=GS lines) are stored as (tag, text) pairs for each sequence.
+ * - Column annotations (#=GC lines) have one character per alignment column.
+ * - Residue annotations (#=GR lines) have one character per alignment column, for a given sequence.
+ *
+ * Column and residue annotations split over several blocks are concatenated.
+ */
+class StockholmAnnotation
+{
+  public:
+    typedef std::vector< std::pair<std::string, std::string> > TaggedTexts;
+
+  private:
+    TaggedTexts fileAnnotations_;
+    std::map<std::string, TaggedTexts> sequenceAnnotations_;
+    std::map<std::string, std::string> columnAnnotations_;
+    std::map<std::string, std::map<std::string, std::string> > residueAnnotations_;
+
+  public:
+    StockholmAnnotation():
+      fileAnnotations_(), sequenceAnnotations_(), columnAnnotations_(), residueAnnotations_() {}
+
+    virtual ~StockholmAnnotation() {}
+
+  public:
+    void clear()
+    {
+      fileAnnotations_.clear();
+      sequenceAnnotations_.clear();
+      columnAnnotations_.clear();
+      residueAnnotations_.clear();
+    }
+
+    const TaggedTexts& getFileAnnotations() const { return fileAnnotations_; }
+    void addFileAnnotation(const std::string& tag, const std::string& text)
+    {
+      fileAnnotations_.push_back(std::make_pair(tag, text));
+    }
+
+    const std::map<std::string, TaggedTexts>& getSequenceAnnotations() const { return sequenceAnnotations_; }
+    void addSequenceAnnotation(const std::string& sequenceName, const std::string& tag, const std::string& text)
+    {
+      sequenceAnnotations_[sequenceName].push_back(std::make_pair(tag, text));
+    }
+
+    const std::map<std::string, std::string>& getColumnAnnotations() const { return columnAnnotations_; }
+    bool hasColumnAnnotation(const std::string& tag) const { return columnAnnotations_.find(tag) != columnAnnotations_.end(); }
+    /**
+     * @throw Exception If there is no column annotation with this tag.
+     */
+    const std::string& getColumnAnnotation(const std::string& tag) const;
+    void appendColumnAnnotation(const std::string& tag, const std::string& data) { columnAnnotations_[tag] += data; }
+
+    const std::map<std::string, std::map<std::string, std::string> >& getResidueAnnotations() const { return residueAnnotations_; }
+    bool hasResidueAnnotation(const std::string& sequenceName, const std::string& tag) const;
+    /**
+     * @throw Exception If there is no residue annotation with this tag for the sequence.
+     */
+    const std::string& getResidueAnnotation(const std::string& sequenceName, const std::string& tag) const;
+    void appendResidueAnnotation(const std::string& sequenceName, const std::string& tag, const std::string& data)
+    {
+      residueAnnotations_[sequenceName][tag] += data;
+    }
+};
+
 /**
  * @brief The Stockholm alignment file format.
  *
- * Write to Stockholm files.
- * Only sequence data is read/written, annotation and secondary structures are ignored.
+ * Read and write Stockholm files, as used by Pfam and Rfam.
+ * Interleaved blocks are supported when reading, and annotation lines are stored in a StockholmAnnotation
+ * object if one is provided. A file may contain several alignments, each terminated by a '//' line:
+ * they can be read one at a time with nextAlignment, or with a StockholmAlignmentIterator.
+ * readAlignment only reads the first alignment of a file.
+ * Both '-' and '.' (used by Pfam and Rfam in insert columns) are read as gaps.
+ *
+ * An AlignedSequenceContainer object is used instead of a VectorSequenceContainer.
  */
 class Stockholm:
-  public AbstractOAlignment
+  public AbstractIAlignment,
+  public AbstractOAlignment,
+  public virtual ISequence
 {
   private:
 
@@ -75,6 +160,30 @@ class Stockholm:
 
   public:
 
+    /**
+     * @name The AbstractIAlignment interface.
+     *
+     * @{
+     */
+    void appendAlignmentFromStream(std::istream& input, SiteContainer& sc) const;
+    /** @} */
+
+    /**
+     * @name The ISequence interface.
+     *
+     * As a SiteContainer is a subclass of SequenceContainer, we hereby implement the ISequence
+     * interface by downcasting the interface.
+     *
+     * @{
+     */
+    virtual SequenceContainer* readSequences(std::istream& input, const Alphabet* alpha) const {
+      return readAlignment(input, alpha);
+    }
+    virtual SequenceContainer* readSequences(const std::string& path, const Alphabet* alpha) const {
+      return readAlignment(path, alpha);
+    }
+    /** @} */
+
     /**
      * @name The OAlignment interface.
      *
@@ -86,6 +195,26 @@ class Stockholm:
       AbstractOAlignment::writeAlignment(path, sc, overwrite);
     }
     /** @} */
+
+    /**
+     * @brief Write an alignment together with its annotations.
+     *
+     * @param output     The stream where to write.
+     * @param sc         The alignment to write.
+     * @param annotation The annotations to write.
+     */
+    void writeAlignment(std::ostream& output, const SiteContainer& sc, const StockholmAnnotation& annotation) const;
+
+    /**
+     * @brief Read the next alignment of a stream.
+     *
+     * @param input      The stream to read.
+     * @param sc         The container where sequences are added.
+     * @param annotation If not null, the annotations of the alignment are added to this object.
+     * @return true if an alignment was read, false at the end of the stream.
+     * @throw IOException If the alignment is malformed.
+     */
+    bool nextAlignment(std::istream& input, SiteContainer& sc, StockholmAnnotation* annotation = 0) const;
   
     /**
      * @name The IOSequence interface.
@@ -100,7 +229,6 @@ class Stockholm:
     /** @} */
 
     /**
-     * @warning This is not used for now, will be when reading is implemented.
      * @return true if the names are to be checked when reading sequences from files.
      */
     bool checkNames() const { return checkNames_; }
@@ -108,13 +236,71 @@ class Stockholm:
     /**
      * @brief Tell whether the sequence names should be checked when reading from files.
      *
-     * @warning This is not used for now, will be when reading is implemented.
      * @param yn whether the sequence names should be checked when reading from files.
      */
     void checkNames(bool yn) { checkNames_ = yn; }
+
+  private:
+    void writeAlignment_(std::ostream& output, const SiteContainer& sc, const StockholmAnnotation* annotation) const;
+};
+
+/**
+ * @brief Iterate over the alignments of a Stockholm stream.
+ *
+ * Alignments are read one at a time, so that files with many alignments (e.g. Pfam seed files)
+ * can be processed without loading them entirely.
+ */
+class StockholmAlignmentIterator
+{
+  private:
+    const Stockholm* reader_;
+    std::istream* stream_;
+    const Alphabet* alphabet_;
+    AlignedSequenceContainer* nextAlignment_;
+    StockholmAnnotation nextAnnotation_;
+
+  public:
+    /**
+     * @param reader   The reader to use.
+     * @param stream   The stream to read.
+     * @param alphabet The alphabet of the alignments.
+     */
+    StockholmAlignmentIterator(const Stockholm& reader, std::istream& stream, const Alphabet* alphabet);
+
+    virtual ~StockholmAlignmentIterator() { delete nextAlignment_; }
+
+  private: //Recopy is forbidden
+    StockholmAlignmentIterator(const StockholmAlignmentIterator& sai):
+      reader_(sai.reader_),
+      stream_(sai.stream_),
+      alphabet_(sai.alphabet_),
+      nextAlignment_(0),
+      nextAnnotation_() {}
+
+    StockholmAlignmentIterator& operator=(const StockholmAlignmentIterator& sai)
+    {
+      reader_    = sai.reader_;
+      stream_    = sai.stream_;
+      alphabet_  = sai.alphabet_;
+      nextAlignment_ = 0;
+      nextAnnotation_.clear();
+      return *this;
+    }
+
+  public:
+    /**
+     * @param annotation If not null, this object is replaced by the annotations of the returned alignment.
+     * @return The next alignment (to be deleted by the caller), or null if there is no more alignment.
+     */
+    AlignedSequenceContainer* nextAlignment(StockholmAnnotation* annotation = 0);
+
+    bool hasMoreAlignments() const { return nextAlignment_ != 0; }
+
+  private:
+    void readAhead_();
 };
 
 } //end of namespace bpp.
 
-#endif // _FASTA_H_
+#endif // _STOCKHOLM_H_
 
@@ -0,0 +1,335 @@
+//
+// File: KmerCounter.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "KmerCounter.h"
+#include "Alphabet/AlphabetTools.h"
+#include "Alphabet/AlphabetExceptions.h"
+
+#include <Bpp/Text/TextTools.h>
+
+// From the STL:
+#include <limits>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+const uint64_t KmerHashTable::EMPTY = numeric_limits<uint64_t>::max();
+
+KmerHashTable::KmerHashTable(size_t capacity):
+  kmers_(), counts_(), size_(0)
+{
+  size_t n = 16;
+  while (n < capacity) n <<= 1;
+  kmers_.resize(n, EMPTY);
+  counts_.resize(n, 0);
+}
+
+/******************************************************************************/
+
+size_t KmerHashTable::find_(uint64_t kmer) const
+{
+  size_t mask = kmers_.size() - 1;
+  size_t slot = static_cast<size_t>(KmerTools::hash(kmer) >> 7) & mask;
+  while (kmers_[slot] != EMPTY && kmers_[slot] != kmer)
+    slot = (slot + 1) & mask;
+  return slot;
+}
+
+void KmerHashTable::increment(uint64_t kmer, unsigned int count)
+{
+  size_t slot = find_(kmer);
+  if (kmers_[slot] == EMPTY)
+  {
+    if (10 * (size_ + 1) > 7 * kmers_.size())
+    {
+      grow_();
+      slot = find_(kmer);
+    }
+    kmers_[slot] = kmer;
+    size_++;
+  }
+  unsigned int& c = counts_[slot];
+  c = (c > numeric_limits<unsigned int>::max() - count) ? numeric_limits<unsigned int>::max() : c + count;
+}
+
+unsigned int KmerHashTable::getCount(uint64_t kmer) const
+{
+  size_t slot = find_(kmer);
+  return kmers_[slot] == EMPTY ? 0 : counts_[slot];
+}
+
+void KmerHashTable::grow_()
+{
+  vector<uint64_t> kmers(kmers_.size() * 2, EMPTY);
+  vector<unsigned int> counts(counts_.size() * 2, 0);
+  kmers_.swap(kmers);
+  counts_.swap(counts);
+  for (size_t i = 0; i < kmers.size(); ++i)
+  {
+    if (kmers[i] != EMPTY)
+    {
+      size_t slot = find_(kmers[i]);
+      kmers_[slot] = kmers[i];
+      counts_[slot] = counts[i];
+    }
+  }
+}
+
+/******************************************************************************/
+
+KmerCounter::KmerCounter(unsigned int k, bool canonical, size_t numberOfPartitions):
+  k_(k), canonical_(canonical), partitions_(), sketchWidth_(0), sketch_(), total_(0)
+{
+  if (k == 0 || k > KmerTools::MAX_K)
+    throw Exception("KmerCounter: k must be between 1 and " + TextTools::toString(KmerTools::MAX_K) + ".");
+  if (numberOfPartitions == 0)
+    throw Exception("KmerCounter: at least one partition is required.");
+  partitions_.resize(numberOfPartitions);
+}
+
+KmerCounter::KmerCounter(unsigned int k, bool canonical, size_t sketchWidth, size_t sketchDepth):
+  k_(k), canonical_(canonical), partitions_(), sketchWidth_(sketchWidth), sketch_(), total_(0)
+{
+  if (k == 0 || k > KmerTools::MAX_K)
+    throw Exception("KmerCounter: k must be between 1 and " + TextTools::toString(KmerTools::MAX_K) + ".");
+  if (sketchWidth == 0 || sketchDepth == 0)
+    throw Exception("KmerCounter: sketch width and depth must be strictly positive.");
+  sketch_.resize(sketchDepth, vector<unsigned int>(sketchWidth, 0));
+}
+
+/******************************************************************************/
+
+namespace
+{
+  // Sketch rows use independent hash functions:
+  inline size_t sketchSlot_(uint64_t kmer, size_t row, size_t width)
+  {
+    return static_cast<size_t>(KmerTools::hash(kmer ^ KmerTools::hash(static_cast<uint64_t>(row) + 1)) % width);
+  }
+
+  struct KmerBuffer_
+  {
+    vector<uint64_t>* kmers;
+    void operator()(uint64_t kmer, size_t) { kmers->push_back(kmer); }
+  };
+
+  // Number of k-mers buffered before being dispatched to partitions:
+  const size_t BUFFER_SIZE = 1 << 20;
+}
+
+/******************************************************************************/
+
+void KmerCounter::addKmers_(const vector<uint64_t>& kmers)
+{
+  // Each partition (or sketch row) is only modified by one thread:
+  if (isSketch())
+  {
+    size_t depth = sketch_.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (size_t r = 0; r < depth; ++r)
+    {
+      vector<unsigned int>& row = sketch_[r];
+      for (size_t i = 0; i < kmers.size(); ++i)
+      {
+        unsigned int& c = row[sketchSlot_(kmers[i], r, sketchWidth_)];
+        if (c < numeric_limits<unsigned int>::max()) c++;
+      }
+    }
+  }
+  else
+  {
+    // Each k-mer is hashed once, to dispatch it to its partition:
+    size_t n = partitions_.size();
+    vector< vector<uint64_t> > buckets(n);
+    for (size_t p = 0; p < n; ++p)
+      buckets[p].reserve(kmers.size() / n + 1);
+    for (size_t i = 0; i < kmers.size(); ++i)
+      buckets[KmerTools::hash(kmers[i]) % n].push_back(kmers[i]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (size_t p = 0; p < n; ++p)
+    {
+      KmerHashTable& table = partitions_[p];
+      const vector<uint64_t>& bucket = buckets[p];
+      for (size_t i = 0; i < bucket.size(); ++i)
+        table.increment(bucket[i]);
+    }
+  }
+  total_ += kmers.size();
+}
+
+/******************************************************************************/
+
+void KmerCounter::addSequence(const SymbolList& list)
+{
+  if (!AlphabetTools::isNucleicAlphabet(list.getAlphabet()))
+    throw AlphabetException("KmerCounter::addSequence. Input sequence must be nucleic.", list.getAlphabet());
+  // K-mers are extracted by chunks, which are then dispatched to partitions in parallel.
+  vector<uint64_t> kmers;
+  kmers.reserve(BUFFER_SIZE);
+  RollingKmer rolling(k_);
+  for (size_t i = 0; i < list.size(); ++i)
+  {
+    if (rolling.push(list[i]))
+    {
+      kmers.push_back(canonical_ ? rolling.getCanonical() : rolling.getForward());
+      if (kmers.size() == BUFFER_SIZE)
+      {
+        addKmers_(kmers);
+        kmers.clear();
+      }
+    }
+  }
+  if (kmers.size() > 0)
+    addKmers_(kmers);
+}
+
+void KmerCounter::addSequences(const OrderedSequenceContainer& sequences)
+{
+  if (!AlphabetTools::isNucleicAlphabet(sequences.getAlphabet()))
+    throw AlphabetException("KmerCounter::addSequences. Input sequences must be nucleic.", sequences.getAlphabet());
+  for (size_t i = 0; i < sequences.getNumberOfSequences(); ++i)
+    addSequence(sequences.getSequence(i));
+}
+
+/******************************************************************************/
+
+size_t KmerCounter::getCount(uint64_t kmer) const
+{
+  if (canonical_)
+    kmer = KmerTools::getCanonical(kmer, k_);
+  if (isSketch())
+  {
+    unsigned int c = numeric_limits<unsigned int>::max();
+    for (size_t r = 0; r < sketch_.size(); ++r)
+    {
+      unsigned int x = sketch_[r][sketchSlot_(kmer, r, sketchWidth_)];
+      if (x < c) c = x;
+    }
+    return c;
+  }
+  return partitions_[KmerTools::hash(kmer) % partitions_.size()].getCount(kmer);
+}
+
+size_t KmerCounter::getNumberOfDistinctKmers() const
+{
+  if (isSketch())
+    throw Exception("KmerCounter::getNumberOfDistinctKmers. Not available in sketch mode.");
+  size_t n = 0;
+  for (size_t p = 0; p < partitions_.size(); ++p)
+    n += partitions_[p].getNumberOfKmers();
+  return n;
+}
+
+/******************************************************************************/
+
+vector<size_t> KmerCounter::getSpectrum(size_t maxCount) const
+{
+  if (isSketch())
+    throw Exception("KmerCounter::getSpectrum. Not available in sketch mode.");
+  vector<size_t> spectrum(maxCount + 1, 0);
+  for (size_t p = 0; p < partitions_.size(); ++p)
+  {
+    const KmerHashTable& table = partitions_[p];
+    for (size_t i = 0; i < table.getCapacity(); ++i)
+    {
+      if (!table.isEmpty(i))
+      {
+        size_t c = table.getCountAt(i);
+        spectrum[c < maxCount ? c : maxCount]++;
+      }
+    }
+  }
+  return spectrum;
+}
+
+void KmerCounter::writeSpectrum(ostream& out, size_t maxCount) const
+{
+  vector<size_t> spectrum = getSpectrum(maxCount);
+  out << "Count\tKmers" << endl;
+  for (size_t i = 1; i < spectrum.size(); ++i)
+  {
+    if (spectrum[i] > 0)
+      out << i << "\t" << spectrum[i] << endl;
+  }
+}
+
+/******************************************************************************/
+
+KmerCountIterator::KmerCountIterator(const KmerCounter& counter):
+  counter_(&counter), partition_(0), slot_(0)
+{
+  if (counter.isSketch())
+    throw Exception("KmerCountIterator. Iteration is not available in sketch mode.");
+  skipEmpty_();
+}
+
+void KmerCountIterator::skipEmpty_()
+{
+  while (partition_ < counter_->getNumberOfPartitions())
+  {
+    const KmerHashTable& table = counter_->getPartition(partition_);
+    while (slot_ < table.getCapacity() && table.isEmpty(slot_))
+      slot_++;
+    if (slot_ < table.getCapacity())
+      return;
+    partition_++;
+    slot_ = 0;
+  }
+}
+
+pair<uint64_t, size_t> KmerCountIterator::nextKmer()
+{
+  if (!hasMoreKmers())
+    throw Exception("KmerCountIterator::nextKmer. No more k-mer.");
+  const KmerHashTable& table = counter_->getPartition(partition_);
+  pair<uint64_t, size_t> kmer(table.getKmerAt(slot_), table.getCountAt(slot_));
+  slot_++;
+  skipEmpty_();
+  return kmer;
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,269 @@
+//
+// File: KmerCounter.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _KMERCOUNTER_H_
+#define _KMERCOUNTER_H_
+
+#include "KmerTools.h"
+#include "SymbolList.h"
+#include "Container/OrderedSequenceContainer.h"
+
+// From the STL:
+#include <vector>
+#include <iostream>
+#include <utility>
+
+namespace bpp
+{
+
+/**
+ * @brief Open-addressing hash table storing k-mer counts.
+ *
+ * Keys are stored in a flat array with linear probing, and the table is doubled
+ * when its load factor exceeds 0.7.
+ */
+class KmerHashTable
+{
+  private:
+    std::vector<uint64_t> kmers_;
+    std::vector<unsigned int> counts_;
+    size_t size_;
+
+  public:
+    /**
+     * @brief Code of empty slots (not a valid k-mer code).
+     */
+    static const uint64_t EMPTY;
+
+  public:
+    /**
+     * @param capacity Initial number of slots, rounded up to a power of 2.
+     */
+    KmerHashTable(size_t capacity = 1024);
+
+  public:
+    /**
+     * @brief Increment the count of a k-mer.
+     */
+    void increment(uint64_t kmer, unsigned int count = 1);
+
+    /**
+     * @return The count of a k-mer (0 if absent).
+     */
+    unsigned int getCount(uint64_t kmer) const;
+
+    /**
+     * @return The number of distinct k-mers in the table.
+     */
+    size_t getNumberOfKmers() const { return size_; }
+
+    /**
+     * @name Slot access, for iteration.
+     *
+     * @{
+     */
+    size_t getCapacity() const { return kmers_.size(); }
+    bool isEmpty(size_t slot) const { return kmers_[slot] == EMPTY; }
+    uint64_t getKmerAt(size_t slot) const { return kmers_[slot]; }
+    unsigned int getCountAt(size_t slot) const { return counts_[slot]; }
+    /** @} */
+
+  private:
+    size_t find_(uint64_t kmer) const;
+    void grow_();
+};
+
+/**
+ * @brief Count k-mers in nucleic sequences.
+ *
+ * K-mers containing gaps or unresolved states are skipped.
+ * When canonical counting is enabled, a k-mer and its reverse complement are counted together,
+ * under the smallest of their two codes.
+ *
+ * Two storage modes are available:
+ * - exact counting, where k-mers are dispatched into several hash tables (partitions) according
+ *   to their hash value. When compiled with OpenMP support, partitions are filled in parallel.
+ * - count-min sketch, where memory is bounded by the sketch width and depth, and counts are
+ *   upper estimates. Distinct k-mers are not stored in this mode, so that they can't be
+ *   iterated over, and the spectrum is not available.
+ *
+ * @see KmerTools for k-mer encoding.
+ */
+class KmerCounter
+{
+  private:
+    unsigned int k_;
+    bool canonical_;
+    std::vector<KmerHashTable> partitions_;
+    size_t sketchWidth_;
+    std::vector< std::vector<unsigned int> > sketch_;
+    size_t total_;
+
+  public:
+    /**
+     * @brief Build a new exact counter.
+     *
+     * @param k                  The k-mer size, from 1 to KmerTools::MAX_K.
+     * @param canonical          Tell if canonical k-mers should be counted.
+     * @param numberOfPartitions The number of hash tables to use.
+     * @throw Exception If k is out of range or the number of partitions is 0.
+     */
+    KmerCounter(unsigned int k, bool canonical = true, size_t numberOfPartitions = 16);
+
+    /**
+     * @brief Build a new count-min sketch counter.
+     *
+     * @param k           The k-mer size, from 1 to KmerTools::MAX_K.
+     * @param canonical   Tell if canonical k-mers should be counted.
+     * @param sketchWidth The number of counters in each row of the sketch.
+     * @param sketchDepth The number of rows in the sketch.
+     * @throw Exception If k is out of range or the sketch is empty.
+     */
+    KmerCounter(unsigned int k, bool canonical, size_t sketchWidth, size_t sketchDepth);
+
+    virtual ~KmerCounter() {}
+
+  public:
+    unsigned int getK() const { return k_; }
+    bool isCanonical() const { return canonical_; }
+    bool isSketch() const { return sketchWidth_ > 0; }
+
+    /**
+     * @brief Count all k-mers in a nucleic sequence.
+     *
+     * @throw AlphabetException If the sequence is not nucleic.
+     */
+    void addSequence(const SymbolList& list);
+
+    /**
+     * @brief Count all k-mers in a container of nucleic sequences.
+     *
+     * @throw AlphabetException If the container is not nucleic.
+     */
+    void addSequences(const OrderedSequenceContainer& sequences);
+
+    /**
+     * @return The count of a k-mer (canonized if needed). In sketch mode, this is an upper estimate.
+     */
+    size_t getCount(uint64_t kmer) const;
+
+    /**
+     * @return The total number of k-mers counted.
+     */
+    size_t getTotalNumberOfKmers() const { return total_; }
+
+    /**
+     * @return The number of distinct k-mers counted.
+     * @throw Exception In sketch mode.
+     */
+    size_t getNumberOfDistinctKmers() const;
+
+    size_t getNumberOfPartitions() const { return partitions_.size(); }
+    const KmerHashTable& getPartition(size_t i) const { return partitions_[i]; }
+
+    /**
+     * @brief Get the k-mer spectrum.
+     *
+     * @param maxCount The largest count reported. All k-mers with a larger count are reported in the last bin.
+     * @return A vector of size maxCount + 1, where element i is the number of distinct k-mers seen i times.
+     * @throw Exception In sketch mode.
+     */
+    std::vector<size_t> getSpectrum(size_t maxCount) const;
+
+    /**
+     * @brief Write the k-mer spectrum as tab-delimited (count, number of k-mers) lines.
+     *
+     * Empty bins are not written.
+     *
+     * @param out      The output stream.
+     * @param maxCount The largest count reported.
+     * @throw Exception In sketch mode.
+     */
+    void writeSpectrum(std::ostream& out, size_t maxCount) const;
+
+  private:
+    void addKmers_(const std::vector<uint64_t>& kmers);
+};
+
+/**
+ * @brief Iterate over the (k-mer, count) pairs of an exact KmerCounter.
+ *
+ * K-mers are not sorted. The counter must not be modified during the iteration.
+ */
+class KmerCountIterator
+{
+  private:
+    const KmerCounter* counter_;
+    size_t partition_;
+    size_t slot_;
+
+  public:
+    /**
+     * @throw Exception If the counter is in sketch mode.
+     */
+    KmerCountIterator(const KmerCounter& counter);
+
+    KmerCountIterator(const KmerCountIterator& it): counter_(it.counter_), partition_(it.partition_), slot_(it.slot_) {}
+    KmerCountIterator& operator=(const KmerCountIterator& it)
+    {
+      counter_ = it.counter_;
+      partition_ = it.partition_;
+      slot_ = it.slot_;
+      return *this;
+    }
+
+    virtual ~KmerCountIterator() {}
+
+  public:
+    bool hasMoreKmers() const { return partition_ < counter_->getNumberOfPartitions(); }
+
+    /**
+     * @return The next (k-mer, count) pair.
+     * @throw Exception If there is no more k-mer.
+     */
+    std::pair<uint64_t, size_t> nextKmer();
+
+  private:
+    void skipEmpty_();
+};
+
+} //end of namespace bpp.
+
+#endif //_KMERCOUNTER_H_
+
@@ -0,0 +1,113 @@
+//
+// File: KmerTools.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "KmerTools.h"
+#include "Alphabet/AlphabetTools.h"
+#include "Alphabet/AlphabetExceptions.h"
+
+#include <Bpp/Text/TextTools.h>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+const unsigned int KmerTools::MAX_K = 31;
+
+/******************************************************************************/
+
+RollingKmer::RollingKmer(unsigned int k):
+  k_(k), mask_(0), shift_(0), forward_(0), reverse_(0), valid_(0)
+{
+  if (k == 0 || k > KmerTools::MAX_K)
+    throw Exception("RollingKmer: k must be between 1 and " + TextTools::toString(KmerTools::MAX_K) + ".");
+  mask_ = (static_cast<uint64_t>(1) << (2 * k)) - 1;
+  shift_ = 2 * (k - 1);
+}
+
+/******************************************************************************/
+
+uint64_t KmerTools::reverseComplement(uint64_t kmer, unsigned int k)
+{
+  uint64_t rc = 0;
+  for (unsigned int i = 0; i < k; ++i)
+  {
+    rc = (rc << 2) | (3 - (kmer & 3));
+    kmer >>= 2;
+  }
+  return rc;
+}
+
+/******************************************************************************/
+
+uint64_t KmerTools::encode(const string& word, const Alphabet* alphabet)
+{
+  if (!AlphabetTools::isNucleicAlphabet(alphabet))
+    throw AlphabetException("KmerTools::encode. Alphabet must be nucleic.", alphabet);
+  if (word.size() == 0 || word.size() > MAX_K)
+    throw Exception("KmerTools::encode. Word length must be between 1 and " + TextTools::toString(MAX_K) + ": " + word);
+  uint64_t kmer = 0;
+  for (size_t i = 0; i < word.size(); ++i)
+  {
+    int state = alphabet->charToInt(word.substr(i, 1));
+    if (state < 0 || state > 3)
+      throw Exception("KmerTools::encode. Unresolved state in word: " + word);
+    kmer = (kmer << 2) | static_cast<uint64_t>(state);
+  }
+  return kmer;
+}
+
+/******************************************************************************/
+
+string KmerTools::decode(uint64_t kmer, unsigned int k, const Alphabet* alphabet)
+{
+  if (!AlphabetTools::isNucleicAlphabet(alphabet))
+    throw AlphabetException("KmerTools::decode. Alphabet must be nucleic.", alphabet);
+  string word(k, ' ');
+  for (size_t i = k; i > 0; --i)
+  {
+    word[i - 1] = alphabet->intToChar(static_cast<int>(kmer & 3))[0];
+    kmer >>= 2;
+  }
+  return word;
+}
+
+/******************************************************************************/
+
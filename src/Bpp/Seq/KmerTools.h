@@ -0,0 +1,213 @@
+//
+// File: KmerTools.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _KMERTOOLS_H_
+#define _KMERTOOLS_H_
+
+#include "Alphabet/Alphabet.h"
+
+// From the STL:
+#include <string>
+#include <cstdint>
+
+namespace bpp
+{
+
+/**
+ * @brief Rolling 2-bit encoding of nucleotide k-mers.
+ *
+ * States 0 to 3 of a nucleic alphabet are pushed one at a time.
+ * Any other state (gap, ambiguity code, unknown character) breaks the current k-mer,
+ * so that only fully resolved k-mers are produced.
+ * The first position of a k-mer is stored in the most significant bits,
+ * which gives the same codes as a WordAlphabet of length k built on the nucleic alphabet.
+ */
+class RollingKmer
+{
+  private:
+    unsigned int k_;
+    uint64_t mask_;
+    unsigned int shift_;
+    uint64_t forward_;
+    uint64_t reverse_;
+    size_t valid_;
+
+  public:
+    /**
+     * @param k The k-mer size, from 1 to 31.
+     * @throw Exception If k is out of range.
+     */
+    RollingKmer(unsigned int k);
+
+  public:
+    unsigned int getK() const { return k_; }
+
+    /**
+     * @brief Add a state at the end of the current k-mer.
+     *
+     * @param state The state to add.
+     * @return true if a complete k-mer is available.
+     */
+    bool push(int state)
+    {
+      if (state < 0 || state > 3)
+      {
+        reset();
+        return false;
+      }
+      uint64_t c = static_cast<uint64_t>(state);
+      forward_ = ((forward_ << 2) | c) & mask_;
+      reverse_ = (reverse_ >> 2) | ((3 - c) << shift_);
+      return ++valid_ >= k_;
+    }
+
+    void reset()
+    {
+      forward_ = 0;
+      reverse_ = 0;
+      valid_ = 0;
+    }
+
+    /**
+     * @return The code of the current k-mer.
+     */
+    uint64_t getForward() const { return forward_; }
+
+    /**
+     * @return The code of the reverse complement of the current k-mer.
+     */
+    uint64_t getReverse() const { return reverse_; }
+
+    /**
+     * @return The smallest code of the current k-mer and its reverse complement.
+     */
+    uint64_t getCanonical() const { return forward_ < reverse_ ? forward_ : reverse_; }
+};
+
+/**
+ * @brief Utilitary functions dealing with nucleotide k-mers.
+ *
+ * @see RollingKmer for the encoding.
+ */
+class KmerTools
+{
+  public:
+    KmerTools() {}
+    virtual ~KmerTools() {}
+
+  public:
+    /**
+     * @brief Maximum k-mer size.
+     */
+    static const unsigned int MAX_K;
+
+    /**
+     * @brief Mix the bits of a k-mer code.
+     *
+     * The output is suitable for hash tables, partitioning and sketching.
+     */
+    static uint64_t hash(uint64_t kmer)
+    {
+      kmer ^= kmer >> 33;
+      kmer *= 0xff51afd7ed558ccdULL;
+      kmer ^= kmer >> 33;
+      kmer *= 0xc4ceb9fe1a85ec53ULL;
+      kmer ^= kmer >> 33;
+      return kmer;
+    }
+
+    /**
+     * @return The code of the reverse complement of a k-mer.
+     */
+    static uint64_t reverseComplement(uint64_t kmer, unsigned int k);
+
+    /**
+     * @return The smallest code of a k-mer and its reverse complement.
+     */
+    static uint64_t getCanonical(uint64_t kmer, unsigned int k)
+    {
+      uint64_t rc = reverseComplement(kmer, k);
+      return kmer < rc ? kmer : rc;
+    }
+
+    /**
+     * @brief Get the code of a k-mer from its string description.
+     *
+     * @param word     The k-mer.
+     * @param alphabet A nucleic alphabet.
+     * @throw AlphabetException If the alphabet is not nucleic.
+     * @throw Exception If the word is too long or contains other states than A, C, G and T/U.
+     */
+    static uint64_t encode(const std::string& word, const Alphabet* alphabet);
+
+    /**
+     * @brief Get the string description of a k-mer.
+     *
+     * @param kmer     The k-mer code.
+     * @param k        The k-mer size.
+     * @param alphabet A nucleic alphabet.
+     * @throw AlphabetException If the alphabet is not nucleic.
+     */
+    static std::string decode(uint64_t kmer, unsigned int k, const Alphabet* alphabet);
+
+    /**
+     * @brief Call a functor for each resolved k-mer of a list of states.
+     *
+     * @param states    Any object giving access to the states with operator[].
+     * @param length    The number of states.
+     * @param k         The k-mer size.
+     * @param canonical Tell if canonical k-mers should be reported.
+     * @param functor   A functor called as functor(kmer, position), position being the start of the k-mer.
+     */
+    template<class States, class Functor>
+    static void scanKmers(const States& states, size_t length, unsigned int k, bool canonical, Functor& functor)
+    {
+      RollingKmer rolling(k);
+      for (size_t i = 0; i < length; ++i)
+      {
+        if (rolling.push(states[i]))
+          functor(canonical ? rolling.getCanonical() : rolling.getForward(), i + 1 - k);
+      }
+    }
+};
+
+} //end of namespace bpp.
+
+#endif //_KMERTOOLS_H_
+
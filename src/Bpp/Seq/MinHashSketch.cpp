@@ -0,0 +1,168 @@
+//
+// File: MinHashSketch.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "MinHashSketch.h"
+#include "Alphabet/AlphabetTools.h"
+#include "Alphabet/AlphabetExceptions.h"
+
+#include <Bpp/Text/TextTools.h>
+
+// From the STL:
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+MinHashSketch::MinHashSketch(const string& name, unsigned int k, size_t sketchSize, bool canonical):
+  name_(name), k_(k), sketchSize_(sketchSize), canonical_(canonical), hashes_()
+{
+  if (k == 0 || k > KmerTools::MAX_K)
+    throw Exception("MinHashSketch: k must be between 1 and " + TextTools::toString(KmerTools::MAX_K) + ".");
+  if (sketchSize == 0)
+    throw Exception("MinHashSketch: sketch size must be strictly positive.");
+}
+
+MinHashSketch::MinHashSketch(const SymbolList& list, const string& name, unsigned int k, size_t sketchSize, bool canonical):
+  name_(name), k_(k), sketchSize_(sketchSize), canonical_(canonical), hashes_()
+{
+  if (k == 0 || k > KmerTools::MAX_K)
+    throw Exception("MinHashSketch: k must be between 1 and " + TextTools::toString(KmerTools::MAX_K) + ".");
+  if (sketchSize == 0)
+    throw Exception("MinHashSketch: sketch size must be strictly positive.");
+  addSequence(list);
+}
+
+/******************************************************************************/
+
+void MinHashSketch::setHashes(const vector<uint64_t>& hashes)
+{
+  hashes_ = hashes;
+  sort(hashes_.begin(), hashes_.end());
+  hashes_.erase(unique(hashes_.begin(), hashes_.end()), hashes_.end());
+  if (hashes_.size() > sketchSize_)
+    hashes_.resize(sketchSize_);
+}
+
+/******************************************************************************/
+
+template<class States>
+void MinHashSketch::add_(const States& states, size_t length)
+{
+  // Candidate values are buffered and trimmed to the sketch size from time to time,
+  // only values smaller than the largest kept one need to be considered.
+  vector<uint64_t> buffer(hashes_);
+  uint64_t threshold = hashes_.size() < sketchSize_ ? numeric_limits<uint64_t>::max() : hashes_.back();
+  size_t maxBuffer = 4 * sketchSize_ + 64;
+  RollingKmer rolling(k_);
+  for (size_t i = 0; i < length; ++i)
+  {
+    if (rolling.push(states[i]))
+    {
+      uint64_t h = KmerTools::hash(canonical_ ? rolling.getCanonical() : rolling.getForward());
+      if (h < threshold)
+      {
+        buffer.push_back(h);
+        if (buffer.size() >= maxBuffer)
+        {
+          setHashes(buffer);
+          buffer = hashes_;
+          if (hashes_.size() == sketchSize_)
+            threshold = hashes_.back();
+        }
+      }
+    }
+  }
+  setHashes(buffer);
+}
+
+void MinHashSketch::addStates(const int* states, size_t length)
+{
+  add_(states, length);
+}
+
+void MinHashSketch::addSequence(const SymbolList& list)
+{
+  if (!AlphabetTools::isNucleicAlphabet(list.getAlphabet()))
+    throw AlphabetException("MinHashSketch::addSequence. Input sequence must be nucleic.", list.getAlphabet());
+  add_(list, list.size());
+}
+
+/******************************************************************************/
+
+double MinHashSketch::getJaccardIndex(const MinHashSketch& sketch) const
+{
+  if (!isCompatibleWith(sketch))
+    throw Exception("MinHashSketch::getJaccardIndex. Sketches '" + name_ + "' and '" + sketch.name_ + "' were built with different parameters.");
+  // Walk the bottom-s values of the union, and count the ones present in both sketches:
+  const vector<uint64_t>& h1 = hashes_;
+  const vector<uint64_t>& h2 = sketch.hashes_;
+  size_t i = 0, j = 0, n = 0, shared = 0;
+  while (n < sketchSize_ && (i < h1.size() || j < h2.size()))
+  {
+    if (j == h2.size() || (i < h1.size() && h1[i] < h2[j]))
+      i++;
+    else if (i == h1.size() || h2[j] < h1[i])
+      j++;
+    else
+    {
+      shared++;
+      i++;
+      j++;
+    }
+    n++;
+  }
+  if (n == 0) return 0.;
+  return static_cast<double>(shared) / static_cast<double>(n);
+}
+
+double MinHashSketch::getMashDistance(const MinHashSketch& sketch) const
+{
+  double j = getJaccardIndex(sketch);
+  if (j == 0.) return 1.;
+  double d = log((1. + j) / (2. * j)) / static_cast<double>(k_);
+  return d > 1. ? 1. : d;
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,170 @@
+//
+// File: MinHashSketch.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _MINHASHSKETCH_H_
+#define _MINHASHSKETCH_H_
+
+#include "KmerTools.h"
+#include "SymbolList.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Bottom-s MinHash sketch of the k-mers of a sequence.
+ *
+ * The sketch stores the s smallest distinct hash values (KmerTools::hash) of the canonical
+ * (or forward) k-mers of a sequence, in increasing order.
+ * Two sketches built with the same parameters can be compared to estimate the Jaccard
+ * index of the k-mer sets of the two sequences.
+ *
+ * @see MinHashTools
+ */
+class MinHashSketch
+{
+  private:
+    std::string name_;
+    unsigned int k_;
+    size_t sketchSize_;
+    bool canonical_;
+    std::vector<uint64_t> hashes_;
+
+  public:
+    /**
+     * @brief Build an empty sketch.
+     *
+     * @param name       The name of the sketched sequence.
+     * @param k          The k-mer size, from 1 to KmerTools::MAX_K.
+     * @param sketchSize The maximum number of hash values to keep.
+     * @param canonical  Tell if canonical k-mers should be used.
+     * @throw Exception If k is out of range or the sketch size is 0.
+     */
+    MinHashSketch(const std::string& name, unsigned int k, size_t sketchSize, bool canonical = true);
+
+    /**
+     * @brief Build the sketch of a nucleic sequence.
+     *
+     * @param list       The sequence to sketch.
+     * @param name       The name of the sketched sequence.
+     * @param k          The k-mer size, from 1 to KmerTools::MAX_K.
+     * @param sketchSize The maximum number of hash values to keep.
+     * @param canonical  Tell if canonical k-mers should be used.
+     * @throw AlphabetException If the sequence is not nucleic.
+     * @throw Exception If k is out of range or the sketch size is 0.
+     */
+    MinHashSketch(const SymbolList& list, const std::string& name, unsigned int k, size_t sketchSize, bool canonical = true);
+
+    virtual ~MinHashSketch() {}
+
+  public:
+    const std::string& getName() const { return name_; }
+    void setName(const std::string& name) { name_ = name; }
+    unsigned int getK() const { return k_; }
+    size_t getSketchSize() const { return sketchSize_; }
+    bool isCanonical() const { return canonical_; }
+
+    /**
+     * @return The hash values in the sketch, sorted in increasing order.
+     */
+    const std::vector<uint64_t>& getHashes() const { return hashes_; }
+
+    /**
+     * @brief Set the hash values of the sketch.
+     *
+     * Values are sorted, made unique and truncated to the sketch size.
+     */
+    void setHashes(const std::vector<uint64_t>& hashes);
+
+    /**
+     * @brief Add the k-mers of a list of states to the sketch.
+     *
+     * @param states A pointer toward the first state.
+     * @param length The number of states.
+     */
+    void addStates(const int* states, size_t length);
+
+    /**
+     * @brief Add the k-mers of a nucleic sequence to the sketch.
+     *
+     * @throw AlphabetException If the sequence is not nucleic.
+     */
+    void addSequence(const SymbolList& list);
+
+    /**
+     * @brief Tell if two sketches can be compared.
+     */
+    bool isCompatibleWith(const MinHashSketch& sketch) const
+    {
+      return k_ == sketch.k_ && sketchSize_ == sketch.sketchSize_ && canonical_ == sketch.canonical_;
+    }
+
+    /**
+     * @brief Estimate the Jaccard index of the k-mer sets of two sequences.
+     *
+     * @param sketch The sketch to compare with.
+     * @return The estimated Jaccard index (0 if both sketches are empty).
+     * @throw Exception If the two sketches are not compatible.
+     */
+    double getJaccardIndex(const MinHashSketch& sketch) const;
+
+    /**
+     * @brief Compute the Mash distance between two sequences.
+     *
+     * The Mash distance is D = -1/k ln(2j / (1 + j)), where j is the estimated Jaccard index.
+     * It is 1 when the sketches share no hash value.
+     *
+     * @param sketch The sketch to compare with.
+     * @return The Mash distance.
+     * @throw Exception If the two sketches are not compatible.
+     */
+    double getMashDistance(const MinHashSketch& sketch) const;
+
+  private:
+    template<class States>
+    void add_(const States& states, size_t length);
+};
+
+} //end of namespace bpp.
+
+#endif //_MINHASHSKETCH_H_
+
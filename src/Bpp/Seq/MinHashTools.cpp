@@ -0,0 +1,209 @@
+//
+// File: MinHashTools.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "MinHashTools.h"
+#include "Alphabet/AlphabetTools.h"
+#include "Alphabet/AlphabetExceptions.h"
+
+#include <Bpp/Exceptions.h>
+#include <Bpp/Text/TextTools.h>
+#include <Bpp/Text/StringTokenizer.h>
+
+// From the STL:
+#include <sstream>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+void MinHashTools::sketchSequences(const OrderedSequenceContainer& sequences, unsigned int k, size_t sketchSize, vector<MinHashSketch>& sketches, bool canonical)
+{
+  if (!AlphabetTools::isNucleicAlphabet(sequences.getAlphabet()))
+    throw AlphabetException("MinHashTools::sketchSequences. Input sequences must be nucleic.", sequences.getAlphabet());
+  size_t n = sequences.getNumberOfSequences();
+  size_t offset = sketches.size();
+  sketches.resize(offset + n, MinHashSketch("", k, sketchSize, canonical));
+  string error;
+  bool failed = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    // Containers may build sequences on the fly, access them one at a time:
+    vector<int> states;
+    MinHashSketch& sketch = sketches[offset + i];
+    bool ok = true;
+#ifdef _OPENMP
+#pragma omp critical(MinHashTools_access)
+#endif
+    {
+      if (failed) ok = false;
+      else
+      {
+        try
+        {
+          const Sequence& seq = sequences.getSequence(i);
+          sketch.setName(seq.getName());
+          states.resize(seq.size());
+          for (size_t j = 0; j < states.size(); ++j)
+            states[j] = seq[j];
+        }
+        catch (exception& e)
+        {
+          failed = true;
+          error = e.what();
+          ok = false;
+        }
+      }
+    }
+    if (ok && states.size() > 0)
+    {
+      try
+      {
+        sketch.addStates(&states[0], states.size());
+      }
+      catch (exception& e)
+      {
+#ifdef _OPENMP
+#pragma omp critical(MinHashTools_access)
+#endif
+        {
+          failed = true;
+          error = e.what();
+        }
+      }
+    }
+  }
+  if (failed)
+  {
+    sketches.erase(sketches.begin() + static_cast<ptrdiff_t>(offset), sketches.end());
+    throw Exception("MinHashTools::sketchSequences. " + error);
+  }
+}
+
+/******************************************************************************/
+
+DistanceMatrix* MinHashTools::computeDistanceMatrix(const vector<MinHashSketch>& sketches)
+{
+  size_t n = sketches.size();
+  for (size_t i = 1; i < n; ++i)
+  {
+    if (!sketches[i].isCompatibleWith(sketches[0]))
+      throw Exception("MinHashTools::computeDistanceMatrix. Sketch '" + sketches[i].getName() + "' was built with different parameters.");
+  }
+  DistanceMatrix* dist = new DistanceMatrix(n);
+  for (size_t i = 0; i < n; ++i)
+    dist->setName(i, sketches[i].getName());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    (*dist)(i, i) = 0.;
+    for (size_t j = i + 1; j < n; ++j)
+    {
+      double d = sketches[i].getMashDistance(sketches[j]);
+      (*dist)(i, j) = d;
+      (*dist)(j, i) = d;
+    }
+  }
+  return dist;
+}
+
+DistanceMatrix* MinHashTools::computeDistanceMatrix(const OrderedSequenceContainer& sequences, unsigned int k, size_t sketchSize, bool canonical)
+{
+  vector<MinHashSketch> sketches;
+  sketchSequences(sequences, k, sketchSize, sketches, canonical);
+  return computeDistanceMatrix(sketches);
+}
+
+/******************************************************************************/
+
+void MinHashTools::writeSketches(const vector<MinHashSketch>& sketches, ostream& out)
+{
+  if (!out)
+    throw IOException("MinHashTools::writeSketches: can't write to ostream output");
+  for (size_t i = 0; i < sketches.size(); ++i)
+  {
+    const MinHashSketch& sketch = sketches[i];
+    out << ">" << sketch.getName() << "\t" << sketch.getK() << "\t" << sketch.getSketchSize() << "\t" << (sketch.isCanonical() ? 1 : 0) << endl;
+    const vector<uint64_t>& hashes = sketch.getHashes();
+    for (size_t j = 0; j < hashes.size(); ++j)
+      out << (j > 0 ? " " : "") << hashes[j];
+    out << endl;
+  }
+}
+
+/******************************************************************************/
+
+void MinHashTools::readSketches(istream& in, vector<MinHashSketch>& sketches)
+{
+  if (!in)
+    throw IOException("MinHashTools::readSketches: can't read from istream input");
+  string header, values;
+  while (getline(in, header))
+  {
+    if (TextTools::isEmpty(header)) continue;
+    if (header[0] != '>')
+      throw IOException("MinHashTools::readSketches: sketch header expected, found: " + header);
+    StringTokenizer st(header.substr(1), "\t", false, true);
+    if (st.numberOfRemainingTokens() != 4)
+      throw IOException("MinHashTools::readSketches: malformed sketch header: " + header);
+    string name = st.nextToken();
+    unsigned int k = TextTools::to<unsigned int>(st.nextToken());
+    size_t sketchSize = TextTools::to<size_t>(st.nextToken());
+    bool canonical = st.nextToken() == "1";
+    MinHashSketch sketch(name, k, sketchSize, canonical);
+    if (!getline(in, values))
+      throw IOException("MinHashTools::readSketches: missing hash values for sketch " + name);
+    istringstream iss(values);
+    vector<uint64_t> hashes;
+    uint64_t h;
+    while (iss >> h)
+      hashes.push_back(h);
+    sketch.setHashes(hashes);
+    sketches.push_back(sketch);
+  }
+}
+
+/******************************************************************************/
+
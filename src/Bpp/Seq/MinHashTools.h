@@ -0,0 +1,121 @@
+//
+// File: MinHashTools.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _MINHASHTOOLS_H_
+#define _MINHASHTOOLS_H_
+
+#include "MinHashSketch.h"
+#include "DistanceMatrix.h"
+#include "Container/OrderedSequenceContainer.h"
+
+// From the STL:
+#include <iostream>
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Alignment-free distances based on MinHash sketches.
+ *
+ * When compiled with OpenMP support, sketches and distances are computed in parallel.
+ */
+class MinHashTools
+{
+  public:
+    MinHashTools() {}
+    virtual ~MinHashTools() {}
+
+  public:
+    /**
+     * @brief Sketch all sequences in a container.
+     *
+     * @param sequences  The nucleic sequences to sketch.
+     * @param k          The k-mer size.
+     * @param sketchSize The maximum number of hash values per sketch.
+     * @param sketches   The output vector where sketches will be appended, in the order of the container.
+     * @param canonical  Tell if canonical k-mers should be used.
+     * @throw AlphabetException If the container is not nucleic.
+     * @throw Exception If a sequence can not be read or sketched, in which case no sketch is appended.
+     */
+    static void sketchSequences(const OrderedSequenceContainer& sequences, unsigned int k, size_t sketchSize, std::vector<MinHashSketch>& sketches, bool canonical = true);
+
+    /**
+     * @brief Compute all pairwise Mash distances.
+     *
+     * @param sketches The sketches to compare, which must all be compatible.
+     * @return A new distance matrix, with the names of the sketches.
+     * @throw Exception If sketches are not compatible.
+     */
+    static DistanceMatrix* computeDistanceMatrix(const std::vector<MinHashSketch>& sketches);
+
+    /**
+     * @brief Sketch a container and compute all pairwise Mash distances.
+     *
+     * @see sketchSequences, computeDistanceMatrix
+     */
+    static DistanceMatrix* computeDistanceMatrix(const OrderedSequenceContainer& sequences, unsigned int k, size_t sketchSize, bool canonical = true);
+
+    /**
+     * @brief Write sketches to a stream.
+     *
+     * Each sketch is written on two lines: a header line '>name k sketchSize canonical'
+     * (tab-delimited), followed by the hash values separated by spaces.
+     *
+     * @param sketches The sketches to write.
+     * @param out      The output stream.
+     * @throw IOException If the stream can't be written.
+     */
+    static void writeSketches(const std::vector<MinHashSketch>& sketches, std::ostream& out);
+
+    /**
+     * @brief Read sketches from a stream.
+     *
+     * @param in       The input stream.
+     * @param sketches The output vector where sketches will be appended.
+     * @throw IOException If the stream can't be read or is malformed.
+     * @see writeSketches for the format.
+     */
+    static void readSketches(std::istream& in, std::vector<MinHashSketch>& sketches);
+};
+
+} //end of namespace bpp.
+
+#endif //_MINHASHTOOLS_H_
+
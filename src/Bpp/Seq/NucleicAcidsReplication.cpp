@@ -44,77 +44,123 @@ using namespace bpp;
 using namespace std;
 
 NucleicAcidsReplication::NucleicAcidsReplication(const NucleicAlphabet* nuc1, const NucleicAlphabet* nuc2) :
-  nuc1_(nuc1), nuc2_(nuc2), trans_()
+  nuc1_(nuc1), nuc2_(nuc2), trans_(16), valid1_(16), valid2_(16)
 {
-  trans_[-1] = -1;
-  trans_[0] = 3;
-  trans_[1] = 2;
-  trans_[2] = 1;
-  trans_[3] = 0;
-
-  trans_[4] = 9;
-  trans_[5] = 8;
-  trans_[6] = 6;
-  trans_[7] = 7;
-  trans_[8] = 5;
-  trans_[9] = 4;
-
-  trans_[10] = 13;
-  trans_[11] = 12;
-  trans_[12] = 11;
-  trans_[13] = 10;
-
-  trans_[14] = 14;
+  trans_[0] = -1;
+  trans_[1] = 3;
+  trans_[2] = 2;
+  trans_[3] = 1;
+  trans_[4] = 0;
+
+  trans_[5] = 9;
+  trans_[6] = 8;
+  trans_[7] = 6;
+  trans_[8] = 7;
+  trans_[9] = 5;
+  trans_[10] = 4;
+
+  trans_[11] = 13;
+  trans_[12] = 12;
+  trans_[13] = 11;
+  trans_[14] = 10;
+
+  trans_[15] = 14;
+
+  for (int state = -1; state < 15; ++state)
+  {
+    size_t i = static_cast<size_t>(state + 1);
+    valid1_[i] = nuc1_->isIntInAlphabet(state);
+    valid2_[i] = nuc2_->isIntInAlphabet(state);
+  }
+}
+
+void NucleicAcidsReplication::check_(const int* begin, const int* end, const vector<char>& valid, const Alphabet* alphabet, const string& method) const
+{
+  for (const int* p = begin; p != end; ++p)
+  {
+    if (*p < -1 || *p >= 15 || !valid[static_cast<size_t>(*p + 1)])
+      throw BadIntException(*p, "NucleicAcidsReplication::" + method + ": invalid state.", alphabet);
+  }
 }
 
 int NucleicAcidsReplication::translate(int state) const
 {
-  nuc1_->intToChar(state);
-  return trans_[state];
+  check_(&state, &state + 1, valid1_, nuc1_, "translate");
+  return trans_[static_cast<size_t>(state + 1)];
 }
 
 std::string NucleicAcidsReplication::translate(const std::string& state) const
 {
   int i = nuc1_->charToInt(state);
-  return nuc2_->intToChar(trans_[i]);
+  return nuc2_->intToChar(translate(i));
 }
 
 Sequence* NucleicAcidsReplication::translate(const Sequence& sequence) const
 {
-  if (sequence.getAlphabet()->getAlphabetType() != getSourceAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() != getSourceAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("NucleicAcidsReplication::translate", getSourceAlphabet(), getTargetAlphabet());
-  BasicSequence* tSeq = new BasicSequence(sequence.getName(), "", sequence.getComments(), getTargetAlphabet());
-  for (unsigned int i = 0; i < sequence.size(); i++)
-  {
-    tSeq->addElement(translate(sequence.getValue(i)));
-  }
+  SymbolListSpan states(sequence);
+  vector<int> content(states.begin(), states.end());
+  if (content.size() > 0)
+    translate(&content[0], &content[0] + content.size());
   //tSeq->setSense(!tSeq->getSense());
-  return tSeq;
+  return new BasicSequence(sequence.getName(), content, sequence.getComments(), getTargetAlphabet());
 }
 
 
 int NucleicAcidsReplication::reverse(int state) const 
 {
-  nuc2_->intToChar(state);
-  return trans_[state];
+  check_(&state, &state + 1, valid2_, nuc2_, "reverse");
+  return trans_[static_cast<size_t>(state + 1)];
 }
 
 std::string NucleicAcidsReplication::reverse(const std::string& state) const
 {
   int i = nuc2_->charToInt(state);
-  return nuc1_->intToChar(trans_[i]);
+  return nuc1_->intToChar(reverse(i));
 }
 
 Sequence* NucleicAcidsReplication::reverse(const Sequence& sequence) const
 {
-  if (sequence.getAlphabet()->getAlphabetType() != getTargetAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() != getTargetAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("NucleicAcidsReplication::reverse", getSourceAlphabet(), getTargetAlphabet());
-  BasicSequence* rSeq = new BasicSequence(sequence.getName(), "", sequence.getComments(), getSourceAlphabet());
-  for (unsigned int i = 0; i < sequence.size(); i++)
+  SymbolListSpan states(sequence);
+  vector<int> content(states.begin(), states.end());
+  if (content.size() > 0)
+    reverse(&content[0], &content[0] + content.size());
+  //rSeq->setSense(! rSeq->getSense());
+  return new BasicSequence(sequence.getName(), content, sequence.getComments(), getSourceAlphabet());
+}
+
+void NucleicAcidsReplication::translate(int* begin, int* end) const
+{
+  check_(begin, end, valid1_, nuc1_, "translate");
+  const int* table = &trans_[1];
+  for (int* p = begin; p != end; ++p)
+    *p = table[*p];
+}
+
+void NucleicAcidsReplication::reverse(int* begin, int* end) const
+{
+  check_(begin, end, valid2_, nuc2_, "reverse");
+  const int* table = &trans_[1];
+  for (int* p = begin; p != end; ++p)
+    *p = table[*p];
+}
+
+void NucleicAcidsReplication::translateAndInvert(int* begin, int* end) const
+{
+  check_(begin, end, valid1_, nuc1_, "translateAndInvert");
+  const int* table = &trans_[1];
+  while (end - begin > 1)
   {
-    rSeq->addElement(reverse(sequence.getValue(i)));
+    --end;
+    int tmp = table[*begin];
+    *begin = table[*end];
+    *end = tmp;
+    ++begin;
   }
-  //rSeq->setSense(! rSeq->getSense());
-  return rSeq;
+  if (begin != end)   // state in the middle of odd buffers
+    *begin = table[*begin];
 }
 
@@ -44,7 +44,7 @@ knowledge of the CeCILL license and that you accept its terms.
 #include "Alphabet/NucleicAlphabet.h"
 
 // From the STL:
-#include <map>
+#include <vector>
 
 namespace bpp
 {
@@ -61,19 +61,25 @@ namespace bpp
  * Since this is an instance of the ReverseIterator interface, transcription and
  * reverse transcription may be achieved from the same instance of the object by
  * using the translate and reverse methods.
+ *
+ * Complementary states are stored in a table, and whole buffers of states can be
+ * converted in place, with a single validity check before conversion.
  */
 class NucleicAcidsReplication :
   public ReverseTransliterator
 {
   private:
     const NucleicAlphabet* nuc1_, * nuc2_;
-    mutable std::map<int, int> trans_;
+    // Tables are indexed by state + 1, so that gaps (-1) are at index 0:
+    std::vector<int> trans_;
+    std::vector<char> valid1_, valid2_;
   
   public:
     NucleicAcidsReplication(const NucleicAlphabet* nuc1, const NucleicAlphabet* nuc2);
     NucleicAcidsReplication(const NucleicAcidsReplication& nar):
       ReverseTransliterator(nar),
-      nuc1_(nar.nuc1_), nuc2_(nar.nuc2_), trans_(nar.trans_)
+      nuc1_(nar.nuc1_), nuc2_(nar.nuc2_), trans_(nar.trans_),
+      valid1_(nar.valid1_), valid2_(nar.valid2_)
     {}
     NucleicAcidsReplication& operator=(const NucleicAcidsReplication& nar)
     {
@@ -81,6 +87,8 @@ class NucleicAcidsReplication :
       nuc1_ = nar.nuc1_;
       nuc2_ = nar.nuc2_;
       trans_ = nar.trans_;
+      valid1_ = nar.valid1_;
+      valid2_ = nar.valid2_;
       return *this;
     }
 
@@ -97,6 +105,38 @@ class NucleicAcidsReplication :
     std::string reverse(const std::string& state) const;      
       Sequence* reverse(const Sequence& sequence) const;
 
+    /**
+     * @brief Translate a buffer of states in place.
+     *
+     * All states are checked before any of them is modified.
+     *
+     * @param begin Pointer to the first state.
+     * @param end Pointer after the last state.
+     * @throw BadIntException If a state is not in the source alphabet.
+     */
+    void translate(int* begin, int* end) const;
+
+    /**
+     * @brief Reverse-translate a buffer of states in place.
+     *
+     * @see translate(int*, int*)
+     * @throw BadIntException If a state is not in the target alphabet.
+     */
+    void reverse(int* begin, int* end) const;
+
+    /**
+     * @brief Translate a buffer of states in place and invert their order.
+     *
+     * For a replication, this computes the reverse complement of the buffer.
+     *
+     * @see translate(int*, int*)
+     * @throw BadIntException If a state is not in the source alphabet.
+     */
+    void translateAndInvert(int* begin, int* end) const;
+
+  private:
+    void check_(const int* begin, const int* end, const std::vector<char>& valid, const Alphabet* alphabet, const std::string& method) const;
+
 };
 
 } //end of namespace bpp.
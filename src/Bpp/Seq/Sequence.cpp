@@ -204,7 +204,7 @@ void BasicSequence::setToSizeL(size_t newSize)
 
 void BasicSequence::append(const Sequence& seq)
 {
-  if (seq.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (seq.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("BasicSequence::append");
   // Check list for incorrect characters
   for (size_t i = 0; i < seq.size(); i++)
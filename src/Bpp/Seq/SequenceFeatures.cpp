@@ -0,0 +1,351 @@
+//
+// File: SequenceFeatures.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "SequenceFeatures.h"
+
+#include <Bpp/Exceptions.h>
+#include <Bpp/Text/TextTools.h>
+
+// From the STL:
+#include <algorithm>
+
+using namespace std;
+using namespace bpp;
+
+/******************************************************************************/
+
+void SequenceFeature::setRange(size_t begin, size_t end)
+{
+  if (begin > end)
+    throw Exception("SequenceFeature::setRange. Begin position is after end position: " + TextTools::toString(begin) + " > " + TextTools::toString(end) + ".");
+  begin_ = begin;
+  end_ = end;
+}
+
+/******************************************************************************/
+
+string SequenceFeature::getAttribute(const string& name) const
+{
+  map<string, string>::const_iterator it = attributes_.find(name);
+  return it == attributes_.end() ? "" : it->second;
+}
+
+/******************************************************************************/
+
+const string SequenceFeatureSet::FEATURES = "Sequence features";
+
+/******************************************************************************/
+
+bool SequenceFeatureSet::isValidWith(const SequenceWithAnnotation& sequence, bool throwException) const
+{
+  if (throwException && size_ != sequence.size()) throw Exception("SequenceFeatureSet. The annotated size must match the sequence size.");
+  return (size_ == sequence.size());
+}
+
+/******************************************************************************/
+
+void SequenceFeatureSet::afterSequenceChanged(const SymbolListEditionEvent& event)
+{
+  size_ = event.getSymbolList()->size();
+  clear();
+}
+
+/******************************************************************************/
+
+void SequenceFeatureSet::afterSequenceInserted(const SymbolListInsertionEvent& event)
+{
+  size_t pos = event.getPosition();
+  size_t len = event.getLength();
+  for (size_t i = 0; i < features_.size(); ++i)
+  {
+    SequenceFeature& feature = features_[i];
+    if (feature.getBegin() >= pos)
+      feature.setRange(feature.getBegin() + len, feature.getEnd() + len);
+    else if (feature.getEnd() > pos)
+      feature.setRange(feature.getBegin(), feature.getEnd() + len);
+  }
+  size_ += len;
+  indexed_ = false;
+}
+
+/******************************************************************************/
+
+void SequenceFeatureSet::afterSequenceDeleted(const SymbolListDeletionEvent& event)
+{
+  size_t pos = event.getPosition();
+  size_t len = event.getLength();
+  vector<SequenceFeature> kept;
+  kept.reserve(features_.size());
+  for (size_t i = 0; i < features_.size(); ++i)
+  {
+    SequenceFeature& feature = features_[i];
+    size_t begin = feature.getBegin();
+    size_t end   = feature.getEnd();
+    size_t newBegin = begin < pos ? begin : (begin >= pos + len ? begin - len : pos);
+    size_t newEnd   = end <= pos ? end : (end >= pos + len ? end - len : pos);
+    if (newBegin == newEnd && begin < end)
+      continue; //The feature was deleted.
+    feature.setRange(newBegin, newEnd);
+    kept.push_back(feature);
+  }
+  features_.swap(kept);
+  size_ -= len;
+  indexed_ = false;
+}
+
+/******************************************************************************/
+
+bool SequenceFeatureSet::merge(const SequenceAnnotation& anno)
+{
+  const SequenceFeatureSet* set = dynamic_cast<const SequenceFeatureSet*>(&anno);
+  if (!set)
+    return false;
+  for (size_t i = 0; i < set->features_.size(); ++i)
+  {
+    SequenceFeature feature = set->features_[i];
+    feature.setRange(feature.getBegin() + size_, feature.getEnd() + size_);
+    features_.push_back(feature);
+  }
+  size_ += set->size_;
+  indexed_ = false;
+  return true;
+}
+
+/******************************************************************************/
+
+SequenceAnnotation* SequenceFeatureSet::getPartAnnotation(size_t pos, size_t len) const
+{
+  SequenceFeatureSet* part = new SequenceFeatureSet(len, removable_);
+  vector<size_t> features;
+  getOverlappingFeatures(pos, pos + len, features);
+  sort(features.begin(), features.end()); //Keep the original order.
+  for (size_t i = 0; i < features.size(); ++i)
+  {
+    SequenceFeature feature = features_[features[i]];
+    feature.setRange(max(feature.getBegin(), pos) - pos, min(feature.getEnd(), pos + len) - pos);
+    part->addFeature(feature);
+  }
+  return part;
+}
+
+/******************************************************************************/
+
+size_t SequenceFeatureSet::addFeature(const SequenceFeature& feature)
+{
+  if (feature.getBegin() > feature.getEnd())
+    throw Exception("SequenceFeatureSet::addFeature. Begin position is after end position.");
+  if (feature.getEnd() > size_)
+    throw IndexOutOfBoundsException("SequenceFeatureSet::addFeature. Feature ends after the sequence.", feature.getEnd(), 0, size_);
+  features_.push_back(feature);
+  indexed_ = false;
+  return features_.size() - 1;
+}
+
+void SequenceFeatureSet::clear()
+{
+  features_.clear();
+  indexed_ = false;
+}
+
+/******************************************************************************/
+
+namespace
+{
+  class FeatureOrder
+  {
+    private:
+      const vector<SequenceFeature>* features_;
+
+    public:
+      FeatureOrder(const vector<SequenceFeature>& features): features_(&features) {}
+
+      bool operator()(size_t i, size_t j) const
+      {
+        const SequenceFeature& fi = (*features_)[i];
+        const SequenceFeature& fj = (*features_)[j];
+        if (fi.getBegin() != fj.getBegin()) return fi.getBegin() < fj.getBegin();
+        return fi.getEnd() < fj.getEnd();
+      }
+  };
+}
+
+void SequenceFeatureSet::buildIndex() const
+{
+  if (indexed_)
+    return;
+  size_t n = features_.size();
+  order_.resize(n);
+  for (size_t i = 0; i < n; ++i)
+    order_[i] = i;
+  stable_sort(order_.begin(), order_.end(), FeatureOrder(features_));
+  starts_.resize(n);
+  ends_.resize(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    starts_[i] = features_[order_[i]].getBegin();
+    ends_[i]   = features_[order_[i]].getEnd();
+  }
+  maxEnds_ = ends_;
+  maxLevel_ = 0;
+  if (n > 0)
+  {
+    //Leaves are at even positions, nodes of level k at positions with k trailing ones.
+    size_t lastI = 0;
+    size_t last  = 0;
+    for (size_t i = 0; i < n; i += 2)
+    {
+      lastI = i;
+      last  = ends_[i];
+    }
+    unsigned int k;
+    for (k = 1; (static_cast<size_t>(1) << k) <= n; ++k)
+    {
+      size_t x = static_cast<size_t>(1) << (k - 1);
+      size_t step = x << 2;
+      for (size_t i = (x << 1) - 1; i < n; i += step)
+      {
+        size_t el = maxEnds_[i - x];
+        size_t er = i + x < n ? maxEnds_[i + x] : last;
+        maxEnds_[i] = max(ends_[i], max(el, er));
+      }
+      //The last node of this level may lie outside of the array:
+      lastI = ((lastI >> k) & 1) ? lastI - x : lastI + x;
+      if (lastI < n && maxEnds_[lastI] > last)
+        last = maxEnds_[lastI];
+    }
+    maxLevel_ = k - 1;
+  }
+  indexed_ = true;
+}
+
+/******************************************************************************/
+
+template<class Functor>
+void SequenceFeatureSet::query_(size_t begin, size_t end, Functor& functor) const
+{
+  buildIndex();
+  size_t n = starts_.size();
+  if (n == 0)
+    return;
+  struct Node {
+    size_t x;
+    unsigned int k;
+    bool visited;
+  };
+  Node stack[64];
+  size_t t = 0;
+  Node root = { (static_cast<size_t>(1) << maxLevel_) - 1, maxLevel_, false };
+  stack[t++] = root;
+  while (t > 0)
+  {
+    Node z = stack[--t];
+    if (z.k <= 3)
+    {
+      //Small subtree, scanned linearly:
+      size_t i0 = z.x >> z.k << z.k;
+      size_t i1 = min(i0 + (static_cast<size_t>(1) << (z.k + 1)) - 1, n);
+      for (size_t i = i0; i < i1 && starts_[i] < end; ++i)
+        if (begin < ends_[i])
+          functor(order_[i]);
+    }
+    else if (!z.visited)
+    {
+      //Visit the left child first:
+      size_t y = z.x - (static_cast<size_t>(1) << (z.k - 1));
+      Node self = { z.x, z.k, true };
+      stack[t++] = self;
+      if (y >= n || maxEnds_[y] > begin)
+      {
+        Node left = { y, z.k - 1, false };
+        stack[t++] = left;
+      }
+    }
+    else if (z.x < n && starts_[z.x] < end)
+    {
+      if (begin < ends_[z.x])
+        functor(order_[z.x]);
+      Node right = { z.x + (static_cast<size_t>(1) << (z.k - 1)), z.k - 1, false };
+      stack[t++] = right;
+    }
+  }
+}
+
+/******************************************************************************/
+
+namespace
+{
+  class FeatureCollector
+  {
+    private:
+      vector<size_t>* features_;
+
+    public:
+      FeatureCollector(vector<size_t>& features): features_(&features) {}
+
+      void operator()(size_t i) { features_->push_back(i); }
+  };
+
+  class FeatureCounter
+  {
+    public:
+      size_t count;
+
+    public:
+      FeatureCounter(): count(0) {}
+
+      void operator()(size_t) { ++count; }
+  };
+}
+
+void SequenceFeatureSet::getOverlappingFeatures(size_t begin, size_t end, vector<size_t>& features) const
+{
+  features.clear();
+  FeatureCollector collector(features);
+  query_(begin, end, collector);
+}
+
+size_t SequenceFeatureSet::getNumberOfOverlappingFeatures(size_t begin, size_t end) const
+{
+  FeatureCounter counter;
+  query_(begin, end, counter);
+  return counter.count;
+}
+
+/******************************************************************************/
+
@@ -0,0 +1,262 @@
+//
+// File: SequenceFeatures.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _SEQUENCEFEATURES_H_
+#define _SEQUENCEFEATURES_H_
+
+#include "SequenceWithAnnotation.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+#include <map>
+
+namespace bpp
+{
+
+/**
+ * @brief A feature located on a sequence, as described in a GFF3 record.
+ *
+ * Coordinates are 0-based and the interval is half-open: a feature spans positions [begin, end[.
+ * The score and the phase are optional. The strand is one of '+', '-', '.' (not stranded) or '?' (unknown).
+ */
+class SequenceFeature
+{
+  private:
+    std::string sequenceId_;
+    std::string source_;
+    std::string type_;
+    size_t begin_;
+    size_t end_;
+    double score_;
+    bool hasScore_;
+    char strand_;
+    int phase_;
+    std::map<std::string, std::string> attributes_;
+
+  public:
+    SequenceFeature(const std::string& sequenceId = "", const std::string& source = "", const std::string& type = "", size_t begin = 0, size_t end = 0, char strand = '.'):
+      sequenceId_(sequenceId), source_(source), type_(type),
+      begin_(begin), end_(end), score_(0), hasScore_(false),
+      strand_(strand), phase_(-1), attributes_() {}
+
+    virtual ~SequenceFeature() {}
+
+  public:
+    const std::string& getSequenceId() const { return sequenceId_; }
+    void setSequenceId(const std::string& sequenceId) { sequenceId_ = sequenceId; }
+
+    const std::string& getSource() const { return source_; }
+    void setSource(const std::string& source) { source_ = source; }
+
+    const std::string& getType() const { return type_; }
+    void setType(const std::string& type) { type_ = type; }
+
+    size_t getBegin() const { return begin_; }
+    size_t getEnd() const { return end_; }
+    size_t size() const { return end_ - begin_; }
+
+    /**
+     * @throw Exception If begin > end.
+     */
+    void setRange(size_t begin, size_t end);
+
+    bool overlaps(size_t begin, size_t end) const { return begin_ < end && begin < end_; }
+
+    bool hasScore() const { return hasScore_; }
+    double getScore() const { return score_; }
+    void setScore(double score) { score_ = score; hasScore_ = true; }
+    void removeScore() { hasScore_ = false; }
+
+    char getStrand() const { return strand_; }
+    void setStrand(char strand) { strand_ = strand; }
+
+    /**
+     * @return The phase of a coding feature (0, 1 or 2), or -1 if undefined.
+     */
+    int getPhase() const { return phase_; }
+    void setPhase(int phase) { phase_ = phase; }
+
+    const std::map<std::string, std::string>& getAttributes() const { return attributes_; }
+    bool hasAttribute(const std::string& name) const { return attributes_.find(name) != attributes_.end(); }
+
+    /**
+     * @return The value of an attribute, or an empty string if the attribute is not set.
+     */
+    std::string getAttribute(const std::string& name) const;
+    void setAttribute(const std::string& name, const std::string& value) { attributes_[name] = value; }
+
+    /**
+     * @return The value of the ID attribute, if any.
+     */
+    std::string getId() const { return getAttribute("ID"); }
+};
+
+
+/**
+ * @brief A set of features attached to a sequence, indexed for overlap queries.
+ *
+ * Features are kept in insertion order and referred to by their index in this order.
+ * Queries use an implicit interval tree: features are sorted by start position, and each node of a
+ * balanced binary tree laid out on the sorted array stores the maximum end of its subtree. Overlap
+ * queries then take O(log n + k) for k reported features.
+ *
+ * The tree is built on the first query following a modification of the set. As a consequence, queries
+ * are not thread-safe until the index is built, which can be forced with buildIndex().
+ *
+ * As a SequenceAnnotation, the set follows the edition of the sequence it is attached to:
+ * - features after an insertion point are shifted, features spanning it are extended;
+ * - features after a deleted region are shifted, features spanning it are shortened and features
+ *   within it are removed;
+ * - replacing the whole content of the sequence removes all features.
+ */
+class SequenceFeatureSet :
+  public virtual SequenceAnnotation
+{
+  private:
+    bool removable_;
+    size_t size_;
+    std::vector<SequenceFeature> features_;
+    mutable bool indexed_;
+    mutable std::vector<size_t> order_;
+    mutable std::vector<size_t> starts_;
+    mutable std::vector<size_t> ends_;
+    mutable std::vector<size_t> maxEnds_;
+    mutable unsigned int maxLevel_;
+
+  public:
+    static const std::string FEATURES;
+
+  public:
+    /**
+     * @param size      The size of the annotated sequence.
+     * @param removable Tell if this listener can be removed by the user.
+     */
+    SequenceFeatureSet(size_t size = 0, bool removable = true):
+      removable_(removable), size_(size), features_(),
+      indexed_(false), order_(), starts_(), ends_(), maxEnds_(), maxLevel_(0) {}
+
+    virtual ~SequenceFeatureSet() {}
+
+    SequenceFeatureSet* clone() const { return new SequenceFeatureSet(*this); }
+
+  public:
+    void init(const Sequence& seq)
+    {
+      size_ = seq.size();
+      clear();
+    }
+
+    const std::string& getType() const { return FEATURES; }
+
+    bool isValidWith(const SequenceWithAnnotation& sequence, bool throwException = true) const;
+
+    bool isRemovable() const { return removable_; }
+    bool isShared() const { return false; }
+    void beforeSequenceChanged(const SymbolListEditionEvent& event) {}
+    void afterSequenceChanged(const SymbolListEditionEvent& event);
+    void beforeSequenceInserted(const SymbolListInsertionEvent& event) {}
+    void afterSequenceInserted(const SymbolListInsertionEvent& event);
+    void beforeSequenceDeleted(const SymbolListDeletionEvent& event) {}
+    void afterSequenceDeleted(const SymbolListDeletionEvent& event);
+    void beforeSequenceSubstituted(const SymbolListSubstitutionEvent& event) {}
+    void afterSequenceSubstituted(const SymbolListSubstitutionEvent& event) {}
+
+    bool merge(const SequenceAnnotation& anno);
+
+    SequenceAnnotation* getPartAnnotation(size_t pos, size_t len) const;
+
+  public:
+    /**
+     * @return The size of the annotated sequence.
+     */
+    size_t getSize() const { return size_; }
+
+    size_t getNumberOfFeatures() const { return features_.size(); }
+
+    const SequenceFeature& getFeature(size_t i) const { return features_[i]; }
+
+    /**
+     * @brief Add a feature to the set.
+     *
+     * @param feature The feature to add.
+     * @return The index of the new feature.
+     * @throw IndexOutOfBoundsException If the feature ends after the sequence.
+     */
+    size_t addFeature(const SequenceFeature& feature);
+
+    void clear();
+
+    /**
+     * @brief Build the interval tree, if not done already.
+     */
+    void buildIndex() const;
+
+    /**
+     * @brief Get all features overlapping a region.
+     *
+     * @param begin The first position of the region.
+     * @param end   The position after the last position of the region.
+     * @param features [out] The indices of the overlapping features, sorted by increasing start position.
+     */
+    void getOverlappingFeatures(size_t begin, size_t end, std::vector<size_t>& features) const;
+
+    /**
+     * @brief Get all features at a given position.
+     */
+    void getFeaturesAt(size_t pos, std::vector<size_t>& features) const
+    {
+      getOverlappingFeatures(pos, pos + 1, features);
+    }
+
+    /**
+     * @return The number of features overlapping a region.
+     */
+    size_t getNumberOfOverlappingFeatures(size_t begin, size_t end) const;
+
+  private:
+    template<class Functor>
+    void query_(size_t begin, size_t end, Functor& functor) const;
+
+};
+
+} //end of namespace bpp.
+
+#endif //_SEQUENCEFEATURES_H_
+
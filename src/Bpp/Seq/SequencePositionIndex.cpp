@@ -0,0 +1,141 @@
+//
+// File: SequencePositionIndex.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "SequencePositionIndex.h"
+#include "Alphabet/Alphabet.h"
+
+#include <Bpp/Exceptions.h>
+
+// From the STL:
+#include <algorithm>
+
+using namespace std;
+using namespace bpp;
+
+/******************************************************************************/
+
+SequencePositionIndex::SequencePositionIndex(const SymbolList& seq):
+  alignmentLength_(seq.size()),
+  numberOfResidues_(0),
+  alignmentStarts_(),
+  sequenceStarts_()
+{
+  int gap = seq.getAlphabet()->getGapCharacterCode();
+  bool inGap = true;
+  for (size_t i = 0; i < alignmentLength_; ++i)
+  {
+    if (seq[i] == gap)
+    {
+      inGap = true;
+    }
+    else
+    {
+      if (inGap)
+      {
+        alignmentStarts_.push_back(i);
+        sequenceStarts_.push_back(numberOfResidues_);
+        inGap = false;
+      }
+      ++numberOfResidues_;
+    }
+  }
+}
+
+/******************************************************************************/
+
+size_t SequencePositionIndex::findSegment_(size_t alnPos) const
+{
+  vector<size_t>::const_iterator it = upper_bound(alignmentStarts_.begin(), alignmentStarts_.end(), alnPos);
+  if (it == alignmentStarts_.begin())
+    return alignmentStarts_.size();
+  return static_cast<size_t>(it - alignmentStarts_.begin()) - 1;
+}
+
+size_t SequencePositionIndex::getSegmentLength_(size_t k) const
+{
+  return (k + 1 < sequenceStarts_.size() ? sequenceStarts_[k + 1] : numberOfResidues_) - sequenceStarts_[k];
+}
+
+/******************************************************************************/
+
+size_t SequencePositionIndex::getNumberOfResiduesBefore(size_t alnPos) const
+{
+  if (alnPos >= alignmentLength_)
+    throw IndexOutOfBoundsException("SequencePositionIndex::getNumberOfResiduesBefore.", alnPos, 0, alignmentLength_ - 1);
+  size_t k = findSegment_(alnPos);
+  if (k == alignmentStarts_.size())
+    return 0;
+  size_t length = getSegmentLength_(k);
+  return sequenceStarts_[k] + min(alnPos - alignmentStarts_[k], length);
+}
+
+bool SequencePositionIndex::isGap(size_t alnPos) const
+{
+  if (alnPos >= alignmentLength_)
+    throw IndexOutOfBoundsException("SequencePositionIndex::isGap.", alnPos, 0, alignmentLength_ - 1);
+  size_t k = findSegment_(alnPos);
+  if (k == alignmentStarts_.size())
+    return true;
+  size_t length = getSegmentLength_(k);
+  return alnPos - alignmentStarts_[k] >= length;
+}
+
+/******************************************************************************/
+
+size_t SequencePositionIndex::getAlignmentPosition(size_t seqPos) const
+{
+  if (seqPos >= numberOfResidues_)
+    throw IndexOutOfBoundsException("SequencePositionIndex::getAlignmentPosition.", seqPos, 0, numberOfResidues_ - 1);
+  size_t k = static_cast<size_t>(upper_bound(sequenceStarts_.begin(), sequenceStarts_.end(), seqPos) - sequenceStarts_.begin()) - 1;
+  return alignmentStarts_[k] + seqPos - sequenceStarts_[k];
+}
+
+size_t SequencePositionIndex::getSequencePosition(size_t alnPos) const
+{
+  if (alnPos >= alignmentLength_)
+    throw IndexOutOfBoundsException("SequencePositionIndex::getSequencePosition.", alnPos, 0, alignmentLength_ - 1);
+  size_t k = findSegment_(alnPos);
+  if (k == alignmentStarts_.size())
+    return 0;
+  size_t length = getSegmentLength_(k);
+  return sequenceStarts_[k] + min(alnPos - alignmentStarts_[k], length - 1);
+}
+
+/******************************************************************************/
+
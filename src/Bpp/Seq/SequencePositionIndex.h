@@ -0,0 +1,131 @@
+//
+// File: SequencePositionIndex.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _SEQUENCEPOSITIONINDEX_H_
+#define _SEQUENCEPOSITIONINDEX_H_
+
+#include "SymbolList.h"
+
+// From the STL:
+#include <vector>
+
+namespace bpp
+{
+
+/**
+ * @brief Map positions between an aligned sequence and the same sequence without gaps.
+ *
+ * The aligned sequence is stored as a list of ungapped segments, each one defined by its start in
+ * the alignment and in the sequence. The index is built once in linear time, and uses memory
+ * proportional to the number of gap runs. Conversions in both directions are binary searches in the
+ * segment list, that is in O(log g) for g gap runs, and hence in constant time for sequences without gaps.
+ *
+ * Coordinates are 0-based. The index does not keep a reference to the sequence and is not updated if the
+ * sequence is modified.
+ *
+ * @see SequenceWalker, SiteContainerTools::translateAlignment, SiteContainerTools::translateSequence
+ */
+class SequencePositionIndex
+{
+  private:
+    size_t alignmentLength_;
+    size_t numberOfResidues_;
+    std::vector<size_t> alignmentStarts_;
+    std::vector<size_t> sequenceStarts_;
+
+  public:
+    /**
+     * @param seq The aligned sequence to index.
+     */
+    SequencePositionIndex(const SymbolList& seq);
+
+    virtual ~SequencePositionIndex() {}
+
+  public:
+    size_t getAlignmentLength() const { return alignmentLength_; }
+
+    size_t getNumberOfResidues() const { return numberOfResidues_; }
+
+    size_t getNumberOfGaps() const { return alignmentLength_ - numberOfResidues_; }
+
+    /**
+     * @return The number of ungapped segments in the aligned sequence.
+     */
+    size_t getNumberOfSegments() const { return alignmentStarts_.size(); }
+
+    /**
+     * @return True if there is a gap at the given alignment position.
+     * @throw IndexOutOfBoundsException If the position is beyond the alignment length.
+     */
+    bool isGap(size_t alnPos) const;
+
+    /**
+     * @return The alignment position of a given sequence position.
+     * @throw IndexOutOfBoundsException If the position is beyond the number of residues.
+     */
+    size_t getAlignmentPosition(size_t seqPos) const;
+
+    /**
+     * @return The sequence position at a given alignment position.
+     * For gaps, the position of the previous residue is returned, or 0 if there is none.
+     * @throw IndexOutOfBoundsException If the position is beyond the alignment length.
+     */
+    size_t getSequencePosition(size_t alnPos) const;
+
+    /**
+     * @return The number of residues before a given alignment position, that is the sequence position
+     * of the next residue.
+     * @throw IndexOutOfBoundsException If the position is beyond the alignment length.
+     */
+    size_t getNumberOfResiduesBefore(size_t alnPos) const;
+
+  private:
+    /**
+     * @return The index of the last segment starting at or before alnPos, or the number of segments if none.
+     */
+    size_t findSegment_(size_t alnPos) const;
+
+    size_t getSegmentLength_(size_t k) const;
+
+};
+
+} //end of namespace bpp.
+
+#endif //_SEQUENCEPOSITIONINDEX_H_
+
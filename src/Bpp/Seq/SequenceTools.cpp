@@ -50,6 +50,7 @@ using namespace bpp;
 
 // From the STL:
 #include <ctype.h>
+#include <algorithm>
 #include <cmath>
 #include <list>
 #include <iostream>
@@ -65,18 +66,37 @@ NucleicAcidsReplication SequenceTools::transc_(&DNA_, &RNA_);
 
 /******************************************************************************/
 
+namespace
+{
+  // Return a pointer to the states of a sequence if they can be modified directly,
+  // or 0 if the sequence must be modified element by element, for instance
+  // because listeners must be notified of each substitution.
+  int* getWritableStates(Sequence& seq)
+  {
+    if (seq.size() == 0 || !seq.getData())
+      return 0;
+    EdSymbolList* ed = dynamic_cast<EdSymbolList*>(&seq);
+    if (ed && ed->getNumberOfListeners() > 0)
+      return 0;
+    return &seq[0];
+  }
+}
+
+/******************************************************************************/
+
 bool SequenceTools::areSequencesIdentical(const Sequence& seq1, const Sequence& seq2)
 {
   // Site's size and content checking
-  if (seq1.getAlphabet()->getAlphabetType() != seq2.getAlphabet()->getAlphabetType())
+  if (seq1.getAlphabet()->getAlphabetTypeId() != seq2.getAlphabet()->getAlphabetTypeId())
     return false;
   if (seq1.size() != seq2.size())
     return false;
   else
   {
+    SymbolListSpan s1(seq1), s2(seq2);
     for (size_t i = 0; i < seq1.size(); i++)
     {
-      if (seq1[i] != seq2[i])
+      if (s1[i] != s2[i])
         return false;
     }
     return true;
@@ -88,7 +108,7 @@ bool SequenceTools::areSequencesIdentical(const Sequence& seq1, const Sequence&
 Sequence* SequenceTools::concatenate(const Sequence& seq1, const Sequence& seq2)
 {
   // Sequence's alphabets matching verification
-  if ((seq1.getAlphabet()->getAlphabetType()) != (seq2.getAlphabet()->getAlphabetType()))
+  if ((seq1.getAlphabet()->getAlphabetTypeId()) != (seq2.getAlphabet()->getAlphabetTypeId()))
     throw AlphabetMismatchException("SequenceTools::concatenate : Sequence's alphabets don't match ", seq1.getAlphabet(), seq2.getAlphabet());
 
   // Sequence's names matching verification
@@ -121,6 +141,12 @@ Sequence& SequenceTools::complement(Sequence& seq)
   {
     throw AlphabetException("SequenceTools::complement: Sequence must be nucleic.", seq.getAlphabet());
   }
+  int* states = getWritableStates(seq);
+  if (states)
+  {
+    NAR->translate(states, states + seq.size());
+    return seq;
+  }
   for (size_t i = 0; i < seq.size(); i++)
   {
     seq.setElement(i, NAR->translate(seq.getValue(i)));
@@ -180,6 +206,12 @@ Sequence* SequenceTools::reverseTranscript(const Sequence& sequence)
 
 Sequence& SequenceTools::invert(Sequence& seq)
 {
+  int* states = getWritableStates(seq);
+  if (states)
+  {
+    std::reverse(states, states + seq.size());
+    return seq;
+  }
   size_t seq_size = seq.size(); // store seq size for efficiency
   int tmp_state = 0; // to store one state when swapping positions
   size_t j = seq_size; // symetric position iterator from sequence end
@@ -220,6 +252,12 @@ Sequence& SequenceTools::invertComplement(Sequence& seq)
   {
     throw AlphabetException("SequenceTools::invertComplement: Sequence must be nucleic.", seq.getAlphabet());
   }
+  int* states = getWritableStates(seq);
+  if (states)
+  {
+    NAR->translateAndInvert(states, states + seq.size());
+    return seq;
+  }
   // for (size_t i = 0 ; i < seq.size() ; i++) {
   //  seq.setElement(i, NAR->translate(seq.getValue(i)));
   // }
@@ -242,19 +280,37 @@ Sequence& SequenceTools::invertComplement(Sequence& seq)
 
 /******************************************************************************/
 
+Sequence* SequenceTools::getInvertComplement(const Sequence& sequence)
+{
+  Sequence* icSeq = sequence.clone();
+  try
+  {
+    invertComplement(*icSeq);
+  }
+  catch (...)
+  {
+    delete icSeq;
+    throw;
+  }
+  return icSeq;
+}
+
+/******************************************************************************/
+
 double SequenceTools::getPercentIdentity(const Sequence& seq1, const Sequence& seq2, bool ignoreGaps)
 {
-  if (seq1.getAlphabet()->getAlphabetType() != seq2.getAlphabet()->getAlphabetType())
+  if (seq1.getAlphabet()->getAlphabetTypeId() != seq2.getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SequenceTools::getPercentIdentity", seq1.getAlphabet(), seq2.getAlphabet());
   if (seq1.size() != seq2.size())
     throw SequenceNotAlignedException("SequenceTools::getPercentIdentity", &seq2);
   int gap = seq1.getAlphabet()->getGapCharacterCode();
   size_t id = 0;
   size_t tot = 0;
+  SymbolListSpan s1(seq1), s2(seq2);
   for (size_t i = 0; i < seq1.size(); i++)
   {
-    int x = seq1.getValue(i);
-    int y = seq2.getValue(i);
+    int x = s1[i];
+    int y = s2[i];
     if (ignoreGaps)
     {
       if (x != gap && y != gap)
@@ -280,9 +336,10 @@ size_t SequenceTools::getNumberOfSites(const Sequence& seq)
 {
   size_t count = 0;
   const Alphabet* alpha = seq.getAlphabet();
+  SymbolListSpan s(seq);
   for (size_t i = 0; i < seq.size(); i++)
   {
-    if (!alpha->isGap(seq[i]))
+    if (!alpha->isGap(s[i]))
       count++;
   }
   return count;
@@ -294,9 +351,10 @@ size_t SequenceTools::getNumberOfCompleteSites(const Sequence& seq)
 {
   size_t count = 0;
   const Alphabet* alpha = seq.getAlphabet();
+  SymbolListSpan s(seq);
   for (size_t i = 0; i < seq.size(); i++)
   {
-    if (!alpha->isGap(seq[i]) && !alpha->isUnresolved(seq[i]))
+    if (!alpha->isGap(s[i]) && !alpha->isUnresolved(s[i]))
       count++;
   }
   return count;
@@ -307,11 +365,12 @@ size_t SequenceTools::getNumberOfCompleteSites(const Sequence& seq)
 Sequence* SequenceTools::getSequenceWithCompleteSites(const Sequence& seq)
 {
   const Alphabet* alpha = seq.getAlphabet();
+  SymbolListSpan s(seq);
   vector<int> content;
   for (size_t i = 0; i < seq.size(); i++)
   {
-    if (!(alpha->isGap(seq[i]) || alpha->isUnresolved(seq[i])))
-      content.push_back(seq[i]);
+    if (!(alpha->isGap(s[i]) || alpha->isUnresolved(s[i])))
+      content.push_back(s[i]);
   }
   Sequence* newSeq = dynamic_cast<Sequence*>(seq.clone());
   newSeq->setContent(content);
@@ -324,9 +383,10 @@ size_t SequenceTools::getNumberOfUnresolvedSites(const Sequence& seq)
 {
   size_t count = 0;
   const Alphabet* alpha = seq.getAlphabet();
+  SymbolListSpan s(seq);
   for (size_t i = 0; i < seq.size(); i++)
   {
-    if (alpha->isUnresolved(seq[i]))
+    if (alpha->isUnresolved(s[i]))
       count++;
   }
   return count;
@@ -337,11 +397,12 @@ size_t SequenceTools::getNumberOfUnresolvedSites(const Sequence& seq)
 Sequence* SequenceTools::getSequenceWithoutGaps(const Sequence& seq)
 {
   const Alphabet* alpha = seq.getAlphabet();
+  SymbolListSpan s(seq);
   vector<int> content;
   for (size_t i = 0; i < seq.size(); i++)
   {
-    if (!alpha->isGap(seq[i]))
-      content.push_back(seq[i]);
+    if (!alpha->isGap(s[i]))
+      content.push_back(s[i]);
   }
   Sequence* newSeq = dynamic_cast<Sequence*>(seq.clone());
   newSeq->setContent(content);
@@ -420,10 +481,11 @@ BowkerTest* SequenceTools::bowkerTest(const Sequence& seq1, const Sequence& seq2
   // Compute contingency table:
   RowMatrix<double> array(r, r);
   int x, y;
+  SymbolListSpan s1(seq1), s2(seq2);
   for (size_t i = 0; i < n; i++)
   {
-    x = seq1[i];
-    y = seq2[i];
+    x = s1[i];
+    y = s2[i];
     if (!alpha->isGap(x) && !alpha->isUnresolved(x)
         && !alpha->isGap(y) && !alpha->isUnresolved(y))
     {
@@ -516,7 +578,7 @@ void SequenceTools::getPutativeHaplotypes(const Sequence& seq, std::vector<Seque
 
 Sequence* SequenceTools::combineSequences(const Sequence& s1, const Sequence& s2)
 {
-  if (s1.getAlphabet()->getAlphabetType() != s2.getAlphabet()->getAlphabetType())
+  if (s1.getAlphabet()->getAlphabetTypeId() != s2.getAlphabet()->getAlphabetTypeId())
   {
     throw AlphabetMismatchException("SequenceTools::combineSequences(const Sequence& s1, const Sequence& s2): s1 and s2 don't have same Alphabet.", s1.getAlphabet(), s2.getAlphabet());
   }
@@ -588,6 +650,8 @@ Sequence* SequenceTools::RNYslice(const Sequence& seq, int ph)
   size_t n = (s - static_cast<size_t>(ph) + 3) / 3;
 
   vector<int> content(n);
+  SymbolListSpan states(seq);
+  const Alphabet& alpha = *seq.getAlphabet();
 
   int tir = seq.getAlphabet()->getGapCharacterCode();
   size_t j;
@@ -597,13 +661,13 @@ Sequence* SequenceTools::RNYslice(const Sequence& seq, int ph)
     j = i * 3 + static_cast<size_t>(ph) - 1;
 
     if (j == 0)
-      content[i] = RNY_.getRNY(tir, seq[0], seq[1], *seq.getAlphabet());
+      content[i] = RNY_.getRNY(tir, states[0], states[1], alpha);
     else
     {
       if (j == s - 1)
-        content[i] = RNY_.getRNY(seq[j - 1], seq[j], tir, *seq.getAlphabet());
+        content[i] = RNY_.getRNY(states[j - 1], states[j], tir, alpha);
       else
-        content[i] = RNY_.getRNY(seq[j - 1], seq[j], seq[j + 1], *seq.getAlphabet());
+        content[i] = RNY_.getRNY(states[j - 1], states[j], states[j + 1], alpha);
     }
   }
 
@@ -626,20 +690,21 @@ Sequence* SequenceTools::RNYslice(const Sequence& seq)
   size_t n = seq.size();
 
   vector<int> content(n);
+  SymbolListSpan states(seq);
+  const Alphabet& alpha = *seq.getAlphabet();
 
   int tir = seq.getAlphabet()->getGapCharacterCode();
 
   if (seq.size() >= 2)
   {
-    content[0] = RNY_.getRNY(tir, seq[0], seq[1], *seq.getAlphabet());
+    content[0] = RNY_.getRNY(tir, states[0], states[1], alpha);
 
     for (unsigned int i = 1; i < n - 1; i++)
     {
-      content[i] = RNY_.getRNY(seq[i - 1], seq[i], seq[i + 1],
-                               *seq.getAlphabet());
+      content[i] = RNY_.getRNY(states[i - 1], states[i], states[i + 1], alpha);
     }
 
-    content[n - 1] = RNY_.getRNY(seq[n - 2], seq[n - 1], tir, *seq.getAlphabet());
+    content[n - 1] = RNY_.getRNY(states[n - 2], states[n - 1], tir, alpha);
   }
 
   // New sequence creating, and sense reversing
@@ -686,6 +751,7 @@ size_t SequenceTools::findFirstOf(const Sequence& seq, const Sequence& motif, bo
 {
   if (motif.size() > seq.size())
     return seq.size();
+  SymbolListSpan s(seq), m(motif);
   for (size_t seqi = 0; seqi < seq.size() - motif.size() + 1; seqi++)
   {
     bool match = false;
@@ -693,11 +759,11 @@ size_t SequenceTools::findFirstOf(const Sequence& seq, const Sequence& motif, bo
     {
       if (strict)
       {
-        match = seq.getValue(seqi + moti) == motif.getValue(moti);
+        match = s[seqi + moti] == m[moti];
       }
       else
       {
-        match = AlphabetTools::match(seq.getAlphabet(), seq.getValue(seqi + moti), motif.getValue(moti));
+        match = AlphabetTools::match(seq.getAlphabet(), s[seqi + moti], m[moti]);
       }
       if (!match)
       {
@@ -247,6 +247,16 @@ public:
    */
   static Sequence& invertComplement(Sequence& seq);
 
+  /**
+   * @brief Get the reverse complement of a sequence.
+   *
+   * @param sequence The sequence to inverse and complement.
+   * @return A new sequence object, of the same type as the input one.
+   * @throw AlphabetException if the sequence is not a nucleotide sequence.
+   * @see invertComplement
+   */
+  static Sequence* getInvertComplement(const Sequence& sequence);
+
   /**
    * @return The identity percent of 2 sequence.
    * One match is counted if the two sequences have identical states.
@@ -371,6 +381,9 @@ public:
    * For instance if level = 3 and Alphabet is DNA, all generic char will be
    * resolved but N.
    *
+   * All haplotypes are stored in memory, and their number grows exponentially with
+   * the number of heterozygous sites. Use HaplotypeIterator to enumerate them one at a time.
+   *
    * @author Sylvain Gaillard
    */
   static void getPutativeHaplotypes(const Sequence& seq, std::vector<Sequence*>& hap, unsigned int level = 2);
@@ -41,6 +41,7 @@ knowledge of the CeCILL license and that you accept its terms.
 #define _SEQUENCEWALKER_H_
 
 #include "Sequence.h"
+#include "SequencePositionIndex.h"
 
 namespace bpp
 {
@@ -49,37 +50,23 @@ namespace bpp
  * @brief A helper class to easily convert coordinates between sequence and alignments.
  *
  * Coordinates are 0-based.
- * The walker will be more efficient if coordinates are called in pre-ordered way.
+ * Positions are looked up in a SequencePositionIndex built at construction, so that
+ * coordinates can be called in any order at the same cost.
  */
 class SequenceWalker
 {
   private:
-    const Sequence* seq_;
-    size_t seqPos_, alnPos_;
-    int gap_;
+    SequencePositionIndex index_;
 
   public:
-    SequenceWalker(const Sequence& seq):
-      seq_(&seq), seqPos_(0), alnPos_(0), gap_(seq.getAlphabet()->getGapCharacterCode()) {
-      if (seq_->size() > 0) {
-        while ((*seq_)[alnPos_] == gap_)
-          ++alnPos_;
-      }
-    }
-    SequenceWalker(const SequenceWalker& walker):
-      seq_(walker.seq_), seqPos_(walker.seqPos_), alnPos_(walker.alnPos_), gap_(walker.gap_) {}
-    SequenceWalker& operator=(const SequenceWalker& walker) {
-      seq_    = walker.seq_;
-      seqPos_ = walker.seqPos_;
-      alnPos_ = walker.alnPos_;
-      gap_    = walker.gap_;
-      return *this;
-    }
+    SequenceWalker(const Sequence& seq): index_(seq) {}
     virtual ~SequenceWalker() {}
 
   public:
-    size_t getAlignmentPosition(size_t seqPos);
-    size_t getSequencePosition(size_t alnPos);
+    size_t getAlignmentPosition(size_t seqPos) const;
+    size_t getSequencePosition(size_t alnPos) const;
+
+    const SequencePositionIndex& getIndex() const { return index_; }
 };
 
 } //end of namespace bpp.
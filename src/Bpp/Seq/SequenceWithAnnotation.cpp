@@ -199,7 +199,7 @@ void SequenceWithAnnotation::setToSizeL(size_t newSize)
 
 void SequenceWithAnnotation::append(const Sequence& seq)
 {
-  if (seq.getAlphabet()->getAlphabetType() != getAlphabet()->getAlphabetType())
+  if (seq.getAlphabet()->getAlphabetTypeId() != getAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("SequenceWithAnnotation::append");
   SymbolListInsertionEvent event(this, content_.size(), seq.size());
   fireBeforeSequenceInserted(event);
@@ -263,7 +263,7 @@ vector<string> SequenceWithAnnotation::getAnnotationTypes() const
 void SequenceWithAnnotation::merge(const SequenceWithAnnotation& swa)
 {
   // Sequence's alphabets matching verification
-	if ((swa.getAlphabet()->getAlphabetType()) != (getAlphabet()->getAlphabetType())) 
+	if ((swa.getAlphabet()->getAlphabetTypeId()) != (getAlphabet()->getAlphabetTypeId())) 
 		throw AlphabetMismatchException("SequenceWithAnnotation::merge: Sequence's alphabets don't match ", swa.getAlphabet(), getAlphabet());
 	
 	// Sequence's names matching verification
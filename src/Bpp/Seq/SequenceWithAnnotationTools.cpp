@@ -40,6 +40,10 @@ knowledge of the CeCILL license and that you accept its terms.
 #include "SequenceWithAnnotationTools.h"
 #include "Alphabet/CaseMaskedAlphabet.h"
 
+// From the STL:
+#include <algorithm>
+#include <cctype>
+
 using namespace bpp;
 using namespace std;
 
@@ -71,6 +75,280 @@ void SequenceMask::afterSequenceDeleted(const SymbolListDeletionEvent& event)
 
 /******************************************************************************/
 
+const string RunLengthSequenceMask::RUN_LENGTH_MASK = "Run-length mask";
+
+/******************************************************************************/
+
+RunLengthSequenceMask::RunLengthSequenceMask(const vector<bool>& mask, bool removable) :
+  removable_(removable),
+  size_(mask.size()),
+  begins_(),
+  ends_()
+{
+  size_t i = 0;
+  while (i < mask.size())
+  {
+    if (mask[i])
+    {
+      size_t begin = i;
+      while (i < mask.size() && mask[i]) ++i;
+      appendRun_(begin, i);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+}
+
+/******************************************************************************/
+
+void RunLengthSequenceMask::appendRun_(size_t begin, size_t end)
+{
+  if (begin >= end)
+    return;
+  if (!ends_.empty() && ends_.back() >= begin)
+  {
+    ends_.back() = max(ends_.back(), end);
+  }
+  else
+  {
+    begins_.push_back(begin);
+    ends_.push_back(end);
+  }
+}
+
+/******************************************************************************/
+
+bool RunLengthSequenceMask::operator[](size_t i) const
+{
+  //First run ending after i:
+  size_t k = static_cast<size_t>(upper_bound(ends_.begin(), ends_.end(), i) - ends_.begin());
+  return k < begins_.size() && begins_[k] <= i;
+}
+
+size_t RunLengthSequenceMask::getNumberOfMaskedPositions() const
+{
+  size_t n = 0;
+  for (size_t i = 0; i < begins_.size(); ++i)
+    n += ends_[i] - begins_[i];
+  return n;
+}
+
+vector<bool> RunLengthSequenceMask::getMask() const
+{
+  vector<bool> mask(size_, false);
+  for (size_t i = 0; i < begins_.size(); ++i)
+    fill(mask.begin() + static_cast<ptrdiff_t>(begins_[i]), mask.begin() + static_cast<ptrdiff_t>(ends_[i]), true);
+  return mask;
+}
+
+/******************************************************************************/
+
+void RunLengthSequenceMask::setMask(size_t begin, size_t end, bool mask)
+{
+  if (end > size_)
+    throw IndexOutOfBoundsException("RunLengthSequenceMask::setMask.", end, 0, size_);
+  if (begin >= end)
+    return;
+  if (mask)
+  {
+    if (ends_.empty() || ends_.back() <= begin)
+    {
+      appendRun_(begin, end);
+      return;
+    }
+    //Runs touching [begin, end[ are merged:
+    size_t i = static_cast<size_t>(lower_bound(ends_.begin(), ends_.end(), begin) - ends_.begin());
+    size_t j = static_cast<size_t>(upper_bound(begins_.begin(), begins_.end(), end) - begins_.begin());
+    if (i < j)
+    {
+      begin = min(begin, begins_[i]);
+      end = max(end, ends_[j - 1]);
+      begins_.erase(begins_.begin() + static_cast<ptrdiff_t>(i), begins_.begin() + static_cast<ptrdiff_t>(j));
+      ends_.erase(ends_.begin() + static_cast<ptrdiff_t>(i), ends_.begin() + static_cast<ptrdiff_t>(j));
+    }
+    begins_.insert(begins_.begin() + static_cast<ptrdiff_t>(i), begin);
+    ends_.insert(ends_.begin() + static_cast<ptrdiff_t>(i), end);
+  }
+  else
+  {
+    //Runs overlapping [begin, end[ are cut:
+    size_t i = static_cast<size_t>(upper_bound(ends_.begin(), ends_.end(), begin) - ends_.begin());
+    size_t j = static_cast<size_t>(lower_bound(begins_.begin(), begins_.end(), end) - begins_.begin());
+    if (i >= j)
+      return;
+    vector<size_t> newBegins, newEnds;
+    if (begins_[i] < begin)
+    {
+      newBegins.push_back(begins_[i]);
+      newEnds.push_back(begin);
+    }
+    if (ends_[j - 1] > end)
+    {
+      newBegins.push_back(end);
+      newEnds.push_back(ends_[j - 1]);
+    }
+    begins_.erase(begins_.begin() + static_cast<ptrdiff_t>(i), begins_.begin() + static_cast<ptrdiff_t>(j));
+    ends_.erase(ends_.begin() + static_cast<ptrdiff_t>(i), ends_.begin() + static_cast<ptrdiff_t>(j));
+    begins_.insert(begins_.begin() + static_cast<ptrdiff_t>(i), newBegins.begin(), newBegins.end());
+    ends_.insert(ends_.begin() + static_cast<ptrdiff_t>(i), newEnds.begin(), newEnds.end());
+  }
+}
+
+/******************************************************************************/
+
+void RunLengthSequenceMask::complement()
+{
+  vector<size_t> begins, ends;
+  size_t pos = 0;
+  for (size_t i = 0; i < begins_.size(); ++i)
+  {
+    if (begins_[i] > pos)
+    {
+      begins.push_back(pos);
+      ends.push_back(begins_[i]);
+    }
+    pos = ends_[i];
+  }
+  if (pos < size_)
+  {
+    begins.push_back(pos);
+    ends.push_back(size_);
+  }
+  begins_.swap(begins);
+  ends_.swap(ends);
+}
+
+void RunLengthSequenceMask::unionWith(const RunLengthSequenceMask& mask)
+{
+  if (mask.size_ != size_)
+    throw DimensionException("RunLengthSequenceMask::unionWith. Masks have different sizes.", mask.size_, size_);
+  RunLengthSequenceMask result(size_, removable_);
+  size_t i = 0, j = 0;
+  while (i < begins_.size() || j < mask.begins_.size())
+  {
+    //Take the run starting first:
+    if (j == mask.begins_.size() || (i < begins_.size() && begins_[i] <= mask.begins_[j]))
+    {
+      result.appendRun_(begins_[i], ends_[i]);
+      ++i;
+    }
+    else
+    {
+      result.appendRun_(mask.begins_[j], mask.ends_[j]);
+      ++j;
+    }
+  }
+  begins_.swap(result.begins_);
+  ends_.swap(result.ends_);
+}
+
+void RunLengthSequenceMask::intersectWith(const RunLengthSequenceMask& mask)
+{
+  if (mask.size_ != size_)
+    throw DimensionException("RunLengthSequenceMask::intersectWith. Masks have different sizes.", mask.size_, size_);
+  RunLengthSequenceMask result(size_, removable_);
+  size_t i = 0, j = 0;
+  while (i < begins_.size() && j < mask.begins_.size())
+  {
+    result.appendRun_(max(begins_[i], mask.begins_[j]), min(ends_[i], mask.ends_[j]));
+    //Move past the run ending first:
+    if (ends_[i] < mask.ends_[j])
+      ++i;
+    else
+      ++j;
+  }
+  begins_.swap(result.begins_);
+  ends_.swap(result.ends_);
+}
+
+/******************************************************************************/
+
+void RunLengthSequenceMask::afterSequenceChanged(const SymbolListEditionEvent& event)
+{
+  size_ = event.getSymbolList()->size();
+  begins_.clear();
+  ends_.clear();
+}
+
+/******************************************************************************/
+
+void RunLengthSequenceMask::afterSequenceInserted(const SymbolListInsertionEvent& event)
+{
+  size_t pos = event.getPosition();
+  size_t len = event.getLength();
+  vector<size_t> begins, ends;
+  for (size_t i = 0; i < begins_.size(); ++i)
+  {
+    if (ends_[i] <= pos)
+    {
+      begins.push_back(begins_[i]);
+      ends.push_back(ends_[i]);
+    }
+    else if (begins_[i] >= pos)
+    {
+      begins.push_back(begins_[i] + len);
+      ends.push_back(ends_[i] + len);
+    }
+    else
+    {
+      //Inserted positions are not masked:
+      begins.push_back(begins_[i]);
+      ends.push_back(pos);
+      begins.push_back(pos + len);
+      ends.push_back(ends_[i] + len);
+    }
+  }
+  begins_.swap(begins);
+  ends_.swap(ends);
+  size_ += len;
+}
+
+/******************************************************************************/
+
+void RunLengthSequenceMask::afterSequenceDeleted(const SymbolListDeletionEvent& event)
+{
+  size_t pos = event.getPosition();
+  size_t len = event.getLength();
+  RunLengthSequenceMask result(size_ - len, removable_);
+  for (size_t i = 0; i < begins_.size(); ++i)
+  {
+    size_t begin = begins_[i] < pos ? begins_[i] : (begins_[i] >= pos + len ? begins_[i] - len : pos);
+    size_t end   = ends_[i] <= pos ? ends_[i] : (ends_[i] >= pos + len ? ends_[i] - len : pos);
+    result.appendRun_(begin, end);
+  }
+  begins_.swap(result.begins_);
+  ends_.swap(result.ends_);
+  size_ -= len;
+}
+
+/******************************************************************************/
+
+bool RunLengthSequenceMask::merge(const SequenceAnnotation& anno)
+{
+  const RunLengthSequenceMask* mask = dynamic_cast<const RunLengthSequenceMask*>(&anno);
+  if (!mask)
+    return false;
+  for (size_t i = 0; i < mask->begins_.size(); ++i)
+    appendRun_(mask->begins_[i] + size_, mask->ends_[i] + size_);
+  size_ += mask->size_;
+  return true;
+}
+
+/******************************************************************************/
+
+SequenceAnnotation* RunLengthSequenceMask::getPartAnnotation(size_t pos, size_t len) const
+{
+  RunLengthSequenceMask* part = new RunLengthSequenceMask(len, removable_);
+  size_t i = static_cast<size_t>(upper_bound(ends_.begin(), ends_.end(), pos) - ends_.begin());
+  for (; i < begins_.size() && begins_[i] < pos + len; ++i)
+    part->appendRun_(max(begins_[i], pos) - pos, min(ends_[i], pos + len) - pos);
+  return part;
+}
+
+/******************************************************************************/
+
 SequenceWithAnnotation* SequenceWithAnnotationTools::createMaskAnnotation(const Sequence& seq)
 {
   const CaseMaskedAlphabet* cma = dynamic_cast<const CaseMaskedAlphabet*>(seq.getAlphabet());
@@ -89,3 +367,84 @@ SequenceWithAnnotation* SequenceWithAnnotationTools::createMaskAnnotation(const
 
 /******************************************************************************/
 
+RunLengthSequenceMask* SequenceWithAnnotationTools::getMaskRuns(const string& sequence)
+{
+  RunLengthSequenceMask* mask = new RunLengthSequenceMask(sequence.size());
+  size_t i = 0;
+  while (i < sequence.size())
+  {
+    if (islower(static_cast<unsigned char>(sequence[i])))
+    {
+      size_t begin = i;
+      while (i < sequence.size() && islower(static_cast<unsigned char>(sequence[i]))) ++i;
+      mask->setMask(begin, i, true);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+  return mask;
+}
+
+/******************************************************************************/
+
+RunLengthSequenceMask* SequenceWithAnnotationTools::getMaskRuns(const Sequence& seq)
+{
+  const CaseMaskedAlphabet* cma = dynamic_cast<const CaseMaskedAlphabet*>(seq.getAlphabet());
+  if (!cma)
+    throw AlphabetException("SequenceWithAnnotationTools::getMaskRuns. Alphabet should be a CaseMaskedAlphabet.", seq.getAlphabet());
+  RunLengthSequenceMask* mask = new RunLengthSequenceMask(seq.size());
+  size_t i = 0;
+  while (i < seq.size())
+  {
+    if (cma->isMasked(seq[i]))
+    {
+      size_t begin = i;
+      while (i < seq.size() && cma->isMasked(seq[i])) ++i;
+      mask->setMask(begin, i, true);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+  return mask;
+}
+
+/******************************************************************************/
+
+Sequence* SequenceWithAnnotationTools::applyMask(const Sequence& seq, const RunLengthSequenceMask& mask, const CaseMaskedAlphabet* alphabet)
+{
+  if (seq.getAlphabet()->getAlphabetTypeId() != alphabet->getUnmaskedAlphabet()->getAlphabetTypeId())
+    throw AlphabetMismatchException("SequenceWithAnnotationTools::applyMask.", seq.getAlphabet(), alphabet->getUnmaskedAlphabet());
+  if (seq.size() != mask.getSize())
+    throw DimensionException("SequenceWithAnnotationTools::applyMask. Mask and sequence have different sizes.", mask.getSize(), seq.size());
+  //Unmasked states have the same codes in both alphabets:
+  vector<int> content(seq.size());
+  for (size_t i = 0; i < seq.size(); ++i)
+    content[i] = seq[i];
+  for (size_t r = 0; r < mask.getNumberOfRuns(); ++r)
+    for (size_t i = mask.getRunBegin(r); i < mask.getRunEnd(r); ++i)
+      if (!alphabet->isGap(content[i]))
+        content[i] = alphabet->getMaskedEquivalentState(content[i]);
+  return new BasicSequence(seq.getName(), content, seq.getComments(), alphabet);
+}
+
+/******************************************************************************/
+
+string SequenceWithAnnotationTools::toSoftMaskedString(const Sequence& seq, const RunLengthSequenceMask& mask)
+{
+  if (seq.size() != mask.getSize())
+    throw DimensionException("SequenceWithAnnotationTools::toSoftMaskedString. Mask and sequence have different sizes.", mask.getSize(), seq.size());
+  string str = seq.toString();
+  if (str.size() != seq.size())
+    throw Exception("SequenceWithAnnotationTools::toSoftMaskedString. Only alphabets with one character per state are supported.");
+  for (size_t r = 0; r < mask.getNumberOfRuns(); ++r)
+    for (size_t i = mask.getRunBegin(r); i < mask.getRunEnd(r); ++i)
+      str[i] = static_cast<char>(tolower(str[i]));
+  return str;
+}
+
+/******************************************************************************/
+
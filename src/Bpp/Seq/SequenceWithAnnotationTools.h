@@ -42,6 +42,7 @@ knowledge of the CeCILL license and that you accept its terms.
 
 #include "SequenceTools.h"
 #include "SequenceWithAnnotation.h"
+#include "Alphabet/CaseMaskedAlphabet.h"
 #include <Bpp/Numeric/VectorTools.h>
 
 #include <cstddef>
@@ -176,6 +177,134 @@ namespace bpp {
       }
   };
   
+  /**
+   * @brief A sequence mask stored as a list of masked intervals.
+   *
+   * Masked positions are stored as sorted, disjoint and non-adjacent half-open runs [begin, end[,
+   * so that memory and most operations scale with the number of runs rather than with the sequence length.
+   * This is well suited for repeat-masked genomes, where masked positions come in long runs.
+   * Look-up of a position takes O(log r) for r runs, union, intersection and complement take O(r).
+   *
+   * As for SequenceMask, inserted positions are not masked, and replacing the whole content of the
+   * sequence removes the mask.
+   *
+   * @see SequenceMask, SequenceWithAnnotationTools::getMaskRuns
+   */
+  class RunLengthSequenceMask :
+    public virtual SequenceAnnotation
+  {
+    private:
+      bool removable_;
+      size_t size_;
+      std::vector<size_t> begins_;
+      std::vector<size_t> ends_;
+
+    public:
+      static const std::string RUN_LENGTH_MASK;
+
+    public:
+      /**
+       * @brief Build a new mask with no masked position.
+       *
+       * @param size The size of the sequence.
+       * @param removable Tell if this listener can be removed by the user.
+       */
+      RunLengthSequenceMask(size_t size = 0, bool removable = true) :
+        removable_(removable),
+        size_(size),
+        begins_(),
+        ends_()
+      {}
+
+      /**
+       * @brief Build a new mask from a vector of bool.
+       *
+       * @param mask The boolean mask
+       * @param removable Tell if this listener can be removed by the user.
+       */
+      RunLengthSequenceMask(const std::vector<bool>& mask, bool removable = true);
+
+      virtual ~RunLengthSequenceMask() {}
+
+      RunLengthSequenceMask* clone() const { return new RunLengthSequenceMask(*this); }
+
+    public:
+      void init(const Sequence& seq)
+      {
+        size_ = seq.size();
+        begins_.clear();
+        ends_.clear();
+      }
+
+      const std::string& getType() const { return RUN_LENGTH_MASK; }
+
+      bool isValidWith(const SequenceWithAnnotation& sequence, bool throwException = true) const
+      {
+        if (throwException && size_ != sequence.size()) throw Exception("RunLengthSequenceMask. The mask size must match the sequence size.");
+        return (size_ == sequence.size());
+      }
+
+      bool isRemovable() const { return removable_; }
+      bool isShared() const { return false; }
+      void beforeSequenceChanged(const SymbolListEditionEvent& event) {}
+      void afterSequenceChanged(const SymbolListEditionEvent& event);
+      void beforeSequenceInserted(const SymbolListInsertionEvent& event) {}
+      void afterSequenceInserted(const SymbolListInsertionEvent& event);
+      void beforeSequenceDeleted(const SymbolListDeletionEvent& event) {}
+      void afterSequenceDeleted(const SymbolListDeletionEvent& event);
+      void beforeSequenceSubstituted(const SymbolListSubstitutionEvent& event) {}
+      void afterSequenceSubstituted(const SymbolListSubstitutionEvent& event) {}
+
+      size_t getSize() const { return size_; }
+
+      bool operator[](size_t i) const;
+
+      size_t getNumberOfRuns() const { return begins_.size(); }
+      size_t getRunBegin(size_t i) const { return begins_[i]; }
+      size_t getRunEnd(size_t i) const { return ends_[i]; }
+
+      size_t getNumberOfMaskedPositions() const;
+
+      /**
+       * @brief Mask or unmask all positions in [begin, end[.
+       *
+       * Runs are appended in constant time when set in increasing order.
+       * @throw IndexOutOfBoundsException If end is beyond the sequence size.
+       */
+      void setMask(size_t begin, size_t end, bool mask);
+
+      void setMask(size_t pos, bool mask) { setMask(pos, pos + 1, mask); }
+
+      /**
+       * @return The mask as a vector.
+       */
+      std::vector<bool> getMask() const;
+
+      /**
+       * @brief Mask all unmasked positions and unmask all masked ones.
+       */
+      void complement();
+
+      /**
+       * @brief Mask all positions masked in this mask or in another one.
+       * @throw DimensionException If the two masks do not have the same size.
+       */
+      void unionWith(const RunLengthSequenceMask& mask);
+
+      /**
+       * @brief Unmask all positions not masked in another mask.
+       * @throw DimensionException If the two masks do not have the same size.
+       */
+      void intersectWith(const RunLengthSequenceMask& mask);
+
+      bool merge(const SequenceAnnotation& anno);
+
+      SequenceAnnotation* getPartAnnotation(size_t pos, size_t len) const;
+
+    private:
+      void appendRun_(size_t begin, size_t end);
+  };
+
   /**
    * @brief The SequenceWithAnnotationTools static class
    *
@@ -196,6 +325,43 @@ namespace bpp {
        */
       SequenceWithAnnotation* createMaskAnnotation(const Sequence& seq);
 
+      /**
+       * @brief Get the runs of lower case characters in a soft-masked sequence.
+       *
+       * @param sequence The sequence as a string, masked positions in lower case.
+       * @return A new RunLengthSequenceMask object.
+       */
+      static RunLengthSequenceMask* getMaskRuns(const std::string& sequence);
+
+      /**
+       * @brief Get the runs of masked states in a sequence with a CaseMaskedAlphabet.
+       *
+       * @param seq The sequence to parse.
+       * @return A new RunLengthSequenceMask object.
+       * @throw AlphabetException if the input sequence does not have a CaseMaskedAlphabet.
+       */
+      static RunLengthSequenceMask* getMaskRuns(const Sequence& seq);
+
+      /**
+       * @brief Create a sequence with a CaseMaskedAlphabet from an unmasked sequence and a mask.
+       *
+       * @param seq The sequence to mask, with the unmasked alphabet of the CaseMaskedAlphabet.
+       * @param mask The mask to apply.
+       * @param alphabet The CaseMaskedAlphabet of the new sequence.
+       * @return A new Sequence object.
+       * @throw AlphabetMismatchException if the sequence alphabet is not the unmasked one.
+       * @throw DimensionException if the mask and the sequence have different sizes.
+       */
+      static Sequence* applyMask(const Sequence& seq, const RunLengthSequenceMask& mask, const CaseMaskedAlphabet* alphabet);
+
+      /**
+       * @return The sequence as a string, with masked positions in lower case (soft-masking).
+       * @param seq The sequence to convert.
+       * @param mask The mask to apply.
+       * @throw DimensionException if the mask and the sequence have different sizes.
+       */
+      static std::string toSoftMaskedString(const Sequence& seq, const RunLengthSequenceMask& mask);
+
   };
 }
 
@@ -39,6 +39,7 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include "SequenceWithQualityTools.h"
+#include "Alphabet/AlphabetTools.h"
 
 using namespace bpp;
 using namespace std;
@@ -54,7 +55,7 @@ NucleicAcidsReplication SequenceWithQualityTools::transc_(& DNA_, & RNA_);
 SequenceWithQuality* SequenceWithQualityTools::concatenate(const SequenceWithQuality& seqwq1, const SequenceWithQuality& seqwq2)
 {
 	// Sequence's alphabets matching verification
-	if ((seqwq1.getAlphabet()->getAlphabetType()) != (seqwq2.getAlphabet()->getAlphabetType()))
+	if ((seqwq1.getAlphabet()->getAlphabetTypeId()) != (seqwq2.getAlphabet()->getAlphabetTypeId()))
 		throw AlphabetMismatchException("SequenceTools::concatenate : Sequence's alphabets don't match ", seqwq1.getAlphabet(), seqwq2.getAlphabet());
 
 	// Sequence's names matching verification
@@ -78,11 +79,11 @@ SequenceWithQuality* SequenceWithQualityTools::complement(const SequenceWithQual
 {
   // Alphabet type checking
   NucleicAcidsReplication* NAR;
-  if (sequence.getAlphabet()->getAlphabetType() == "DNA alphabet")
+  if (AlphabetTools::isDNAAlphabet(sequence.getAlphabet()))
   {
     NAR = &DNARep_;
   }
-  else if(sequence.getAlphabet()->getAlphabetType() == "RNA alphabet")
+  else if (AlphabetTools::isRNAAlphabet(sequence.getAlphabet()))
   {
     NAR = &RNARep_;
   }
@@ -90,10 +91,10 @@ SequenceWithQuality* SequenceWithQualityTools::complement(const SequenceWithQual
   {
     throw AlphabetException ("SequenceTools::complement : Sequence must be nucleic.", sequence.getAlphabet());
   }
-  Sequence* seq = NAR->translate(sequence);
-  SequenceWithQuality* seqwq = new SequenceWithQuality(*seq, sequence.getQualities());
-  delete seq;
-  return seqwq;
+  vector<int> content = sequence.getContent();
+  if (content.size() > 0)
+    NAR->translate(&content[0], &content[0] + content.size());
+  return new SequenceWithQuality(sequence.getName(), content, sequence.getQualities(), sequence.getComments(), NAR->getTargetAlphabet());
 }
 
 /******************************************************************************/
@@ -101,14 +102,14 @@ SequenceWithQuality* SequenceWithQualityTools::complement(const SequenceWithQual
 SequenceWithQuality* SequenceWithQualityTools::transcript(const SequenceWithQuality& sequence)
 {
   // Alphabet type checking
-  if (sequence.getAlphabet()->getAlphabetType() != "DNA alphabet")
+  if (!AlphabetTools::isDNAAlphabet(sequence.getAlphabet()))
   {
     throw AlphabetException ("SequenceTools::transcript : Sequence must be DNA", sequence.getAlphabet());
   }
-  Sequence* seq = transc_.translate(sequence);
-  SequenceWithQuality* seqwq = new SequenceWithQuality(*seq, sequence.getQualities());
-  delete seq;
-  return seqwq;
+  vector<int> content = sequence.getContent();
+  if (content.size() > 0)
+    transc_.translate(&content[0], &content[0] + content.size());
+  return new SequenceWithQuality(sequence.getName(), content, sequence.getQualities(), sequence.getComments(), transc_.getTargetAlphabet());
 }
 
 /******************************************************************************/
@@ -116,7 +117,7 @@ SequenceWithQuality* SequenceWithQualityTools::transcript(const SequenceWithQual
 SequenceWithQuality* SequenceWithQualityTools::reverseTranscript(const SequenceWithQuality& sequence)
 {
   // Alphabet type checking
-  if (sequence.getAlphabet()->getAlphabetType() != "RNA alphabet")
+  if (!AlphabetTools::isRNAAlphabet(sequence.getAlphabet()))
   {
     throw AlphabetException ("SequenceTools::reverseTranscript : Sequence must be RNA", sequence.getAlphabet());
   }
@@ -144,6 +145,31 @@ SequenceWithQuality* SequenceWithQualityTools::invert(const SequenceWithQuality&
 
 /******************************************************************************/
 
+SequenceWithQuality* SequenceWithQualityTools::invertComplement(const SequenceWithQuality& sequence)
+{
+  // Alphabet type checking
+  NucleicAcidsReplication* NAR;
+  if (AlphabetTools::isDNAAlphabet(sequence.getAlphabet()))
+  {
+    NAR = &DNARep_;
+  }
+  else if (AlphabetTools::isRNAAlphabet(sequence.getAlphabet()))
+  {
+    NAR = &RNARep_;
+  }
+  else
+  {
+    throw AlphabetException ("SequenceWithQualityTools::invertComplement : Sequence must be nucleic.", sequence.getAlphabet());
+  }
+  vector<int> content = sequence.getContent();
+  if (content.size() > 0)
+    NAR->translateAndInvert(&content[0], &content[0] + content.size());
+  vector<int> qualities(sequence.getQualities().rbegin(), sequence.getQualities().rend());
+  return new SequenceWithQuality(sequence.getName(), content, qualities, sequence.getComments(), sequence.getAlphabet());
+}
+
+/******************************************************************************/
+
 SequenceWithQuality* SequenceWithQualityTools::removeGaps(const SequenceWithQuality& seq)
 {
   vector<int> content;
@@ -174,6 +174,20 @@ public:
           const SequenceWithQuality& sequence
           );
 
+      /**
+       * @brief Get the reverse complement of a nucleotide sequence.
+       *
+       * Qualities are inverted together with the states.
+       *
+       * @return A new SequenceWithQuality object containing the reverse
+       * complement.
+       * @param sequence The SequenceWithQuality to inverse and complement.
+       * @throw AlphabetException If the sequence is not a nucleotide sequence.
+       */
+      static SequenceWithQuality* invertComplement(
+          const SequenceWithQuality& sequence
+          );
+
       /**
        * @brief Remove gaps from a SequenceWithQuality.
        *
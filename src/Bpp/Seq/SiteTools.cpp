@@ -53,12 +53,13 @@ using namespace std;
 
 /******************************************************************************/
 
-bool SiteTools::hasGap(const Site& site)
+bool SiteTools::hasGap(const SiteView& site)
 {
+  const Alphabet* alpha = site.getAlphabet();
   // Main loop : for all characters in site
   for (size_t i = 0; i < site.size(); i++)
   {
-    if (site.getAlphabet()->isGap(site[i]))
+    if (alpha->isGap(site[i]))
       return true;
   }
   return false;
@@ -66,12 +67,13 @@ bool SiteTools::hasGap(const Site& site)
 
 /******************************************************************************/
 
-bool SiteTools::isGapOnly(const Site& site)
+bool SiteTools::isGapOnly(const SiteView& site)
 {
+  const Alphabet* alpha = site.getAlphabet();
   // Main loop : for all characters in site
   for (size_t i = 0; i < site.size(); i++)
   {
-    if (!site.getAlphabet()->isGap(site[i]))
+    if (!alpha->isGap(site[i]))
       return false;
   }
   return true;
@@ -79,12 +81,13 @@ bool SiteTools::isGapOnly(const Site& site)
 
 /******************************************************************************/
 
-bool SiteTools::isGapOrUnresolvedOnly(const Site& site)
+bool SiteTools::isGapOrUnresolvedOnly(const SiteView& site)
 {
+  const Alphabet* alpha = site.getAlphabet();
   // Main loop : for all characters in site
   for (size_t i = 0; i < site.size(); i++)
   {
-    if (!site.getAlphabet()->isGap(site[i]) && !site.getAlphabet()->isUnresolved(site[i]))
+    if (!alpha->isGap(site[i]) && !alpha->isUnresolved(site[i]))
       return false;
   }
   return true;
@@ -92,12 +95,13 @@ bool SiteTools::isGapOrUnresolvedOnly(const Site& site)
 
 /******************************************************************************/
 
-bool SiteTools::hasUnknown(const Site& site)
+bool SiteTools::hasUnknown(const SiteView& site)
 {
+  int unknown = site.getAlphabet()->getUnknownCharacterCode();
   // Main loop : for all characters in site
   for (size_t i = 0; i < site.size(); i++)
   {
-    if (site[i] == site.getAlphabet()->getUnknownCharacterCode())
+    if (site[i] == unknown)
       return true;
   }
   return false;
@@ -105,12 +109,13 @@ bool SiteTools::hasUnknown(const Site& site)
 
 /******************************************************************************/
 
-bool SiteTools::isComplete(const Site& site)
+bool SiteTools::isComplete(const SiteView& site)
 {
+  const Alphabet* alpha = site.getAlphabet();
   // Main loop : for all characters in site
   for (size_t i = 0; i < site.size(); i++)
   {
-    if (site.getAlphabet()->isGap(site[i]) || site.getAlphabet()->isUnresolved(site[i]))
+    if (alpha->isGap(site[i]) || alpha->isUnresolved(site[i]))
       return false;
   }
   return true;
@@ -121,15 +126,16 @@ bool SiteTools::isComplete(const Site& site)
 bool SiteTools::areSitesIdentical(const Site& site1, const Site& site2)
 {
   // Site's size and content checking
-  if (site1.getAlphabet()->getAlphabetType() != site2.getAlphabet()->getAlphabetType())
+  if (site1.getAlphabet()->getAlphabetTypeId() != site2.getAlphabet()->getAlphabetTypeId())
     return false;
   if (site1.size() != site2.size())
     return false;
   else
   {
+    SymbolListSpan states1(site1), states2(site2);
     for (size_t i = 0; i < site1.size(); i++)
     {
-      if (site1[i] != site2[i])
+      if (states1[i] != states2[i])
         return false;
     }
     return true;
@@ -145,15 +151,16 @@ bool SiteTools::isConstant(const Site& site, bool ignoreUnknown, bool unresolved
     throw EmptySiteException("SiteTools::isConstant: Incorrect specified site, size must be > 0", &site);
 
   // For all site's characters
+  SymbolListSpan states(site);
   int gap = site.getAlphabet()->getGapCharacterCode();
   if (ignoreUnknown)
   {
-    int s = site[0];
+    int s = states[0];
     int unknown = site.getAlphabet()->getUnknownCharacterCode();
     size_t i = 0;
     while (i < site.size() && (s == gap || s == unknown))
     {
-      s = site[i];
+      s = states[i];
       i++;
     }
     if (s == unknown || s == gap)
@@ -165,18 +172,18 @@ bool SiteTools::isConstant(const Site& site, bool ignoreUnknown, bool unresolved
     }
     while (i < site.size())
     {
-      if (site[i] != s && site[i] != gap && site[i] != unknown)
+      if (states[i] != s && states[i] != gap && states[i] != unknown)
         return false;
       i++;
     }
   }
   else
   {
-    int s = site[0];
+    int s = states[0];
     size_t i = 0;
     while  (i < site.size() && s == gap)
     {
-      s = site[i];
+      s = states[i];
       i++;
     }
     if (s == gap)
@@ -188,7 +195,7 @@ bool SiteTools::isConstant(const Site& site, bool ignoreUnknown, bool unresolved
     }
     while (i < site.size())
     {
-      if (site[i] != s && site[i] != gap)
+      if (states[i] != s && states[i] != gap)
         return false;
       i++;
     }
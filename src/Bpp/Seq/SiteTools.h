@@ -43,6 +43,7 @@
 
 #include "SymbolListTools.h"
 #include "Site.h"
+#include "SiteView.h"
 #include <Bpp/Exceptions.h>
 
 // From the STL:
@@ -66,31 +67,36 @@ public:
    * @param site A site.
    * @return True if the site contains one or several gap(s).
    */
-  static bool hasGap(const Site& site);
+  static bool hasGap(const Site& site) { return hasGap(SiteView(site)); }
+  static bool hasGap(const SiteView& site);
 
   /**
    * @param site A site.
    * @return True if the site contains only gaps.
    */
-  static bool isGapOnly(const Site& site);
+  static bool isGapOnly(const Site& site) { return isGapOnly(SiteView(site)); }
+  static bool isGapOnly(const SiteView& site);
 
   /**
    * @param site A site.
    * @return True if the site contains only gaps.
    */
-  static bool isGapOrUnresolvedOnly(const Site& site);
+  static bool isGapOrUnresolvedOnly(const Site& site) { return isGapOrUnresolvedOnly(SiteView(site)); }
+  static bool isGapOrUnresolvedOnly(const SiteView& site);
 
   /**
    * @param site A site.
    * @return True if the site contains one or several unknwn characters.
    */
-  static bool hasUnknown(const Site& site);
+  static bool hasUnknown(const Site& site) { return hasUnknown(SiteView(site)); }
+  static bool hasUnknown(const SiteView& site);
 
   /**
    * @param site A site.
    * @return True if the site contains no gap and no unknown characters.
    */
-  static bool isComplete(const Site& site);
+  static bool isComplete(const Site& site) { return isComplete(SiteView(site)); }
+  static bool isComplete(const SiteView& site);
 
   /**
    * @brief Tell if a site is constant, that is displaying the same state in all sequences that do not present a gap.
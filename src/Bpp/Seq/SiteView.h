@@ -0,0 +1,146 @@
+//
+// File: SiteView.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _SITEVIEW_H_
+#define _SITEVIEW_H_
+
+#include "Site.h"
+
+// From the STL:
+#include <string>
+
+namespace bpp
+{
+
+  /**
+   * @brief A read-only, non-owning view of a site.
+   *
+   * A view only stores a pointer toward the states of a site held by a container,
+   * together with its alphabet and position. It can therefore be created and copied
+   * at no cost, contrary to a Site object which owns its states.
+   * A standalone Site can be recovered with the materialize() method.
+   *
+   * The view is only valid as long as the viewed site is not modified or destroyed.
+   * Note that some containers (for instance AlignedSequenceContainer) build a new site
+   * at each call of the getSite() method, invalidating the views previously created for this index.
+   */
+  class SiteView
+  {
+  private:
+    const Alphabet* alphabet_;
+    const int* data_;
+    size_t size_;
+    int position_;
+
+  public:
+    SiteView(const Site& site) :
+      alphabet_(site.getAlphabet()),
+      data_(site.getData()),
+      size_(site.size()),
+      position_(site.getPosition())
+    {}
+
+    /**
+     * @param alpha The alphabet of the site.
+     * @param data A pointer toward the states of the site.
+     * @param size The number of states.
+     * @param position The position of the site.
+     */
+    SiteView(const Alphabet* alpha, const int* data, size_t size, int position = 0) :
+      alphabet_(alpha),
+      data_(data),
+      size_(size),
+      position_(position)
+    {}
+
+    SiteView(const SiteView& view) :
+      alphabet_(view.alphabet_),
+      data_(view.data_),
+      size_(view.size_),
+      position_(view.position_)
+    {}
+
+    SiteView& operator=(const SiteView& view)
+    {
+      alphabet_ = view.alphabet_;
+      data_     = view.data_;
+      size_     = view.size_;
+      position_ = view.position_;
+      return *this;
+    }
+
+  public:
+    const Alphabet* getAlphabet() const { return alphabet_; }
+
+    size_t size() const { return size_; }
+
+    int getPosition() const { return position_; }
+
+    const int* getData() const { return data_; }
+
+    const int& operator[](size_t i) const { return data_[i]; }
+
+    const int* begin() const { return data_; }
+
+    const int* end() const { return data_ + size_; }
+
+    /**
+     * @brief Checked access to a state.
+     *
+     * @throw IndexOutOfBoundsException If i is not a valid index.
+     */
+    int getValue(size_t i) const;
+
+    /**
+     * @return The site as a string, one character per state.
+     */
+    std::string toString() const;
+
+    /**
+     * @brief Copy the viewed states into a new Site object.
+     *
+     * @return A newly allocated site, independent of the viewed container.
+     */
+    Site* materialize() const;
+  };
+
+} //end of namespace bpp.
+
+#endif //_SITEVIEW_H_
+
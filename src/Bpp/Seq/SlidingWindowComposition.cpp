@@ -0,0 +1,279 @@
+//
+// File: SlidingWindowComposition.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include "SlidingWindowComposition.h"
+#include "Alphabet/AlphabetTools.h"
+#include "Alphabet/AlphabetExceptions.h"
+
+// From the STL:
+#include <cmath>
+
+using namespace std;
+
+using namespace bpp;
+
+/******************************************************************************/
+
+double WindowComposition::getGCContent() const
+{
+  size_t n = getNumberOfResolvedStates();
+  if (n == 0) return 0.;
+  return static_cast<double>(counts_[1] + counts_[2]) / static_cast<double>(n);
+}
+
+double WindowComposition::getGCSkew() const
+{
+  size_t gc = counts_[1] + counts_[2];
+  if (gc == 0) return 0.;
+  return (static_cast<double>(counts_[2]) - static_cast<double>(counts_[1])) / static_cast<double>(gc);
+}
+
+double WindowComposition::getEntropy() const
+{
+  size_t n = getNumberOfResolvedStates();
+  if (n == 0) return 0.;
+  double h = 0.;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    if (counts_[i] > 0)
+    {
+      double f = static_cast<double>(counts_[i]) / static_cast<double>(n);
+      h -= f * log(f);
+    }
+  }
+  return h / log(2.);
+}
+
+double WindowComposition::getUnresolvedFraction() const
+{
+  if (getLength() == 0) return 0.;
+  return static_cast<double>(unresolved_) / static_cast<double>(getLength());
+}
+
+double WindowComposition::getGapFraction() const
+{
+  if (getLength() == 0) return 0.;
+  return static_cast<double>(gaps_) / static_cast<double>(getLength());
+}
+
+/******************************************************************************/
+
+TabWindowCompositionWriter::TabWindowCompositionWriter(ostream& out, bool header):
+  out_(&out)
+{
+  if (header)
+    *out_ << "Name\tBegin\tEnd\tA\tC\tG\tT\tUnresolved\tGaps\tGC\tGCSkew\tEntropy" << endl;
+}
+
+void TabWindowCompositionWriter::writeWindow(const string& name, const WindowComposition& window)
+{
+  *out_ << name << "\t" << window.getBegin() << "\t" << window.getEnd();
+  for (int i = 0; i < 4; ++i)
+    *out_ << "\t" << window.getCount(i);
+  *out_ << "\t" << window.getNumberOfUnresolvedStates() << "\t" << window.getNumberOfGaps()
+        << "\t" << window.getGCContent() << "\t" << window.getGCSkew() << "\t" << window.getEntropy() << "\n";
+}
+
+/******************************************************************************/
+
+namespace
+{
+  struct VectorSink_
+  {
+    vector<WindowComposition>* windows;
+    void operator()(const WindowComposition& window) { windows->push_back(window); }
+  };
+
+  struct WriterSink_
+  {
+    const string* name;
+    WindowCompositionWriter* writer;
+    void operator()(const WindowComposition& window) { writer->writeWindow(*name, window); }
+  };
+}
+
+/******************************************************************************/
+
+SlidingWindowComposition::SlidingWindowComposition(size_t windowSize, size_t step):
+  windowSize_(windowSize), step_(step)
+{
+  if (windowSize == 0) throw Exception("SlidingWindowComposition: window size must be strictly positive.");
+  if (step == 0) throw Exception("SlidingWindowComposition: step must be strictly positive.");
+}
+
+/******************************************************************************/
+
+template<class States, class Sink>
+void SlidingWindowComposition::scan_(const States& states, size_t length, Sink& sink) const
+{
+  if (length < windowSize_) return;
+  WindowComposition window(0, windowSize_);
+  for (size_t i = 0; i < windowSize_; ++i)
+    window.addState(states[i]);
+  sink(window);
+  for (size_t begin = step_; begin + windowSize_ <= length; begin += step_)
+  {
+    if (step_ < windowSize_)
+    {
+      // Overlapping windows: only update the positions that changed.
+      size_t previous = begin - step_;
+      for (size_t i = previous; i < begin; ++i)
+        window.removeState(states[i]);
+      for (size_t i = previous + windowSize_; i < begin + windowSize_; ++i)
+        window.addState(states[i]);
+    }
+    else
+    {
+      window.reset();
+      for (size_t i = begin; i < begin + windowSize_; ++i)
+        window.addState(states[i]);
+    }
+    window.setRange(begin, begin + windowSize_);
+    sink(window);
+  }
+}
+
+/******************************************************************************/
+
+void SlidingWindowComposition::scan(const SymbolList& list, vector<WindowComposition>& windows) const
+{
+  if (!AlphabetTools::isNucleicAlphabet(list.getAlphabet()))
+    throw AlphabetException("SlidingWindowComposition::scan. Input sequence must be nucleic.", list.getAlphabet());
+  VectorSink_ sink = { &windows };
+  scan_(list, list.size(), sink);
+}
+
+void SlidingWindowComposition::scan(const SymbolList& list, const string& name, WindowCompositionWriter& writer) const
+{
+  if (!AlphabetTools::isNucleicAlphabet(list.getAlphabet()))
+    throw AlphabetException("SlidingWindowComposition::scan. Input sequence must be nucleic.", list.getAlphabet());
+  WriterSink_ sink = { &name, &writer };
+  scan_(list, list.size(), sink);
+}
+
+void SlidingWindowComposition::scan(const int* states, size_t length, vector<WindowComposition>& windows) const
+{
+  VectorSink_ sink = { &windows };
+  scan_(states, length, sink);
+}
+
+/******************************************************************************/
+
+void SlidingWindowComposition::scan(const OrderedSequenceContainer& sequences, WindowCompositionWriter& writer) const
+{
+  if (!AlphabetTools::isNucleicAlphabet(sequences.getAlphabet()))
+    throw AlphabetException("SlidingWindowComposition::scan. Input sequences must be nucleic.", sequences.getAlphabet());
+  size_t n = sequences.getNumberOfSequences();
+  string error;
+  bool failed = false;
+#ifdef _OPENMP
+#pragma omp parallel for ordered schedule(dynamic, 1)
+#endif
+  for (size_t i = 0; i < n; ++i)
+  {
+    string name;
+    vector<int> states;
+    vector<WindowComposition> windows;
+    bool ok = true;
+    // Containers may build sequences on the fly, access them one at a time:
+#ifdef _OPENMP
+#pragma omp critical(SlidingWindowComposition_access)
+#endif
+    {
+      if (failed) ok = false;
+      else
+      {
+        try
+        {
+          const Sequence& seq = sequences.getSequence(i);
+          name = seq.getName();
+          states.resize(seq.size());
+          for (size_t j = 0; j < states.size(); ++j)
+            states[j] = seq[j];
+        }
+        catch (exception& e)
+        {
+          failed = true;
+          error = e.what();
+          ok = false;
+        }
+      }
+    }
+    if (ok)
+    {
+      VectorSink_ sink = { &windows };
+      scan_(states, states.size(), sink);
+    }
+#ifdef _OPENMP
+#pragma omp ordered
+#endif
+    {
+      if (ok)
+      {
+#ifdef _OPENMP
+#pragma omp critical(SlidingWindowComposition_access)
+#endif
+        ok = !failed;
+      }
+      if (ok)
+      {
+        try
+        {
+          for (size_t j = 0; j < windows.size(); ++j)
+            writer.writeWindow(name, windows[j]);
+        }
+        catch (exception& e)
+        {
+#ifdef _OPENMP
+#pragma omp critical(SlidingWindowComposition_access)
+#endif
+          {
+            failed = true;
+            error = e.what();
+          }
+        }
+      }
+    }
+  }
+  if (failed)
+    throw Exception("SlidingWindowComposition::scan. " + error);
+}
+
+/******************************************************************************/
+
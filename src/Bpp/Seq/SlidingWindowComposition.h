@@ -0,0 +1,279 @@
+//
+// File: SlidingWindowComposition.h
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for sequences analysis.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#ifndef _SLIDINGWINDOWCOMPOSITION_H_
+#define _SLIDINGWINDOWCOMPOSITION_H_
+
+#include "SymbolList.h"
+#include "Container/OrderedSequenceContainer.h"
+
+// From the STL:
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace bpp
+{
+
+/**
+ * @brief Nucleotide composition of a window along a sequence.
+ *
+ * States 0 to 3 of a nucleic alphabet (A, C, G, T/U) are counted individually,
+ * all other non-gap states (ambiguity codes, unknown characters) are counted
+ * as unresolved.
+ */
+class WindowComposition
+{
+  private:
+    size_t begin_;
+    size_t end_;
+    size_t counts_[4];
+    size_t unresolved_;
+    size_t gaps_;
+
+  public:
+    /**
+     * @param begin First position of the window (0-based).
+     * @param end   Position following the last position of the window.
+     */
+    WindowComposition(size_t begin = 0, size_t end = 0):
+      begin_(begin), end_(end), counts_(), unresolved_(0), gaps_(0)
+    {
+      reset();
+    }
+
+  public:
+    size_t getBegin() const { return begin_; }
+    size_t getEnd() const { return end_; }
+    size_t getLength() const { return end_ - begin_; }
+
+    void setRange(size_t begin, size_t end)
+    {
+      begin_ = begin;
+      end_ = end;
+    }
+
+    /**
+     * @brief Set all counts to zero.
+     */
+    void reset()
+    {
+      counts_[0] = counts_[1] = counts_[2] = counts_[3] = 0;
+      unresolved_ = 0;
+      gaps_ = 0;
+    }
+
+    /**
+     * @brief Add a state to the counts.
+     */
+    void addState(int state)
+    {
+      if (state >= 0 && state < 4) counts_[state]++;
+      else if (state < 0) gaps_++;
+      else unresolved_++;
+    }
+
+    /**
+     * @brief Remove a state previously added to the counts.
+     */
+    void removeState(int state)
+    {
+      if (state >= 0 && state < 4) counts_[state]--;
+      else if (state < 0) gaps_--;
+      else unresolved_--;
+    }
+
+    /**
+     * @return The number of occurrences of a resolved state (0 to 3).
+     */
+    size_t getCount(int state) const { return counts_[state]; }
+    size_t getNumberOfResolvedStates() const { return counts_[0] + counts_[1] + counts_[2] + counts_[3]; }
+    size_t getNumberOfUnresolvedStates() const { return unresolved_; }
+    size_t getNumberOfGaps() const { return gaps_; }
+
+    /**
+     * @return The proportion of G and C among resolved states (0 if none).
+     */
+    double getGCContent() const;
+
+    /**
+     * @return The GC skew (G - C) / (G + C) (0 if there is no G or C).
+     */
+    double getGCSkew() const;
+
+    /**
+     * @return The Shannon entropy, in bits, of the resolved states frequencies.
+     */
+    double getEntropy() const;
+
+    /**
+     * @return The proportion of unresolved states in the window.
+     */
+    double getUnresolvedFraction() const;
+
+    /**
+     * @return The proportion of gaps in the window.
+     */
+    double getGapFraction() const;
+};
+
+/**
+ * @brief Interface for receiving window compositions as they are computed.
+ */
+class WindowCompositionWriter
+{
+  public:
+    WindowCompositionWriter() {}
+    virtual ~WindowCompositionWriter() {}
+
+  public:
+    /**
+     * @param name   The name of the sequence the window belongs to.
+     * @param window The window composition.
+     */
+    virtual void writeWindow(const std::string& name, const WindowComposition& window) = 0;
+};
+
+/**
+ * @brief Write window compositions as tab-delimited lines.
+ *
+ * Columns are: name, begin (0-based), end, A, C, G, T, unresolved, gaps, GC, GC skew, entropy.
+ */
+class TabWindowCompositionWriter:
+  public virtual WindowCompositionWriter
+{
+  private:
+    std::ostream* out_;
+
+  public:
+    /**
+     * @param out    The output stream.
+     * @param header Tell if a header line should be written first.
+     */
+    TabWindowCompositionWriter(std::ostream& out, bool header = true);
+
+    TabWindowCompositionWriter(const TabWindowCompositionWriter& writer): out_(writer.out_) {}
+    TabWindowCompositionWriter& operator=(const TabWindowCompositionWriter& writer)
+    {
+      out_ = writer.out_;
+      return *this;
+    }
+
+    virtual ~TabWindowCompositionWriter() {}
+
+  public:
+    void writeWindow(const std::string& name, const WindowComposition& window);
+};
+
+/**
+ * @brief Sliding-window nucleotide composition scanner.
+ *
+ * Counts are updated incrementally when the window slides, so that a sequence of length L
+ * is scanned in O(L) whatever the window size.
+ * Only complete windows are reported: a sequence shorter than the window yields no window.
+ *
+ * When compiled with OpenMP support, the sequences of a container are scanned in parallel,
+ * and windows are sent to the writer in the order of the container.
+ */
+class SlidingWindowComposition
+{
+  private:
+    size_t windowSize_;
+    size_t step_;
+
+  public:
+    /**
+     * @param windowSize The size of the windows.
+     * @param step       The distance between the starts of two consecutive windows.
+     * @throw Exception If the window size or the step is zero.
+     */
+    SlidingWindowComposition(size_t windowSize, size_t step);
+
+    virtual ~SlidingWindowComposition() {}
+
+  public:
+    size_t getWindowSize() const { return windowSize_; }
+    size_t getStep() const { return step_; }
+
+    /**
+     * @brief Scan a nucleic sequence.
+     *
+     * @param list    The sequence to scan.
+     * @param windows The output vector where window compositions will be appended.
+     * @throw AlphabetException If the sequence is not nucleic.
+     */
+    void scan(const SymbolList& list, std::vector<WindowComposition>& windows) const;
+
+    /**
+     * @brief Scan a nucleic sequence and stream the windows to a writer.
+     *
+     * @param list   The sequence to scan.
+     * @param name   The name passed to the writer.
+     * @param writer The writer.
+     * @throw AlphabetException If the sequence is not nucleic.
+     */
+    void scan(const SymbolList& list, const std::string& name, WindowCompositionWriter& writer) const;
+
+    /**
+     * @brief Scan a buffer of nucleic states.
+     *
+     * @param states  A pointer toward the first state.
+     * @param length  The number of states in the buffer.
+     * @param windows The output vector where window compositions will be appended.
+     */
+    void scan(const int* states, size_t length, std::vector<WindowComposition>& windows) const;
+
+    /**
+     * @brief Scan all sequences in a container and stream the windows to a writer.
+     *
+     * @param sequences The container to scan.
+     * @param writer    The writer.
+     * @throw AlphabetException If the container is not nucleic.
+     */
+    void scan(const OrderedSequenceContainer& sequences, WindowCompositionWriter& writer) const;
+
+  private:
+    template<class States, class Sink>
+    void scan_(const States& states, size_t length, Sink& sink) const;
+};
+
+} //end of namespace bpp.
+
+#endif //_SLIDINGWINDOWCOMPOSITION_H_
+
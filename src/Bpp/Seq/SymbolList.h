@@ -236,10 +236,62 @@ namespace bpp
      * @brief Randomly shuffle the content of the list, with linear complexity.
      */
     virtual void shuffle() = 0;
+
+    /**
+     * @brief Get a pointer to the list content, if it is stored contiguously.
+     *
+     * This allows algorithms to loop over the states without a virtual call per element.
+     * Implementations which do not store their content in a single array return a null pointer,
+     * which is the default.
+     *
+     * @return A pointer to the first state, or 0 if not available.
+     * @see SymbolListSpan
+     */
+    virtual const int* getData() const { return 0; }
     /** @} */
   };
 
 
+  /**
+   * @brief Read-only contiguous view of the states of a SymbolList.
+   *
+   * The view points directly to the list content when it is stored contiguously (see SymbolList::getData()).
+   * Otherwise, states are copied once into an internal buffer. Element access is then a non-virtual,
+   * inlinable array access.
+   *
+   * The view is only valid as long as the list is not modified or destroyed.
+   */
+  class SymbolListSpan
+  {
+  private:
+    const int* data_;
+    size_t size_;
+    std::vector<int> buffer_;
+
+  public:
+    SymbolListSpan(const SymbolList& list) :
+      data_(list.getData()), size_(list.size()), buffer_()
+    {
+      if (!data_ && size_ > 0) {
+        buffer_.resize(size_);
+        for (size_t i = 0; i < size_; ++i)
+          buffer_[i] = list[i];
+        data_ = &buffer_[0];
+      }
+    }
+
+    SymbolListSpan(const SymbolListSpan&) = delete;
+    SymbolListSpan& operator=(const SymbolListSpan&) = delete;
+
+  public:
+    const int* data() const { return data_; }
+    size_t size() const { return size_; }
+    const int& operator[](size_t i) const { return data_[i]; }
+    const int* begin() const { return data_; }
+    const int* end() const { return data_ + size_; }
+  };
+
+
   /**
    * @brief A basic SymbolList object.
    *
@@ -369,6 +421,8 @@ namespace bpp
     {
       random_shuffle(content_.begin(), content_.end());
     }
+
+    virtual const int* getData() const { return content_.empty() ? 0 : &content_[0]; }
   };
 
   class SymbolListEditionEvent
@@ -614,6 +668,8 @@ namespace bpp
       random_shuffle(content_.begin(), content_.end());
     }
 
+    virtual const int* getData() const { return content_.empty() ? 0 : &content_[0]; }
+
     /**
      * @name Events handling
      *
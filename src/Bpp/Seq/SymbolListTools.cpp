@@ -48,18 +48,40 @@ using namespace std;
 
 using namespace bpp;
 
+void SymbolListTools::getCounts(const SymbolList& list, map<int, size_t>& counts)
+{
+  SymbolListSpan states(list);
+  for (size_t i = 0; i < states.size(); ++i)
+    counts[states[i]]++;
+}
+
+void SymbolListTools::getCounts(const SymbolList& list1, const SymbolList& list2, map<int, map<int, size_t> >& counts)
+{
+  if (list1.size() != list2.size()) throw DimensionException("SymbolListTools::getCounts: the two sites must have the same size.", list1.size(), list2.size());
+  SymbolListSpan states1(list1), states2(list2);
+  for (size_t i = 0; i < states1.size(); i++)
+    counts[states1[i]][states2[i]]++;
+}
+
 void SymbolListTools::getCounts(const SymbolList& list, map<int, double>& counts, bool resolveUnknowns)
 {
+  SymbolListSpan states(list);
   if (!resolveUnknowns)
   {
-    for (size_t i = 0; i < list.size(); ++i)
-      counts[list[i]]++;
+    for (size_t i = 0; i < states.size(); ++i)
+      counts[states[i]]++;
   }
   else
   {
-    for (size_t i = 0; i < list.size(); ++i)
+    //Aliases are only computed once per distinct state:
+    const Alphabet* alpha = list.getAlphabet();
+    map<int, vector<int> > aliases;
+    for (size_t i = 0; i < states.size(); ++i)
     {
-      vector<int> alias = list.getAlphabet()->getAlias(list[i]);
+      map<int, vector<int> >::iterator it = aliases.find(states[i]);
+      if (it == aliases.end())
+        it = aliases.insert(make_pair(states[i], alpha->getAlias(states[i]))).first;
+      const vector<int>& alias = it->second;
       double n = static_cast<double>(alias.size());
       for (size_t j = 0; j < alias.size(); j++) counts[alias[j]] += 1./n ;
     }
@@ -69,17 +91,20 @@ void SymbolListTools::getCounts(const SymbolList& list, map<int, double>& counts
 void SymbolListTools::getCounts(const SymbolList& list1, const SymbolList& list2,  map< int, map<int, double> >& counts, bool resolveUnknowns)
 {
   if (list1.size() != list2.size()) throw DimensionException("SymbolListTools::getCounts: the two sites must have the same size.", list1.size(), list2.size());
+  SymbolListSpan states1(list1), states2(list2);
   if (!resolveUnknowns)
   {
-    for (size_t i = 0; i < list1.size(); i++)
-      counts[list1[i]][list2[i]]++;
+    for (size_t i = 0; i < states1.size(); i++)
+      counts[states1[i]][states2[i]]++;
   }
   else
   {
-    for (size_t i = 0; i < list1.size(); i++)
+    const Alphabet* alpha1 = list1.getAlphabet();
+    const Alphabet* alpha2 = list2.getAlphabet();
+    for (size_t i = 0; i < states1.size(); i++)
     {
-      vector<int> alias1 = list1.getAlphabet()->getAlias(list1[i]);
-      vector<int> alias2 = list2.getAlphabet()->getAlias(list2[i]);
+      vector<int> alias1 = alpha1->getAlias(states1[i]);
+      vector<int> alias2 = alpha2->getAlias(states2[i]);
       double n1 = (double)alias1.size();
       double n2 = (double)alias2.size();
       for (size_t j = 0; j < alias1.size(); j++)
@@ -119,8 +144,9 @@ double SymbolListTools::getGCContent(const SymbolList& list, bool ignoreUnresolv
     throw AlphabetException("SymbolListTools::getGCContent. Method only works on nucleotides.", alphabet);
   double gc = 0;
   double total = 0;
-  for (size_t i = 0; i < list.size(); i++) {
-    int state = list.getValue(i);
+  SymbolListSpan states(list);
+  for (size_t i = 0; i < states.size(); i++) {
+    int state = states[i];
     if (state > -1) { // not a gap
       if (state == 1 || state == 2) { // G or C
         gc++;
@@ -153,41 +179,45 @@ double SymbolListTools::getGCContent(const SymbolList& list, bool ignoreUnresolv
 
 size_t SymbolListTools::getNumberOfDistinctPositions(const SymbolList& l1, const SymbolList& l2)
 {
-	if (l1.getAlphabet()->getAlphabetType() != l2.getAlphabet()->getAlphabetType()) throw AlphabetMismatchException("SymbolListTools::getNumberOfDistinctPositions.", l1.getAlphabet(), l2.getAlphabet());
+	if (l1.getAlphabet()->getAlphabetTypeId() != l2.getAlphabet()->getAlphabetTypeId()) throw AlphabetMismatchException("SymbolListTools::getNumberOfDistinctPositions.", l1.getAlphabet(), l2.getAlphabet());
 	size_t n = min(l1.size(), l2.size());
 	size_t count = 0;
+	SymbolListSpan s1(l1), s2(l2);
 	for (size_t i = 0; i < n; i++) {
-		if (l1[i] != l2[i]) count++;
+		if (s1[i] != s2[i]) count++;
 	}
 	return count;
 }
 
 size_t SymbolListTools::getNumberOfPositionsWithoutGap(const SymbolList& l1, const SymbolList& l2)
 {
-	if (l1.getAlphabet() -> getAlphabetType() != l2.getAlphabet() -> getAlphabetType()) throw AlphabetMismatchException("SymbolListTools::getNumberOfDistinctPositions.", l1.getAlphabet(), l2.getAlphabet());
+	if (l1.getAlphabet() -> getAlphabetTypeId() != l2.getAlphabet() -> getAlphabetTypeId()) throw AlphabetMismatchException("SymbolListTools::getNumberOfDistinctPositions.", l1.getAlphabet(), l2.getAlphabet());
 	size_t n = min(l1.size(), l2.size());
 	size_t count = 0;
+	SymbolListSpan s1(l1), s2(l2);
 	for (size_t i = 0; i < n; i++) {
-		if (l1[i] != -1 && l2[i] != -1) count++;
+		if (s1[i] != -1 && s2[i] != -1) count++;
 	}
 	return count;
 }
 
 void SymbolListTools::changeGapsToUnknownCharacters(SymbolList& l)
 {
-  int unknownCode = l.getAlphabet()->getUnknownCharacterCode();
+  const Alphabet* alpha = l.getAlphabet();
+  int unknownCode = alpha->getUnknownCharacterCode();
   for (size_t i = 0; i < l.size(); i++)
   {
-    if (l.getAlphabet()->isGap(l[i])) l[i] = unknownCode;
+    if (alpha->isGap(l[i])) l[i] = unknownCode;
   }
 }
 
 void SymbolListTools::changeUnresolvedCharactersToGaps(SymbolList& l)
 {
-  int gapCode = l.getAlphabet()->getGapCharacterCode();
+  const Alphabet* alpha = l.getAlphabet();
+  int gapCode = alpha->getGapCharacterCode();
   for (size_t i = 0; i < l.size(); i++)
   {
-    if (l.getAlphabet()->isUnresolved(l[i])) l[i] = gapCode;
+    if (alpha->isUnresolved(l[i])) l[i] = gapCode;
   }
 }
 
@@ -67,11 +67,7 @@ class SymbolListTools
      * @param list The list.
      * @param counts The output map to store the counts (existing counts will be incremented).
      */
-    static void getCounts(const SymbolList& list, std::map<int, size_t>& counts)
-    {
-      for (size_t i = 0; i < list.size(); ++i)
-        counts[list[i]]++;
-    }
+    static void getCounts(const SymbolList& list, std::map<int, size_t>& counts);
     
     /**
      * @brief Count all pair of states for two lists of the same size.
@@ -85,12 +81,7 @@ class SymbolListTools
      * @param list2 The second list.
      * @param counts The output map to store the counts (existing counts will be incremented).
      */
-    static void getCounts(const SymbolList& list1, const SymbolList& list2, std::map<int, std::map<int, size_t> >& counts)
-    {
-      if(list1.size() != list2.size()) throw DimensionException("SymbolListTools::getCounts: the two sites must have the same size.", list1.size(), list2.size());
-      for(size_t i = 0; i < list1.size(); i++)
-        counts[list1[i]][list2[i]]++;
-    }
+    static void getCounts(const SymbolList& list1, const SymbolList& list2, std::map<int, std::map<int, size_t> >& counts);
 
     /**
      * @brief Count all states in the list, optionaly resolving unknown characters.
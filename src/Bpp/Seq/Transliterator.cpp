@@ -43,7 +43,7 @@ using namespace bpp;
 
 Sequence* AbstractTransliterator::translate(const Sequence& sequence) const
 {
-  if (sequence.getAlphabet()->getAlphabetType() != getSourceAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() != getSourceAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("AbstractTransliterator::translate", getSourceAlphabet(), getTargetAlphabet());
   Sequence* tSeq = new BasicSequence(sequence.getName(), "", sequence.getComments(), getTargetAlphabet());
   int gap = sequence.getAlphabet()->getGapCharacterCode();
@@ -60,7 +60,7 @@ Sequence* AbstractTransliterator::translate(const Sequence& sequence) const
 
 Sequence* AbstractReverseTransliterator::reverse(const Sequence& sequence) const
 {
-  if (sequence.getAlphabet()->getAlphabetType() != getTargetAlphabet()->getAlphabetType())
+  if (sequence.getAlphabet()->getAlphabetTypeId() != getTargetAlphabet()->getAlphabetTypeId())
     throw AlphabetMismatchException("AbstractReverseTransliterator::reverse", getSourceAlphabet(), getTargetAlphabet());
   Sequence* rSeq = new BasicSequence(sequence.getName(), "", sequence.getComments(), getSourceAlphabet());
   for (unsigned int i = 0; i < sequence.size(); ++i)
@@ -40,12 +40,31 @@ knowledge of the CeCILL license and that you accept its terms.
 #include <Bpp/Seq/Alphabet/RNA.h>
 #include <Bpp/Seq/Container/VectorSiteContainer.h>
 #include <Bpp/Seq/Container/SiteContainerTools.h>
+#include <Bpp/Seq/Container/AlignmentComparison.h>
+#include <Bpp/Seq/AlphabetIndex/BLOSUM50.h>
+#include <Bpp/Seq/AlphabetIndex/ScoreQueryProfile.h>
+#include <memory>
 #include <Bpp/Seq/SiteTools.h>
 #include <iostream>
 
 using namespace bpp;
 using namespace std;
 
+//An index which does not score one pair of distinct states:
+class PartialBLOSUM50:
+  public BLOSUM50
+{
+  public:
+    PartialBLOSUM50* clone() const { return new PartialBLOSUM50(*this); }
+    double getIndex(int state1, int state2) const
+    {
+      if (state1 == 0 && state2 == 1)
+        throw BadIntException(state2, "PartialBLOSUM50::getIndex. Pair not scored.", getAlphabet());
+      return BLOSUM50::getIndex(state1, state2);
+    }
+    double getIndex(const string& state1, const string& state2) const { return BLOSUM50::getIndex(state1, state2); }
+};
+
 int main() {
   RNA* alpha = new RNA();
   SiteContainer* sites = new VectorSiteContainer(alpha);
@@ -98,5 +117,65 @@ int main() {
   vector<double> sp21 = SiteContainerTools::getSumOfPairsScores(index2, index1);
   VectorTools::print(sp21);
 
+  //Global scores:
+  AlignmentComparison comparison(index2);
+  if (comparison.getSumOfPairsScores(index1) != sp12) return 1;
+  if (comparison.getTotalColumnScore(index2) != 1.) return 1;
+  if (comparison.getSumOfPairsScore(index2) != 1.) return 1;
+  double tc = comparison.getTotalColumnScore(index1);
+  double sp = comparison.getSumOfPairsScore(index1);
+  cout << "TC = " << tc << ", SP = " << sp << endl;
+  if (tc <= 0. || tc >= 1. || sp <= 0. || sp >= 1.) return 1;
+  RowMatrix<double> pairs;
+  comparison.getPairwiseScores(index1, pairs);
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      cout << pairs(i, j) << "\t";
+      if (pairs(i, j) != pairs(j, i) || pairs(i, j) < 0. || pairs(i, j) > 1.) return 1;
+    }
+    cout << endl;
+  }
+
+  //Compiled score tables:
+  BLOSUM50 blosum;
+  const Alphabet* protein = blosum.getAlphabet();
+  unique_ptr<CompiledAlphabetIndex2> table(blosum.compile(-8., -1., 2.));
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      if (table->getScore(i, j) != blosum.getIndex(i, j)) return 1;
+      if (table->getIntScores(i)[table->getRow(j)] != static_cast<int>(2 * blosum.getIndex(i, j))) return 1;
+    }
+    if (table->getScore(i, -1) != -8. || table->getScore(-1, i) != -8.) return 1;
+    if (table->getScore(i, 22) != -1. || table->isDefined(i, 22)) return 1;
+  }
+  BasicSequence query("query", "MKVLAAGIVALLLAAGCSSS", protein);
+  BasicSequence subject("subject", "MKVIAXGIV-LLLSAGCTSS", protein);
+  ScoreQueryProfile profile(*table, query);
+  double score = 0.;
+  for (size_t i = 0; i < query.size(); ++i)
+    score += table->getScore(subject[i], query[i]);
+  cout << "Query profile score: " << profile.getSegmentScore(subject, 0, 0, query.size()) << endl;
+  if (profile.getSegmentScore(subject, 0, 0, query.size()) != score) return 1;
+  if (profile.getSegmentScore(subject, 2, 2, 3) != blosum.getIndex(subject[2], query[2]) + blosum.getIndex(subject[3], query[3]) + blosum.getIndex(subject[4], query[4])) return 1;
+  //Unresolved states are still rejected by the aligner:
+  try {
+    unique_ptr<AlignedSequenceContainer> aln(SiteContainerTools::alignNW(query, subject, blosum, -8.));
+    return 1;
+  } catch (Exception& e) {
+    cout << "Expected exception: " << e.what() << endl;
+  }
+  BasicSequence subject2("subject", "MKVIAGIVLLLSAGCTSS", protein);
+  unique_ptr<AlignedSequenceContainer> aln(SiteContainerTools::alignNW(query, subject2, blosum, -8.));
+  cout << aln->toString("query") << endl << aln->toString("subject") << endl;
+  //Pairs of distinct states are checked too:
+  PartialBLOSUM50 partial;
+  BasicSequence ar("ar", "AR", protein), ra("ra", "RA", protein);
+  try {
+    unique_ptr<AlignedSequenceContainer> aln2(SiteContainerTools::alignNW(ar, ra, partial, -8.));
+    return 1;
+  } catch (BadIntException& e) {
+    cout << "Expected exception: " << e.what() << endl;
+  }
+
   return 0;
 }
@@ -48,6 +48,30 @@ knowledge of the CeCILL license and that you accept its terms.
 using namespace bpp;
 using namespace std;
 
+//An alphabet which does not register its type:
+class UserAlphabet:
+  public LetterAlphabet
+{
+  private:
+    string type_;
+
+  public:
+    UserAlphabet(const string& type): type_(type)
+    {
+      registerState(new AlphabetState(-1, "-", "Gap"));
+      registerState(new AlphabetState(0, "A", "A"));
+      registerState(new AlphabetState(1, "?", "Unknown"));
+    }
+
+    UserAlphabet* clone() const { return new UserAlphabet(*this); }
+    unsigned int getSize() const { return 1; }
+    unsigned int getNumberOfTypes() const { return 1; }
+    int getUnknownCharacterCode() const { return 1; }
+    bool isUnresolved(int state) const { return state == 1; }
+    bool isUnresolved(const string& state) const { return state == "?"; }
+    string getAlphabetType() const { return type_; }
+};
+
 int main() {
   //This is a very simple test that instanciate all alpahabet classes.
   NucleicAlphabet* dna = new DNA();
@@ -63,6 +87,26 @@ int main() {
   if (!AlphabetTools::isNucleicAlphabet(rna)) return 1;
   if (!AlphabetTools::isProteicAlphabet(pro)) return 1;
   if (!AlphabetTools::isCodonAlphabet(cdn)) return 1;
+  if (!AlphabetTools::isWordAlphabet(cdn)) return 1;
+  if (AlphabetTools::isNucleicAlphabet(pro)) return 1;
+  if (AlphabetTools::isDNAAlphabet(rna)) return 1;
+
+  //Testing type tags:
+  DNA dna2;
+  CodonAlphabet cdn2(dna);
+  if (!AlphabetTools::haveSameType(dna, &dna2)) return 1;
+  if (AlphabetTools::haveSameType(dna, rna)) return 1;
+  if (AlphabetTools::haveSameType(cdn, &cdn2)) return 1;
+  Alphabet* cdn3 = cdn->clone();
+  if (!cdn3->equals(*cdn)) return 1;
+  if (!AlphabetTools::isCodonAlphabet(cdn3)) return 1;
+  delete cdn3;
+  UserAlphabet user1("User alphabet 1"), user2("User alphabet 2"), user3("User alphabet 1");
+  if (user1.getAlphabetTypeId() == 0) return 1;
+  const Alphabet& userRef = user1;
+  if (userRef.equals(user2) || AlphabetTools::haveSameType(&user1, &user2)) return 1;
+  if (!userRef.equals(user3)) return 1;
+  if (user1.getAlphabetTypeId() == dna->getAlphabetTypeId()) return 1;
 
   delete dna;
   delete rna;
@@ -38,9 +38,20 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include <Bpp/Seq/Alphabet/RNA.h>
+#include <Bpp/Seq/Alphabet/DefaultAlphabet.h>
+#include <Bpp/Seq/Alphabet/AlphabetTools.h>
+#include <Bpp/Seq/DNAToRNA.h>
+#include <Bpp/Seq/SiteTools.h>
 #include <Bpp/Seq/Container/VectorSiteContainer.h>
+#include <Bpp/Seq/Container/AlignedSequenceContainer.h>
 #include <Bpp/Seq/Container/SiteContainerTools.h>
+#include <Bpp/Seq/Container/SiteContainerView.h>
+#include <Bpp/Seq/Io/MaseTools.h>
+#include <Bpp/Seq/Container/SiteResampler.h>
+#include <Bpp/Seq/Container/AlignmentProfile.h>
 #include <iostream>
+#include <memory>
+#include <cmath>
 
 using namespace bpp;
 using namespace std;
@@ -64,5 +75,146 @@ int main() {
   cout << sites->toString("seq1") << endl;
   cout << sites->toString("seq2") << endl;
 
-  return (sites->getNumberOfSites() == 30 ? 0 : 1);
+  if (sites->getNumberOfSites() != 30) return 1;
+
+  //Resampling:
+  SiteResampler resampler(*sites, 42);
+  cout << resampler.getNumberOfPatterns() << " site patterns." << endl;
+  unsigned int total = 0;
+  for (size_t i = 0; i < resampler.getNumberOfPatterns(); ++i)
+    total += resampler.getPatternWeights()[i];
+  if (total != 30) return 1;
+  VectorSiteContainer* patterns = resampler.getPatterns();
+  if (patterns->getNumberOfSites() != resampler.getNumberOfPatterns()) return 1;
+  delete patterns;
+
+  vector< vector<unsigned int> > replicates;
+  resampler.getBootstrapWeights(0, 10, replicates);
+  for (size_t r = 0; r < replicates.size(); ++r) {
+    vector<size_t> index;
+    vector<unsigned int> weights;
+    resampler.getBootstrapIndex(r, index);
+    resampler.getWeights(index, weights);
+    if (weights != replicates[r]) return 1;
+    VectorSiteContainer* replicate = resampler.getReplicate(index);
+    VectorSiteContainer* weighted = resampler.getWeightedReplicate(weights);
+    if (replicate->getNumberOfSites() != 30 || weighted->getNumberOfSites() != 30) return 1;
+    delete replicate;
+    delete weighted;
+  }
+
+  vector<size_t> jackknife;
+  resampler.getJackknifeIndex(0, 0.5, jackknife);
+  cout << "Jackknife replicate: " << jackknife.size() << " sites." << endl;
+  if (jackknife.size() != 15) return 1;
+  for (size_t i = 1; i < jackknife.size(); ++i)
+    if (jackknife[i] <= jackknife[i - 1]) return 1;
+
+  //Profile:
+  AlignmentProfile profile(*sites, 0.5);
+  AlignedSequenceContainer aligned(*sites);
+  AlignmentProfile alignedProfile(aligned, 0.5);
+  for (size_t g = 0; g < 2; ++g) {
+    Sequence* cons1 = SiteContainerTools::getConsensus(*sites, "consensus", g == 0);
+    Sequence* cons2 = profile.getConsensus("consensus", g == 0);
+    cout << cons2->toString() << endl;
+    if (cons1->toString() != cons2->toString()) return 1;
+    delete cons1;
+    delete cons2;
+  }
+  for (size_t i = 0; i < profile.getNumberOfSites(); ++i) {
+    double sum = 0;
+    for (size_t s = 0; s < profile.getNumberOfStates(); ++s)
+      sum += profile.getFrequency(i, s);
+    if (abs(sum - 1.) > 1e-9) return 1;
+    for (size_t s = 0; s < profile.getNumberOfStates(); ++s)
+      if (alignedProfile.getCount(i, s) != profile.getCount(i, s)) return 1;
+    if (profile.getGapCount(i) + profile.getResidueCount(i) != 2) return 1;
+  }
+  if (profile.getEntropy(1) != 0 || abs(profile.getEntropy(2) - 1.) > 1e-9) return 1;
+  vector<double> scores;
+  profile.scan(sites->getSequence(0), scores);
+  if (scores.size() != 1 || abs(scores[0] - profile.getScore(sites->getSequence(0))) > 1e-9) return 1;
+  cout << "Profile score of seq1: " << scores[0] << endl;
+
+
+  SiteSelection withoutGaps = SiteContainerTools::selectSitesWithoutGaps(*sites);
+  unique_ptr<SiteContainer> noGapSites(SiteContainerTools::getSitesWithoutGaps(*sites));
+  if (withoutGaps.size() != noGapSites->getNumberOfSites() || withoutGaps.size() == 0) return 1;
+  if (SiteContainerTools::selectSitesWithMaxGapFrequency(*sites, 0.) != withoutGaps) return 1;
+  if (SiteContainerTools::selectNonGapOnlySites(*sites).size() != 30) return 1;
+  for (size_t i = 0; i < withoutGaps.size(); ++i) {
+    SiteView view(sites->getSite(withoutGaps[i]));
+    if (view.toString() != noGapSites->getSite(i).toString()) return 1;
+    unique_ptr<Site> site(view.materialize());
+    if (site->getPosition() != view.getPosition() || !SiteTools::areSitesIdentical(*site, sites->getSite(withoutGaps[i]))) return 1;
+  }
+
+
+  SiteContainerView view(*sites, withoutGaps);
+  if (view.getNumberOfSites() != withoutGaps.size() || &view.getSite(0) != &sites->getSite(withoutGaps[0])) return 1;
+  if (view.toString("seq2") != noGapSites->toString("seq2")) return 1;
+  vector<size_t> lastSequence(1, 1), firstSites(2);
+  firstSites[0] = 0;
+  firstSites[1] = 1;
+  SiteContainerView subView(view, firstSites, lastSequence);
+  if (&subView.getParent() != sites || subView.getSiteIndices()[1] != withoutGaps[1]) return 1;
+  if (subView.getNumberOfSequences() != 1 || subView.getName(0) != "seq2") return 1;
+  if (subView.toString(0) != noGapSites->toString("seq2").substr(0, 2)) return 1;
+  const SiteContainerView& constView = subView;
+  if (subView.getSite(1).size() != 1 || constView(0, 1) != noGapSites->getSite(1)[1]) return 1;
+  unique_ptr<VectorSiteContainer> copy(subView.materialize());
+  if (copy->getNumberOfSites() != 2 || copy->toString("seq2") != subView.toString("seq2")) return 1;
+  try {
+    subView.deleteSite(0);
+    return 1;
+  } catch (NotImplementedException& ex) {}
+
+  //Views of mase+ site sets are const, so that reads use the const accessors:
+  VectorSiteContainer mase(*sites);
+  Comments header;
+  header.push_back("# of regions = 2 firstSites");
+  header.push_back("1,2 4,4");
+  mase.setGeneralComments(header);
+  unique_ptr<const SiteContainerView> maseView(MaseTools::getSelectedSitesView(mase, "firstSites"));
+  if (maseView->getNumberOfSites() != 3 || (*maseView)(1, 2) != mase(1, 3)) return 1;
+
+  //Whole alignment transformations:
+  VectorSiteContainer unknowns(*sites);
+  SiteContainerTools::changeGapsToUnknownCharacters(unknowns);
+  if (unknowns.toString("seq1").find('-') != string::npos || unknowns.toString("seq1")[0] != 'N') return 1;
+  SiteContainerTools::changeUnresolvedCharactersToGaps(unknowns);
+  if (unknowns.toString("seq2") != sites->toString("seq2")) return 1;
+
+  VectorSiteContainer dna(&AlphabetTools::DNA_ALPHABET);
+  dna.addSequence(BasicSequence("dna1", "ATG-CNT", &AlphabetTools::DNA_ALPHABET), false);
+  dna.addSequence(BasicSequence("dna2", "AYGTC-T", &AlphabetTools::DNA_ALPHABET), false);
+  unique_ptr<VectorSiteContainer> rna(SiteContainerTools::translate(dna, DNAToRNA()));
+  if (!AlphabetTools::isRNAAlphabet(rna->getAlphabet())) return 1;
+  if (rna->toString("dna1") != "AUG-CNU" || rna->toString("dna2") != "AYGUC-U") return 1;
+
+  //In-place translation, rejected as a whole if one state is not covered by the table:
+  vector<int> swapAT(4);
+  swapAT[0] = 3; swapAT[1] = 1; swapAT[2] = 2; swapAT[3] = 0;
+  try {
+    dna.translateStates(swapAT, 0);
+    return 1;
+  } catch (BadIntException& ex) {}
+  if (dna.toString("dna1") != "ATG-CNT" || dna.toString("dna2") != "AYGTC-T") return 1;
+  VectorSiteContainer acgt(&AlphabetTools::DNA_ALPHABET);
+  acgt.addSequence(BasicSequence("acgt", "AACGTT", &AlphabetTools::DNA_ALPHABET), false);
+  acgt.translateStates(swapAT, 0);
+  if (acgt.toString("acgt") != "TTCGAA") return 1;
+
+  DefaultAlphabet defaultAlpha;
+  VectorSiteContainer dotted(&defaultAlpha);
+  dotted.addSequence(BasicSequence("ref", "ACGT-A", &defaultAlpha), false);
+  dotted.addSequence(BasicSequence("dot1", "..G.CA", &defaultAlpha), false);
+  dotted.addSequence(BasicSequence("dot2", ".-...T", &defaultAlpha), false);
+  unique_ptr<SiteContainer> resolved(SiteContainerTools::resolveDottedAlignment(dotted, &AlphabetTools::DNA_ALPHABET));
+  if (resolved->toString("dot1") != "ACGTCA" || resolved->toString("dot2") != "A-GT-T") return 1;
+
+  delete sites;
+  delete alpha;
+  return 0;
 }
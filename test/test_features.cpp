@@ -0,0 +1,184 @@
+//
+// File: test_features.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for numerical calculus. This file is part of the Bio++ project.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include <Bpp/Seq/Alphabet/DNA.h>
+#include <Bpp/Seq/SequenceWithAnnotation.h>
+#include <Bpp/Seq/SequenceFeatures.h>
+#include <Bpp/Seq/SequenceWithAnnotationTools.h>
+#include <Bpp/Seq/Io/Fasta.h>
+#include <Bpp/Seq/Io/GffFeatureReader.h>
+#include <Bpp/Numeric/Random/RandomTools.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+using namespace bpp;
+using namespace std;
+
+bool checkQueries(const SequenceFeatureSet& features) {
+  for (unsigned int i = 0; i < 1000; ++i) {
+    size_t begin = RandomTools::giveIntRandomNumberBetweenZeroAndEntry<size_t>(features.getSize());
+    size_t end = begin + RandomTools::giveIntRandomNumberBetweenZeroAndEntry<size_t>(1000) + 1;
+    vector<size_t> found;
+    features.getOverlappingFeatures(begin, end, found);
+    size_t n = 0;
+    for (size_t j = 0; j < features.getNumberOfFeatures(); ++j) {
+      if (features.getFeature(j).overlaps(begin, end)) {
+        if (find(found.begin(), found.end(), j) == found.end()) return false;
+        ++n;
+      }
+    }
+    if (n != found.size() || n != features.getNumberOfOverlappingFeatures(begin, end)) return false;
+    for (size_t j = 1; j < found.size(); ++j)
+      if (features.getFeature(found[j]).getBegin() < features.getFeature(found[j - 1]).getBegin()) return false;
+  }
+  return true;
+}
+
+vector<bool> randomMask(size_t size) {
+  vector<bool> mask(size);
+  bool state = false;
+  for (size_t i = 0; i < size; ++i) {
+    if (RandomTools::giveIntRandomNumberBetweenZeroAndEntry<size_t>(20) == 0) state = !state;
+    mask[i] = state;
+  }
+  return mask;
+}
+
+bool testMasks() {
+  //Set operations:
+  for (unsigned int i = 0; i < 100; ++i) {
+    vector<bool> v1 = randomMask(500), v2 = randomMask(500);
+    RunLengthSequenceMask m1(v1), m2(v2), m3(v1);
+    m1.unionWith(m2);
+    m3.intersectWith(m2);
+    m2.complement();
+    for (size_t j = 0; j < 500; ++j) {
+      if (m1[j] != (v1[j] || v2[j]) || m3[j] != (v1[j] && v2[j]) || m2[j] == v2[j]) return false;
+    }
+    size_t b = RandomTools::giveIntRandomNumberBetweenZeroAndEntry<size_t>(500);
+    size_t e = b + RandomTools::giveIntRandomNumberBetweenZeroAndEntry<size_t>(500 - b);
+    m1.setMask(b, e, i % 2 == 0);
+    for (size_t j = 0; j < 500; ++j)
+      if (j >= b && j < e && m1[j] != (i % 2 == 0)) return false;
+  }
+
+  //Soft-masking:
+  string text = "ACGTacgtnnACGTaa";
+  RunLengthSequenceMask* mask1 = SequenceWithAnnotationTools::getMaskRuns(text);
+  if (mask1->getNumberOfRuns() != 2 || mask1->getRunBegin(0) != 4 || mask1->getRunEnd(0) != 10 || mask1->getNumberOfMaskedPositions() != 8) return false;
+  istringstream fasta(">seq1\nACGTacg\ntnnACGTaa\n");
+  DNA* alpha = new DNA();
+  BasicSequence seq("", "", alpha);
+  RunLengthSequenceMask mask2;
+  Fasta().nextSoftMaskedSequence(fasta, seq, mask2);
+  if (seq.toString() != "ACGTACGTNNACGTAA" || mask2.getMask() != mask1->getMask()) return false;
+  CaseMaskedAlphabet* cma = new CaseMaskedAlphabet(alpha);
+  Sequence* masked = SequenceWithAnnotationTools::applyMask(seq, mask2, cma);
+  RunLengthSequenceMask* mask3 = SequenceWithAnnotationTools::getMaskRuns(*masked);
+  if (masked->toString() != text || mask3->getMask() != mask1->getMask()) return false;
+  if (SequenceWithAnnotationTools::toSoftMaskedString(seq, *mask3) != text) return false;
+  delete masked;
+  delete mask1;
+  delete mask3;
+
+  //Sequence edition, compared to the vector-based mask:
+  SequenceWithAnnotation seqa("seqa", string(500, 'A'), alpha);
+  vector<bool> v = randomMask(500);
+  RunLengthSequenceMask* rle = new RunLengthSequenceMask(v);
+  SequenceMask* dense = new SequenceMask(v);
+  seqa.addAnnotation(rle);
+  seqa.addAnnotation(dense);
+  for (unsigned int i = 0; i < 100; ++i) {
+    size_t pos = RandomTools::giveIntRandomNumberBetweenZeroAndEntry<size_t>(seqa.size());
+    if (i % 2 == 0) {
+      seqa.addElement(pos, "C");
+    } else {
+      seqa.deleteElements(pos, min(static_cast<size_t>(5), seqa.size() - pos));
+    }
+    if (rle->getMask() != dense->getMask()) return false;
+  }
+  delete cma;
+  delete alpha;
+  return true;
+}
+
+int main() {
+  DNA* alpha = new DNA();
+  SequenceWithAnnotation seq("ctg123", string(10000, 'A'), alpha);
+  SequenceFeatureSet* features = new SequenceFeatureSet(seq.size());
+
+  GffFeatureReader reader;
+  ifstream gff("example.gff");
+  size_t n = reader.readFeatures(gff, "ctg123", *features);
+  gff.close();
+  cout << n << " features read." << endl;
+  if (n != 23) return 1;
+  const SequenceFeature& gene = features->getFeature(0);
+  if (gene.getType() != "gene" || gene.getBegin() != 999 || gene.getEnd() != 9000 || gene.getAttribute("Name") != "EDEN") return 1;
+  seq.addAnnotation(features);
+
+  vector<size_t> found;
+  features->getFeaturesAt(1299, found);
+  cout << found.size() << " features at position 1300." << endl;
+  if (found.size() != 8) return 1;
+  if (!checkQueries(*features)) return 1;
+
+  //Insertion before all features:
+  seq.addElement(0, "C");
+  if (features->getSize() != 10001 || features->getFeature(0).getBegin() != 1000) return 1;
+
+  //Deletion of exon00001, of the first exon of cds00001 and cds00002, and of part of exon00002:
+  seq.deleteElements(1201, 400);
+  if (features->getSize() != 9601) return 1;
+  for (size_t i = 0; i < features->getNumberOfFeatures(); ++i) {
+    const SequenceFeature& feature = features->getFeature(i);
+    if (feature.getId() == "exon00001") return 1;
+    if (feature.getId() == "exon00002" && (feature.getBegin() != 1050 || feature.getEnd() != 1201)) return 1;
+  }
+  cout << features->getNumberOfFeatures() << " features after deletion." << endl;
+  if (features->getNumberOfFeatures() != 20) return 1;
+  if (!checkQueries(*features)) return 1;
+
+  if (!testMasks()) return 1;
+
+  delete alpha;
+  return 0;
+}
@@ -38,11 +38,22 @@ knowledge of the CeCILL license and that you accept its terms.
 */
 
 #include <Bpp/Seq/Alphabet/ProteicAlphabet.h>
+#include <Bpp/Seq/Alphabet/DNA.h>
+#include <Bpp/Seq/SequenceWithAnnotation.h>
 #include <Bpp/Seq/Io/Fasta.h>
 #include <Bpp/Seq/Io/Mase.h>
 #include <Bpp/Seq/Io/Clustal.h>
 #include <Bpp/Seq/Io/Phylip.h>
+#include <Bpp/Seq/Io/GenBank.h>
+#include <Bpp/Seq/Io/Embl.h>
+#include <Bpp/Seq/Io/Stockholm.h>
+#include <Bpp/Seq/Io/PhylipStreamWriter.h>
+#include <Bpp/Seq/Container/VectorSiteContainer.h>
+#include <Bpp/Seq/Instrumentation.h>
+#include <Bpp/Seq/App/SequenceApplicationTools.h>
 #include <iostream>
+#include <sstream>
+#include <memory>
 
 using namespace bpp;
 using namespace std;
@@ -84,6 +95,201 @@ int main() {
            && sites1->getNumberOfSites()     == sites4->getNumberOfSites()
            && sites1->getNumberOfSites()     == sites5->getNumberOfSites();
 
+  //Interleaved files read into site-based containers are built site by site:
+  VectorSiteContainer sites4b(alpha);
+  phylip.readAlignment("example.ph", sites4b);
+  test = test && sites4b.getNumberOfSequences() == sites4->getNumberOfSequences()
+              && sites4b.getNumberOfSites() == sites4->getNumberOfSites()
+              && sites4b.getSequence(7).toString() == sites4->getSequence(7).toString()
+              && sites4b.getSequencesNames() == sites4->getSequencesNames();
+
+  //Streaming writer must give the same output as the container writer:
+  ostringstream phOut, phStream;
+  phylip.writeAlignment(phOut, *sites1);
+  {
+    PhylipStreamWriter writer(phStream, phylip, alpha, sites1->getSequencesNames(), sites1->getNumberOfSites());
+    for (size_t i = 0; i < sites1->getNumberOfSites(); ++i)
+      writer.addSite(sites1->getSite(i));
+    writer.close();
+  }
+  cout << "Streamed Phylip output: " << phStream.str().size() << " characters." << endl;
+  test = test && phOut.str() == phStream.str();
+
+  //Batch loading of alignments, in parallel when possible:
+  vector<string> batchPaths(3, "example.fasta");
+  map<string, string> batchParams;
+  batchParams["input.sequence.format"] = "Fasta";
+  batchParams["input.sequence.sites_to_use"] = "all";
+  uint64_t batchCalls = 0;
+  if (SeqInstrumentation::isEnabled())
+    batchCalls = SeqInstrumentation::getCounter("Fasta::appendSequencesFromStream").getNumberOfCalls();
+  vector<VectorSiteContainer*> batch = SequenceApplicationTools::loadSiteContainers(alpha, batchPaths, batchParams, "", true, false);
+  test = test && batch.size() == 3;
+  //Each file is parsed exactly once, whatever the number of threads:
+  if (SeqInstrumentation::isEnabled())
+    test = test && SeqInstrumentation::getCounter("Fasta::appendSequencesFromStream").getNumberOfCalls() == batchCalls + 3;
+  for (size_t i = 0; i < batch.size(); ++i) {
+    test = test && batch[i] && batch[i]->getNumberOfSequences() == 100 && batch[i]->getNumberOfSites() == sites1->getNumberOfSites();
+    delete batch[i];
+  }
+
+  //GenBank and EMBL records, with their feature tables:
+  DNA dna;
+  string gbRecords =
+    "LOCUS       SEQ1                      24 bp    DNA     linear   SYN 19-OCT-2026\n"
+    "DEFINITION  Test record.\n"
+    "ACCESSION   AB000001 AB000002\n"
+    "FEATURES             Location/Qualifiers\n"
+    "     source          1..24\n"
+    "                     /organism=\"synthetic\n"
+    "                     construct\"\n"
+    "     CDS             join(<3..8,\n"
+    "                     12..>20)\n"
+    "                     /gene=\"abc\"\n"
+    "                     /pseudo\n"
+    "     misc_feature    complement(22^23)\n"
+    "ORIGIN      \n"
+    "        1 acgtacgtac gtacgtacgt acgt\n"
+    "//\n"
+    "\n"
+    "LOCUS       SEQ2                       8 bp    DNA     linear   SYN 19-OCT-2026\n"
+    "ACCESSION   AB000003\n"
+    "ORIGIN      \n"
+    "        1 ttttgggg\n"
+    "//\n"
+    "LOCUS       CON1                      32 bp    DNA     linear   CON 19-OCT-2026\n"
+    "ACCESSION   AB000004\n"
+    "CONTIG      join(AB000001.1:1..24,AB000003.1:1..8)\n"
+    "//\n";
+  GenBank genBank;
+  istringstream gbStream(gbRecords);
+  SequenceWithAnnotation gbSeq(&dna);
+  vector<SequenceFeature> gbFeatures;
+  test = test && genBank.nextSequence(gbStream, gbSeq, gbFeatures);
+  test = test && gbSeq.getName() == "AB000001" && gbSeq.toString() == "ACGTACGTACGTACGTACGTACGT";
+  test = test && gbFeatures.size() == 4;
+  if (gbFeatures.size() == 4) {
+    test = test && gbFeatures[0].getType() == "source" && gbFeatures[0].getBegin() == 0 && gbFeatures[0].getEnd() == 24;
+    test = test && gbFeatures[0].getAttribute("organism") == "synthetic construct";
+    test = test && gbFeatures[1].getType() == "CDS" && gbFeatures[1].getBegin() == 2 && gbFeatures[1].getEnd() == 8 && gbFeatures[1].getStrand() == '+';
+    test = test && gbFeatures[2].getBegin() == 11 && gbFeatures[2].getEnd() == 20;
+    test = test && gbFeatures[2].getAttribute("gene") == "abc" && gbFeatures[2].hasAttribute("pseudo");
+    test = test && gbFeatures[3].getBegin() == 22 && gbFeatures[3].getEnd() == 22 && gbFeatures[3].getStrand() == '-';
+  }
+  test = test && gbSeq.hasAnnotation(SequenceFeatureSet::FEATURES);
+  if (gbSeq.hasAnnotation(SequenceFeatureSet::FEATURES))
+    test = test && dynamic_cast<const SequenceFeatureSet&>(gbSeq.getAnnotation(SequenceFeatureSet::FEATURES)).getNumberOfFeatures() == 4;
+  test = test && genBank.nextSequence(gbStream, gbSeq) && gbSeq.getName() == "AB000003" && gbSeq.size() == 8;
+  //Records without sequence are returned empty, but not added to containers:
+  test = test && genBank.nextSequence(gbStream, gbSeq) && gbSeq.getName() == "AB000004" && gbSeq.size() == 0;
+  test = test && !genBank.nextSequence(gbStream, gbSeq);
+
+  genBank.setNumberOfRecordsPerBatch(1);
+  istringstream gbStream2(gbRecords);
+  VectorSequenceContainer gbSequences(&dna);
+  genBank.readSequences(gbStream2, gbSequences);
+  cout << "GenBank records: " << gbSequences.getNumberOfSequences() << endl;
+  test = test && gbSequences.getNumberOfSequences() == 2 && gbSequences.getSequence(1).toString() == "TTTTGGGG";
+
+  string emblRecord =
+    "ID   X00001; SV 1; linear; genomic DNA; STD; SYN; 12 BP.\n"
+    "AC   X00001;\n"
+    "FT   gene            complement(2..10)\n"
+    "FT                   /gene=\"xyz\"\n"
+    "SQ   Sequence 12 BP;\n"
+    "     aaaacccggg tt                                                      12\n"
+    "//\n";
+  Embl embl;
+  istringstream emblStream(emblRecord);
+  BasicSequence emblSeq(&dna);
+  vector<SequenceFeature> emblFeatures;
+  test = test && embl.nextSequence(emblStream, emblSeq, emblFeatures);
+  test = test && emblSeq.getName() == "X00001" && emblSeq.toString() == "AAAACCCGGGTT";
+  test = test && emblFeatures.size() == 1;
+  if (emblFeatures.size() == 1)
+    test = test && emblFeatures[0].getBegin() == 1 && emblFeatures[0].getEnd() == 10 && emblFeatures[0].getStrand() == '-' && emblFeatures[0].getAttribute("gene") == "xyz";
+
+  //Stockholm files with several alignments, interleaved blocks and annotations:
+  string stoRecords =
+    "# STOCKHOLM 1.0\n"
+    "#=GF ID    test1\n"
+    "#=GF CC    A comment.\n"
+    "#=GS seq1  AC P00001\n"
+    "seq1       ACGT\n"
+    "#=GR seq1  SS HHEE\n"
+    "seq2       AC-T\n"
+    "#=GC SS_cons <<>>\n"
+    "\n"
+    "seq1       TT\n"
+    "#=GR seq1  SS ..\n"
+    "seq2       TA\n"
+    "#=GC SS_cons ..\n"
+    "//\n"
+    "# STOCKHOLM 1.0\n"
+    "seqA AAA\n"
+    "seqB CCC\n"
+    "seqC GGG\n"
+    "//\n";
+  Stockholm stockholm;
+  istringstream stoStream(stoRecords);
+  StockholmAlignmentIterator stoIt(stockholm, stoStream, &dna);
+  StockholmAnnotation stoAnnotation;
+  unique_ptr<AlignedSequenceContainer> sto1(stoIt.nextAlignment(&stoAnnotation));
+  unique_ptr<AlignedSequenceContainer> sto2(stoIt.nextAlignment());
+  test = test && sto1.get() && sto2.get() && !stoIt.hasMoreAlignments();
+  if (sto1.get() && sto2.get()) {
+    cout << "Stockholm alignments: " << sto1->getNumberOfSequences() << "x" << sto1->getNumberOfSites() << ", "
+         << sto2->getNumberOfSequences() << "x" << sto2->getNumberOfSites() << endl;
+    test = test && sto1->getNumberOfSequences() == 2 && sto1->getSequence(1).toString() == "AC-TTA";
+    test = test && sto2->getNumberOfSequences() == 3 && sto2->getNumberOfSites() == 3;
+    test = test && sto1->getGeneralComments().size() == 1 && sto1->getGeneralComments()[0] == "A comment.";
+    test = test && stoAnnotation.getFileAnnotations().size() == 1 && stoAnnotation.getFileAnnotations()[0].second == "test1";
+    test = test && stoAnnotation.hasColumnAnnotation("SS_cons") && stoAnnotation.getColumnAnnotation("SS_cons") == "<<>>..";
+    test = test && stoAnnotation.hasResidueAnnotation("seq1", "SS") && stoAnnotation.getResidueAnnotation("seq1", "SS") == "HHEE..";
+
+    //Writing and reading again preserves the annotations:
+    ostringstream stoOut;
+    stockholm.writeAlignment(stoOut, *sto1, stoAnnotation);
+    istringstream stoIn(stoOut.str());
+    AlignedSequenceContainer sto3(&dna);
+    StockholmAnnotation stoAnnotation3;
+    test = test && stockholm.nextAlignment(stoIn, sto3, &stoAnnotation3);
+    test = test && sto3.getSequence(0).toString() == sto1->getSequence(0).toString();
+    test = test && stoAnnotation3.getResidueAnnotation("seq1", "SS") == "HHEE..";
+    test = test && stoAnnotation3.getColumnAnnotation("SS_cons") == "<<>>..";
+    test = test && stoAnnotation3.getSequenceAnnotations().size() == 1;
+  }
+
+  //Pfam-style alignment, with '.' gaps in insert columns:
+  string pfamRecord =
+    "# STOCKHOLM 1.0\n"
+    "#=GF ID   Test_domain\n"
+    "#=GF AC   PF00000.1\n"
+    "Q12345_HUMAN/10-25   MKV..LLAGcs.SST-W\n"
+    "P67890_MOUSE/3-19    MKVivLLAG..dSSTRW\n"
+    "#=GC seq_cons        MKV..LLAG...SSTpW\n"
+    "//\n";
+  istringstream pfamStream(pfamRecord);
+  AlignedSequenceContainer pfam(alpha);
+  test = test && stockholm.nextAlignment(pfamStream, pfam);
+  test = test && pfam.getNumberOfSequences() == 2 && pfam.getNumberOfSites() == 17;
+  test = test && pfam.toString("Q12345_HUMAN/10-25") == "MKV--LLAGCS-SST-W";
+  test = test && pfam.toString("P67890_MOUSE/3-19") == "MKVIVLLAG--DSSTRW";
+
+  //Instrumentation counters are only filled when the library is compiled with them:
+  ostringstream report;
+  SeqInstrumentation::report(report);
+  cout << report.str();
+  if (SeqInstrumentation::isEnabled()) {
+    //Other tests in this program read Fasta files too, so only count calls around a known read:
+    const InstrumentationCounter& fastaCounter = SeqInstrumentation::getCounter("Fasta::appendSequencesFromStream");
+    uint64_t fastaCalls = fastaCounter.getNumberOfCalls();
+    unique_ptr<SiteContainer> counted(fasta.readAlignment("example.fasta", alpha));
+    test = test && fastaCounter.getNumberOfCalls() == fastaCalls + 1;
+    SeqInstrumentation::reset();
+    test = test && fastaCounter.getNumberOfCalls() == 0;
+  }
+
   delete sites1;
   delete sites2;
   delete sites3;
@@ -0,0 +1,142 @@
+//
+// File: test_kmers.cpp
+// Created by: agent
+// Created on: Mon Oct 19 2026
+//
+
+/*
+Copyright or © or Copr. Bio++ Development Team, (November 17, 2004)
+
+This software is a computer program whose purpose is to provide classes
+for numerical calculus. This file is part of the Bio++ project.
+
+This software is governed by the CeCILL  license under French law and
+abiding by the rules of distribution of free software.  You can  use, 
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info". 
+
+As a counterpart to the access to the source code and  rights to copy,
+modify and redistribute granted by the license, users are provided only
+with a limited warranty  and the software's author,  the holder of the
+economic rights,  and the successive licensors  have only  limited
+liability. 
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or 
+data to be ensured and,  more generally, to use and operate it in the 
+same conditions as regards security. 
+
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+*/
+
+#include <Bpp/Numeric/Random/RandomTools.h>
+#include <Bpp/Seq/Alphabet/AlphabetTools.h>
+#include <Bpp/Seq/Alphabet/WordAlphabet.h>
+#include <Bpp/Seq/Container/VectorSequenceContainer.h>
+#include <Bpp/Seq/KmerCounter.h>
+#include <Bpp/Seq/MinHashTools.h>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+
+using namespace bpp;
+using namespace std;
+
+int main() {
+  const Alphabet* alpha = &AlphabetTools::DNA_ALPHABET;
+  unsigned int k = 5;
+
+  //Codes must match the ones of the corresponding word alphabet:
+  WordAlphabet words(alpha, k);
+  if (static_cast<int>(KmerTools::encode("ACGTT", alpha)) != words.charToInt("ACGTT")) return 1;
+  if (KmerTools::decode(KmerTools::encode("GATTC", alpha), k, alpha) != "GATTC") return 1;
+  if (KmerTools::reverseComplement(KmerTools::encode("AACGT", alpha), k) != KmerTools::encode("ACGTT", alpha)) return 1;
+
+  //Count k-mers in random sequences, with a few unresolved states:
+  VectorSequenceContainer sequences(alpha);
+  for (size_t i = 0; i < 5; ++i) {
+    string seq = "";
+    for (size_t j = 0; j < 2000; ++j)
+      seq += alpha->intToChar(static_cast<int>(RandomTools::giveIntRandomNumberBetweenZeroAndEntry(4)));
+    seq[100 * i + 50] = 'N';
+    sequences.addSequence(BasicSequence("seq" + TextTools::toString(i), seq, alpha));
+  }
+
+  KmerCounter counter(k, true, 4);
+  counter.addSequences(sequences);
+  KmerCounter sketch(k, true, 512, 4);
+  sketch.addSequences(sequences);
+
+  //Naive count:
+  map<string, size_t> naive;
+  size_t total = 0;
+  for (size_t i = 0; i < sequences.getNumberOfSequences(); ++i) {
+    string seq = sequences.getSequence(i).toString();
+    for (size_t j = 0; j + k <= seq.size(); ++j) {
+      string kmer = seq.substr(j, k);
+      if (kmer.find('N') != string::npos) continue;
+      string rc(kmer.rbegin(), kmer.rend());
+      for (size_t l = 0; l < k; ++l)
+        rc[l] = (rc[l] == 'A' ? 'T' : (rc[l] == 'C' ? 'G' : (rc[l] == 'G' ? 'C' : 'A')));
+      naive[kmer < rc ? kmer : rc]++;
+      total++;
+    }
+  }
+  cout << "Total: " << counter.getTotalNumberOfKmers() << " k-mers, " << counter.getNumberOfDistinctKmers() << " distinct." << endl;
+  if (counter.getTotalNumberOfKmers() != total) return 1;
+  if (counter.getNumberOfDistinctKmers() != naive.size()) return 1;
+  for (map<string, size_t>::iterator it = naive.begin(); it != naive.end(); ++it) {
+    uint64_t kmer = KmerTools::encode(it->first, alpha);
+    if (counter.getCount(kmer) != it->second) return 1;
+    if (counter.getCount(KmerTools::reverseComplement(kmer, k)) != it->second) return 1;
+    if (sketch.getCount(kmer) < it->second) return 1;
+  }
+
+  KmerCountIterator kit(counter);
+  size_t sum = 0;
+  while (kit.hasMoreKmers()) {
+    pair<uint64_t, size_t> kc = kit.nextKmer();
+    if (naive[KmerTools::decode(kc.first, k, alpha)] != kc.second) return 1;
+    sum += kc.second;
+  }
+  if (sum != total) return 1;
+
+  vector<size_t> spectrum = counter.getSpectrum(20);
+  size_t distinct = 0;
+  for (size_t i = 0; i < spectrum.size(); ++i) distinct += spectrum[i];
+  if (distinct != naive.size()) return 1;
+  counter.writeSpectrum(cout, 20);
+
+  //MinHash distances: identical sequences are at distance 0, mutated ones are closer than unrelated ones.
+  string mutated = sequences.getSequence(0).toString();
+  for (size_t j = 0; j < mutated.size(); j += 50)
+    mutated[j] = (mutated[j] == 'A' ? 'C' : 'A');
+  sequences.addSequence(BasicSequence("mutated", mutated, alpha));
+  sequences.addSequence(BasicSequence("copy", sequences.getSequence(1).toString(), alpha));
+  vector<MinHashSketch> sketches;
+  MinHashTools::sketchSequences(sequences, 12, 200, sketches);
+  unique_ptr<DistanceMatrix> dist(MinHashTools::computeDistanceMatrix(sketches));
+  cout << "Mash distances: " << (*dist)("seq0", "mutated") << " " << (*dist)("seq0", "seq2") << " " << (*dist)("seq1", "copy") << endl;
+  if ((*dist)("seq1", "copy") != 0.) return 1;
+  if ((*dist)("seq0", "mutated") >= (*dist)("seq0", "seq2")) return 1;
+  if ((*dist)("seq0", "seq2") != (*dist)("seq2", "seq0")) return 1;
+
+  stringstream ss;
+  MinHashTools::writeSketches(sketches, ss);
+  vector<MinHashSketch> sketches2;
+  MinHashTools::readSketches(ss, sketches2);
+  if (sketches2.size() != sketches.size()) return 1;
+  for (size_t i = 0; i < sketches.size(); ++i)
+    if (sketches2[i].getName() != sketches[i].getName() || sketches2[i].getHashes() != sketches[i].getHashes()) return 1;
+
+  return 0;
+}
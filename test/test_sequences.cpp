@@ -39,8 +39,19 @@ knowledge of the CeCILL license and that you accept its terms.
 
 #include <Bpp/Seq/Alphabet/DNA.h>
 #include <Bpp/Seq/Alphabet/AlphabetTools.h>
+#include <Bpp/Seq/Alphabet/CodonAlphabet.h>
 #include <Bpp/Seq/SequenceTools.h>
+#include <Bpp/Seq/HaplotypeIterator.h>
+#include <Bpp/Seq/SymbolListTools.h>
+#include <Bpp/Seq/SequenceWithQualityTools.h>
+#include <Bpp/Seq/Container/SequenceContainerTools.h>
+#include <Bpp/Seq/SlidingWindowComposition.h>
+#include <Bpp/Seq/Container/VectorSequenceContainer.h>
+#include <Bpp/Seq/Container/VectorSiteContainer.h>
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <sstream>
 
 using namespace bpp;
 using namespace std;
@@ -88,5 +99,134 @@ int main() {
   if (pos != 16) return 1;
   cout << motif7.toString() << ": " << pos << endl;
 
+  cout << "--- Contiguous state access ---" << endl;
+
+  if (seq1.getData() == 0) return 1;
+  SymbolListSpan span(seq1);
+  if (span.data() != seq1.getData() || span.size() != seq1.size()) return 1;
+  for (size_t i = 0; i < seq1.size(); ++i)
+    if (span[i] != seq1[i]) return 1;
+  map<int, size_t> counts;
+  SymbolListTools::getCounts(seq1, counts);
+  if (counts[-1] != 4 || counts[0] != 7) return 1;
+  if (SequenceTools::getNumberOfSites(seq1) != seq1.size() - 4) return 1;
+
+  cout << "--- Reverse complement ---" << endl;
+
+  BasicSequence strand("strand", "ACGTTMRWSYKVHDBN-A", &AlphabetTools::DNA_ALPHABET);
+  unique_ptr<Sequence> rc(SequenceTools::getInvertComplement(strand));
+  cout << rc->toString() << endl;
+  if (rc->toString() != "T-NVHDBMRSWYKAACGT") return 1;
+  unique_ptr<Sequence> comp(SequenceTools::getComplement(strand));
+  SequenceTools::invert(*comp);
+  if (comp->toString() != rc->toString()) return 1;
+  SequenceTools::invertComplement(*rc);
+  if (rc->toString() != strand.toString()) return 1;
+  unique_ptr<Sequence> rna(SequenceTools::transcript(strand));
+  if (rna->toString() != "UGCAAKYWSRMBDHVN-U") return 1;
+  //Sequences with listeners are modified element by element:
+  vector<int> scores(strand.size());
+  for (size_t i = 0; i < scores.size(); ++i) scores[i] = static_cast<int>(i);
+  SequenceWithQuality read("read", strand.toString(), scores, &AlphabetTools::DNA_ALPHABET);
+  unique_ptr<SequenceWithQuality> rcRead(SequenceWithQualityTools::invertComplement(read));
+  if (rcRead->toString() != "T-NVHDBMRSWYKAACGT" || rcRead->getQualities()[0] != 17) return 1;
+  SequenceTools::invertComplement(read);
+  if (read.toString() != rcRead->toString() || read.getQualities()[0] != 0) return 1;
+  VectorSequenceContainer reads(&AlphabetTools::DNA_ALPHABET), rcReads(&AlphabetTools::DNA_ALPHABET);
+  reads.addSequence(strand);
+  reads.addSequence(seq1);
+  SequenceContainerTools::getInvertComplement(reads, rcReads);
+  if (rcReads.getNumberOfSequences() != 2 || rcReads.getSequence(0).toString() != "T-NVHDBMRSWYKAACGT") return 1;
+  SequenceTools::invertComplement(seq1);
+  if (rcReads.getSequence(1).toString() != seq1.toString()) return 1;
+  SequenceTools::invertComplement(seq1);
+
+  cout << "--- Sliding window composition ---" << endl;
+
+  for (size_t step = 1; step < 12; step += 5) {
+    SlidingWindowComposition scanner(10, step);
+    vector<WindowComposition> windows;
+    scanner.scan(seq1, windows);
+    if (windows.size() != (seq1.size() - 10) / step + 1) return 1;
+    for (size_t i = 0; i < windows.size(); ++i) {
+      WindowComposition ref(i * step, i * step + 10);
+      for (size_t j = ref.getBegin(); j < ref.getEnd(); ++j)
+        ref.addState(seq1[j]);
+      if (windows[i].getBegin() != ref.getBegin()) return 1;
+      for (int k = 0; k < 4; ++k)
+        if (windows[i].getCount(k) != ref.getCount(k)) return 1;
+      if (windows[i].getNumberOfGaps() != ref.getNumberOfGaps()) return 1;
+      if (windows[i].getNumberOfUnresolvedStates() != ref.getNumberOfUnresolvedStates()) return 1;
+    }
+  }
+  WindowComposition first;
+  for (size_t j = 0; j < 6; ++j) first.addState(seq1[j]); //ATTTCG
+  if (first.getGCContent() != 2. / 6. || first.getGCSkew() != 0.) return 1;
+
+  VectorSequenceContainer sequences(&AlphabetTools::DNA_ALPHABET);
+  sequences.addSequence(seq1);
+  sequences.addSequence(BasicSequence("short", "ACGT", &AlphabetTools::DNA_ALPHABET));
+  sequences.addSequence(BasicSequence("GC", "GGGGCCCCGG", &AlphabetTools::DNA_ALPHABET));
+  ostringstream tracks;
+  TabWindowCompositionWriter writer(tracks, false);
+  SlidingWindowComposition(10, 10).scan(sequences, writer);
+  cout << tracks.str();
+  if (tracks.str().find("GC\t0\t10\t0\t4\t6\t0\t0\t0\t1\t0.2\t") == string::npos) return 1;
+  if (tracks.str().find("short") != string::npos) return 1;
+
+  cout << "--- Codon positions ---" << endl;
+
+  CodonAlphabet codonAlpha(&AlphabetTools::DNA_ALPHABET);
+  VectorSequenceContainer nucleotides(&AlphabetTools::DNA_ALPHABET);
+  nucleotides.addSequence(BasicSequence("s1", "ATGCCA---NNNTA", &AlphabetTools::DNA_ALPHABET));
+  nucleotides.addSequence(BasicSequence("s2", "GGGAAATTTCCCGG", &AlphabetTools::DNA_ALPHABET));
+  VectorSequenceContainer frame1(&codonAlpha), frame2(&codonAlpha), frame3(&codonAlpha);
+  SequenceContainerTools::getReadingFrames(nucleotides, frame1, frame2, frame3);
+  if (frame1.toString("s1") != "ATGCCA---NNN" || frame1.toString("s2") != "GGGAAATTTCCC") return 1;
+  if (frame2.toString("s1") != "TGCNNNNNNNNN" || frame3.toString("s2") != "GAAATTTCCCGG") return 1;
+  VectorSequenceContainer pos1(&AlphabetTools::DNA_ALPHABET), pos2(&AlphabetTools::DNA_ALPHABET), pos3(&AlphabetTools::DNA_ALPHABET);
+  SequenceContainerTools::getCodonPositions(nucleotides, pos1, pos2, pos3);
+  if (pos1.toString("s1") != "AC-NT" || pos2.toString("s1") != "TC-NA" || pos3.toString("s1") != "GA-N") return 1;
+  VectorSiteContainer cpos1(&AlphabetTools::DNA_ALPHABET), cpos2(&AlphabetTools::DNA_ALPHABET), cpos3(&AlphabetTools::DNA_ALPHABET);
+  SequenceContainerTools::getCodonPositions(frame1, cpos1, cpos2, cpos3);
+  if (cpos1.getNumberOfSites() != 4 || cpos1.toString("s1") != "AC-N" || cpos2.toString("s1") != "TC-N" || cpos3.toString("s2") != "GATC") return 1;
+  unique_ptr<SequenceContainer> second(SequenceContainerTools::getCodonPosition(frame1, 1));
+  if (second->toString("s2") != cpos2.toString("s2")) return 1;
+  //Gap and unresolved codons give gaps and unknown characters at all positions:
+  for (size_t k = 0; k < 3; ++k) {
+    unique_ptr<SequenceContainer> position(SequenceContainerTools::getCodonPosition(frame1, k));
+    if (position->toString("s1").substr(2) != "-N") return 1;
+  }
+
+  cout << "--- Haplotypes ---" << endl;
+
+  BasicSequence genotype("geno", "ARTYN-", &AlphabetTools::DNA_ALPHABET);
+  HaplotypeIterator haplotypes(genotype);
+  if (haplotypes.getNumberOfHaplotypes() != 4. || haplotypes.getNumberOfHeterozygousSites() != 2) return 1;
+  vector<Sequence*> putative;
+  SequenceTools::getPutativeHaplotypes(genotype, putative);
+  vector<string> expected;
+  for (size_t i = 0; i < putative.size(); ++i) {
+    expected.push_back(putative[i]->toString());
+    delete putative[i];
+  }
+  sort(expected.begin(), expected.end());
+  vector<string> found;
+  while (haplotypes.hasMoreSequences()) {
+    unique_ptr<Sequence> hap(haplotypes.nextSequence());
+    cout << hap->getName() << "\t" << hap->toString() << endl;
+    found.push_back(hap->toString());
+  }
+  if (found != expected || found[0] != "AATCN-" || haplotypes.getNumberOfHaplotypesReturned() != 4) return 1;
+  haplotypes.reset();
+  unique_ptr<Sequence> firstHap(haplotypes.nextSequence());
+  if (firstHap->getName() != "geno_hap1" || firstHap->toString() != found[0]) return 1;
+  VectorSequenceContainer genotypes(&AlphabetTools::DNA_ALPHABET), resolved(&AlphabetTools::DNA_ALPHABET);
+  genotypes.addSequence(genotype);
+  genotypes.addSequence(BasicSequence("homo", "ACGT", &AlphabetTools::DNA_ALPHABET));
+  SequenceContainerTools::getPutativeHaplotypes(genotypes, resolved, 2, 3);
+  if (resolved.getNumberOfSequences() != 4 || resolved.getSequencesNames()[3] != "homo_hap1") return 1;
+  if (resolved.getSequencesNames()[0] != "geno_sample1" || resolved.toString(2).substr(4) != "N-") return 1;
+
   return (0);
 }
@@ -41,6 +41,9 @@ knowledge of the CeCILL license and that you accept its terms.
 #include <Bpp/Seq/Alphabet/RNA.h>
 #include <Bpp/Seq/Sequence.h>
 #include <Bpp/Seq/SequenceWalker.h>
+#include <Bpp/Seq/SequencePositionIndex.h>
+#include <Bpp/Seq/Container/VectorSiteContainer.h>
+#include <Bpp/Seq/Container/SiteContainerTools.h>
 #include <Bpp/Numeric/Random/RandomTools.h>
 #include <iostream>
 
@@ -115,5 +118,38 @@ int main() {
   if (!testSeq(walker, 21, 10)) return 1;
   if (!testSeq(walker, 40, 22)) return 1;
 
+  //Position index against the map-based translations:
+  SequencePositionIndex index(seq1);
+  map<size_t, size_t> seqPos = SiteContainerTools::getSequencePositions(seq1);
+  map<size_t, size_t> alnPos = SiteContainerTools::getAlignmentPositions(seq1);
+  if (index.getNumberOfResidues() != alnPos.size()) return 1;
+  for (size_t i = 0; i < seq1.size(); ++i) {
+    if (index.isGap(i) != (seqPos.find(i + 1) == seqPos.end())) return 1;
+    if (!index.isGap(i) && index.getSequencePosition(i) + 1 != seqPos[i + 1]) return 1;
+  }
+  for (size_t i = 0; i < index.getNumberOfResidues(); ++i)
+    if (index.getAlignmentPosition(i) + 1 != alnPos[i + 1]) return 1;
+  cout << index.getNumberOfSegments() << " ungapped segments." << endl;
+
+  BasicSequence seq2("seq2", "---GAAGGCG---G-GU----UUU----GC-GACCGACG--UUUU--", alpha);
+  VectorSiteContainer sites(alpha);
+  sites.addSequence(seq1, false);
+  sites.addSequence(seq2, false);
+  map<size_t, size_t> tln = SiteContainerTools::translateSequence(sites, 0, 1);
+  size_t count1 = 0, count2 = 0;
+  for (size_t i = 0; i < seq1.size(); ++i) {
+    if (seq2[i] != -1) count2++;
+    if (seq1[i] != -1) {
+      count1++;
+      if (tln[count1] != (seq2[i] == -1 ? 0 : count2)) return 1;
+    }
+  }
+
+  BasicSequence seq3("seq3", "AUG--CCGGCGUUUUGGCCGACGUGUUUU", alpha);
+  tln = SiteContainerTools::translateAlignment(seq1, seq3);
+  SequencePositionIndex index3(seq3);
+  for (map<size_t, size_t>::iterator it = tln.begin(); it != tln.end(); ++it)
+    if (index3.getAlignmentPosition(index.getSequencePosition(it->first - 1)) + 1 != it->second) return 1;
+
   return 0;
 }